@@ -2,7 +2,7 @@
  * VulkanTutorial project
  *
  * Created by Andriy Zhabura on 02-Oct-2016.
- * Last modified on 12-Dec-2016.
+ * Last modified on 19-Oct-2026.
  */
 
 /*
@@ -30,13 +30,53 @@
 #include "ZVK_Application.h"
 #include <stdexcept>
 #include <limits>
+#include <chrono>
+#include <iomanip>
+#include <algorithm>
+#include <cstddef>
+#include <cctype>
+#include <cmath>
 
 #include "Z_Shaders.h"
 #include "Z_Vertices.h"
+#include "Z_MeshOptimizer.h"
+#include "Z_MeshSimplifier.h"
+#include "Z_MatrixBatch.h"
+
+namespace
+{
+	/* Float attributes of the cube vertices in Z_Vertices.h. */
+	Z_VertexQuantizer::source_layout cube_vertex_layout(bool textured)
+	{
+		const uint32_t absent = Z_VertexQuantizer::absent;
+		return textured
+			? Z_VertexQuantizer::source_layout{ sizeof(VertexUV), offsetof(VertexUV, posX), absent, offsetof(VertexUV, u), absent }
+			: Z_VertexQuantizer::source_layout{ sizeof(Vertex), offsetof(Vertex, posX), offsetof(Vertex, r), absent, absent };
+	}
+
+	vk::Format to_vertex_format(Z_MeshFile::attribute_format format)
+	{
+		switch (format)
+		{
+		case Z_MeshFile::format_float32x2: return vk::Format::eR32G32Sfloat;
+		case Z_MeshFile::format_float32x3: return vk::Format::eR32G32B32Sfloat;
+		case Z_MeshFile::format_float32x4: return vk::Format::eR32G32B32A32Sfloat;
+		case Z_MeshFile::format_half2: return vk::Format::eR16G16Sfloat;
+		case Z_MeshFile::format_half4: return vk::Format::eR16G16B16A16Sfloat;
+		case Z_MeshFile::format_snorm16x4: return vk::Format::eR16G16B16A16Snorm;
+		case Z_MeshFile::format_unorm8x4: return vk::Format::eR8G8B8A8Unorm;
+		case Z_MeshFile::format_octahedral16: return vk::Format::eR16G16Snorm;
+		default:
+			throw std::domain_error{ "The mesh has no vertex attributes the scene needs" };
+		}
+	}
+}
 
 ZVK_Application::ZVK_Application()
     : window(L"Vulkan Tutorial", 800, 600)
 {
+	Z_StartupReport::scoped_timer timer{ startup_report, "ZVK_Application" };
+
 	if (vk::Result::eSuccess != get_LayerProperties())
 	{
 		throw std::domain_error{"Problem while getting Layer Properties"};
@@ -71,7 +111,10 @@ ZVK_Application::ZVK_Application()
 		.setEnabledLayerCount(static_cast<uint32_t>(layers.size()))
 		.setPpEnabledLayerNames(layers.data());
 	
-	instance = vk::createInstance(inst_info);
+	{
+		Z_StartupReport::scoped_timer create_timer{ startup_report, "createInstance" };
+		instance = ZVK_Handle<vk::Instance>(nullptr, vk::createInstance(inst_info));
+	}
 
 	if (!instance)
 	{
@@ -86,111 +129,19 @@ ZVK_Application::ZVK_Application()
 
 ZVK_Application::~ZVK_Application()
 {
-	if (image_acquired_semaphore)
-	{
-		logical_device.destroySemaphore(image_acquired_semaphore);
-	}
-	if (pipeline)
-	{
-		logical_device.destroyPipeline(pipeline);
-	}
-	if (pipeline_cache)
-	{
-		logical_device.destroyPipelineCache(pipeline_cache);
-	}
-	if (vertex_buffer_memory)
-	{
-		logical_device.freeMemory(vertex_buffer_memory);
-	}	
-	if (vertex_buffer)
-	{
-		logical_device.destroyBuffer(vertex_buffer);
-	}
-	clear_framebuffers();
-	if (shaders.size())
-	{
-		for (auto s : shaders)
-		{
-			if (s)
-			{
-				logical_device.destroyShaderModule(s);
-			}
-		}
-	}
-    if (render_pass)
-    {
-        logical_device.destroyRenderPass(render_pass);
-    }
-    if (desc_pool)
-    {
-        logical_device.destroyDescriptorPool(desc_pool);
-    }
-    if (pipeline_layout)
-    {
-        logical_device.destroyPipelineLayout(pipeline_layout);
-    }
-    if (descriptor_layouts.size())
-    {
-        for (auto dl : descriptor_layouts)
-        {
-            if (dl)
-            {
-                logical_device.destroyDescriptorSetLayout(dl);
-            }
-        }
-    }
-    if (uniform_buffer_memory)
-    {
-        logical_device.freeMemory(uniform_buffer_memory);
-    }
-    if (uniform_buffer)
-    {
-        logical_device.destroyBuffer(uniform_buffer);
-    }
-    if (depth_image_view)
-    {
-        logical_device.destroyImageView(depth_image_view);
-    }
-    if (depth_memory)
-    {
-        logical_device.freeMemory(depth_memory);
-    }
-    if (depth_image)
-    {
-        logical_device.destroyImage(depth_image);
-    }
-    if (image_views.size())
-    {
-        for (auto iv : image_views)
-        {
-            logical_device.destroyImageView(iv);
-        }
-    }
-    if (swap_chain)
-    {
-        logical_device.destroySwapchainKHR(swap_chain);
-    }
-    if (surface)
-    {
-        instance.destroySurfaceKHR(surface);
-    }
-	if (command_buffers.size())
-	{
-		logical_device.freeCommandBuffers(cmd_pool, command_buffers);
-	}
-	if (cmd_pool)
-	{
-		logical_device.destroyCommandPool(cmd_pool);
-	}
+	/* The owned objects are destroyed in the reverse order of their */
+	/* declaration, the device and the instance are declared first.  */
 	if (logical_device)
 	{
-		logical_device.destroy();
+		logical_device->waitIdle();
 	}
-	instance.destroy();
+	deletion_queue.flush();
 }
 
 vk::Result ZVK_Application::get_LayerProperties()
 {
+	Z_StartupReport::scoped_timer timer{ startup_report, "get_LayerProperties" };
+
 	uint32_t count = 0;
 	vk::Result res;
 	do
@@ -217,6 +168,8 @@ vk::Result ZVK_Application::get_LayerProperties()
 
 vk::Result ZVK_Application::get_ExtensionProperties()
 {
+	Z_StartupReport::scoped_timer timer{ startup_report, "get_ExtensionProperties" };
+
 	uint32_t count = 0;
 	vk::Result res;
 
@@ -256,8 +209,10 @@ vk::Result ZVK_Application::get_ExtensionProperties()
 
 vk::Result ZVK_Application::get_PhysicalDevices()
 {
+	Z_StartupReport::scoped_timer timer{ startup_report, "get_PhysicalDevices" };
+
 	uint32_t count = 0;
-	vk::Result res = instance.enumeratePhysicalDevices(&count, nullptr);
+	vk::Result res = instance->enumeratePhysicalDevices(&count, nullptr);
 	if (vk::Result::eSuccess != res)
 	{
 		return res;
@@ -268,7 +223,7 @@ vk::Result ZVK_Application::get_PhysicalDevices()
 	}
 
 	gpus.resize(count);
-	res = instance.enumeratePhysicalDevices(&count, gpus.data());
+	res = instance->enumeratePhysicalDevices(&count, gpus.data());
 
 	return res;
 }
@@ -311,12 +266,49 @@ size_t ZVK_Application::get_PhysicalDevicesQty()
 
 bool ZVK_Application::create_LogicalDevice()
 {
+    Z_StartupReport::scoped_timer timer{ startup_report, "create_LogicalDevice" };
+
     create_Surface();
     fill_device_queue_info();
 	
 	std::vector<const char*> extentions;
 	extentions.push_back("VK_KHR_swapchain");
 
+	// Descriptor update templates are optional, they are emulated otherwise.
+	for (auto& e : gpus[0].enumerateDeviceExtensionProperties())
+	{
+		if (std::string(e.extensionName) == ZVK_DescriptorUpdateTemplate::extension_name)
+		{
+			extentions.push_back(ZVK_DescriptorUpdateTemplate::extension_name);
+			has_update_template_ext = true;
+		}
+	}
+
+	vk::PhysicalDeviceFeatures supported_features = gpus[0].getFeatures();
+	// The bindless table holds no textures, it draws the solid faces scene
+	// only, without instances.
+	use_bindless = bindless_requested && !instancing && solid_faces == scene && ZVK_BindlessTable::is_Supported(supported_features);
+	// Lets mips of formats without linear blit be generated by a compute shader.
+	if (supported_features.shaderStorageImageWriteWithoutFormat)
+	{
+		enabled_features.shaderStorageImageWriteWithoutFormat = VK_TRUE;
+		has_storage_write_without_format = true;
+	}
+	// The culling shader counts the instances into the draw commands.
+	use_gpu_culling = gpu_culling_requested && instancing;
+	// Commands leave firstInstance 0, so drawIndirectFirstInstance is not needed.
+	use_indirect = indirect_requested || use_gpu_culling;
+	if (use_indirect && supported_features.multiDrawIndirect)
+	{
+		enabled_features.multiDrawIndirect = VK_TRUE;
+		has_multi_draw_indirect = true;
+		max_draw_indirect_count = gpus[0].getProperties().limits.maxDrawIndirectCount;
+	}
+	if (use_bindless)
+	{
+		enabled_features.shaderStorageBufferArrayDynamicIndexing = VK_TRUE;
+	}
+
 	float queue_priorities[1] = { 0.0 };
 	device_queue_info.pNext = nullptr;
 	device_queue_info.queueCount = 1;
@@ -329,21 +321,26 @@ bool ZVK_Application::create_LogicalDevice()
 	device_info.ppEnabledExtensionNames = extentions.data();
 	device_info.enabledLayerCount = 0;
 	device_info.ppEnabledLayerNames = nullptr;
-	device_info.pEnabledFeatures = nullptr;
+	device_info.pEnabledFeatures = &enabled_features;
 
-	logical_device = gpus[0].createDevice(device_info);
+	{
+		Z_StartupReport::scoped_timer create_timer{ startup_report, "createDevice" };
+		logical_device = ZVK_Handle<vk::Device>(nullptr, gpus[0].createDevice(device_info));
+	}
 
 	return (logical_device ? true : false);
 }
 
 bool ZVK_Application::allocate_CommandBuffers()
 {
+	Z_StartupReport::scoped_timer timer{ startup_report, "allocate_CommandBuffers" };
+
 	vk::CommandPoolCreateInfo cmd_pool_info{};
 	cmd_pool_info.pNext = nullptr;
 	cmd_pool_info.queueFamilyIndex = device_info.pQueueCreateInfos->queueFamilyIndex;
 	cmd_pool_info.flags = vk::CommandPoolCreateFlagBits::eResetCommandBuffer;
 
-	cmd_pool = logical_device.createCommandPool(cmd_pool_info);
+	cmd_pool = own(logical_device->createCommandPool(cmd_pool_info));
 
 	if (!cmd_pool)
 	{
@@ -356,7 +353,7 @@ bool ZVK_Application::allocate_CommandBuffers()
 	cmd.level = vk::CommandBufferLevel::ePrimary;
 	cmd.commandBufferCount = 1;
 
-	command_buffers = logical_device.allocateCommandBuffers(cmd);
+	command_buffers = logical_device->allocateCommandBuffers(cmd);
 	if (!command_buffers.size())
 	{
 		throw std::domain_error{ "Command Buffers were not created" };
@@ -372,7 +369,7 @@ void ZVK_Application::create_Surface()
     info.hinstance = window.module();
     info.hwnd = window.handle();
 
-    surface = instance.createWin32SurfaceKHR(info);
+    surface = ZVK_Handle<vk::SurfaceKHR>(instance, instance->createWin32SurfaceKHR(info));
 
     if (!surface)
     {
@@ -430,6 +427,8 @@ void ZVK_Application::fill_device_queue_info()
 
 bool ZVK_Application::create_Swapchain()
 {
+    Z_StartupReport::scoped_timer timer{ startup_report, "create_Swapchain" };
+
     check_SurfaceFormat();
 
     vk::SurfaceCapabilitiesKHR surface_capabilities{};
@@ -499,7 +498,9 @@ bool ZVK_Application::create_Swapchain()
     swapchain_ci.compositeAlpha = vk::CompositeAlphaFlagBitsKHR::eOpaque;
     swapchain_ci.imageArrayLayers = 1;
     swapchain_ci.presentMode = swap_present_mode;
-    swapchain_ci.oldSwapchain = nullptr;
+    // A recreated swap chain hands its images over from the old one.
+    ZVK_Handle<vk::SwapchainKHR> old_swap_chain = std::move(swap_chain);
+    swapchain_ci.oldSwapchain = old_swap_chain;
     swapchain_ci.clipped = true;
     swapchain_ci.imageColorSpace = vk::ColorSpaceKHR::eSrgbNonlinear;
     swapchain_ci.imageUsage = vk::ImageUsageFlagBits::eColorAttachment;
@@ -517,7 +518,11 @@ bool ZVK_Application::create_Swapchain()
         swapchain_ci.pQueueFamilyIndices = queueFamilyIndices.data();
     }
 
-    swap_chain = logical_device.createSwapchainKHR(swapchain_ci);
+    {
+        Z_StartupReport::scoped_timer create_timer{ startup_report, "createSwapchainKHR" };
+        swap_chain = own(logical_device->createSwapchainKHR(swapchain_ci));
+    }
+    retire(old_swap_chain);
 
     return (swap_chain ? true : false);
 }
@@ -541,7 +546,15 @@ void ZVK_Application::check_SurfaceFormat()
 
 bool ZVK_Application::create_ImageViews()
 {    
-    swap_images = logical_device.getSwapchainImagesKHR(swap_chain);
+    Z_StartupReport::scoped_timer timer{ startup_report, "create_ImageViews" };
+
+    for (auto& iv : image_views)
+    {
+        retire_ImageView(iv);
+    }
+    image_views.clear();
+
+    swap_images = logical_device->getSwapchainImagesKHR(swap_chain);
     if (!swap_images.size())
     {
         throw std::domain_error{ "No Swap Chain Images found" };
@@ -563,7 +576,7 @@ bool ZVK_Application::create_ImageViews()
         color_image_view.subresourceRange.baseArrayLayer = 0;
         color_image_view.subresourceRange.layerCount = 1;
 
-        image_views.push_back(logical_device.createImageView(color_image_view));
+        image_views.push_back(own(logical_device->createImageView(color_image_view)));
         if (!image_views[i])
         {
             throw std::domain_error{ "No Image View created" };
@@ -575,6 +588,13 @@ bool ZVK_Application::create_ImageViews()
 
 bool ZVK_Application::create_DepthBuffer()
 {
+    Z_StartupReport::scoped_timer timer{ startup_report, "create_DepthBuffer" };
+
+    // A recreated depth buffer may still be used by a frame in flight.
+    retire_ImageView(depth_image_view);
+    retire(depth_memory);
+    retire(depth_image);
+
     create_DepthImage();
     allocate_DepthMemory();
     create_DepthImageView();
@@ -613,7 +633,7 @@ void ZVK_Application::create_DepthImage()
     image_info.pQueueFamilyIndices = nullptr;
     image_info.sharingMode = vk::SharingMode::eExclusive;
 
-    depth_image = logical_device.createImage(image_info);
+    depth_image = own(logical_device->createImage(image_info));
     if (!depth_image)
     {
         throw std::domain_error{ "Depth Image is not created" };
@@ -622,7 +642,7 @@ void ZVK_Application::create_DepthImage()
 
 void ZVK_Application::allocate_DepthMemory()
 {
-    depth_memory = logical_device.allocateMemory(get_AllocateInfo(logical_device.getImageMemoryRequirements(depth_image)));
+    depth_memory = own(logical_device->allocateMemory(get_AllocateInfo(logical_device->getImageMemoryRequirements(depth_image))));
     if (!depth_memory)
     {
         throw std::domain_error{ "Depth Memory cannot be allocated" };
@@ -634,35 +654,14 @@ vk::MemoryAllocateInfo ZVK_Application::get_AllocateInfo(vk::MemoryRequirements&
     vk::MemoryAllocateInfo mem_alloc{};
     mem_alloc.pNext = nullptr;
     mem_alloc.allocationSize = mem_reqs.size;
-    mem_alloc.memoryTypeIndex = 0;
-
-    vk::PhysicalDeviceMemoryProperties mem_props = gpus[0].getMemoryProperties();
-
-    // Search memtypes to find first index with those properties
-    bool pass = false;
-    for (uint32_t i = 0; i < mem_props.memoryTypeCount; ++i) {
-        if ((mem_reqs.memoryTypeBits & 1) == 1) {
-            // Type is available, does it match user properties?
-            if ((mem_props.memoryTypes[i].propertyFlags & requirements_mask) == requirements_mask) {
-                mem_alloc.memoryTypeIndex = i;
-                pass = true;
-                break;
-            }
-        }
-        mem_reqs.memoryTypeBits >>= 1;
-    }
-
-    if (!pass)
-    {
-        throw std::domain_error{ "Depth Memory cannot be allocated" };
-    }
+    mem_alloc.memoryTypeIndex = ZVK_Memory::find_Type(gpus[0].getMemoryProperties(), mem_reqs.memoryTypeBits, requirements_mask);
 
     return mem_alloc;
 }
 
 void ZVK_Application::create_DepthImageView()
 {
-    logical_device.bindImageMemory(depth_image, depth_memory, 0);
+    logical_device->bindImageMemory(depth_image, depth_memory, 0);
 
     vk::ImageViewCreateInfo view_info{};
     view_info.pNext = nullptr;
@@ -679,7 +678,7 @@ void ZVK_Application::create_DepthImageView()
     view_info.subresourceRange.layerCount = 1;
     view_info.viewType = vk::ImageViewType::e2D;
 
-    depth_image_view = logical_device.createImageView(view_info);
+    depth_image_view = own(logical_device->createImageView(view_info));
     if (!depth_image_view)
     {
         throw std::domain_error{ "Depth Image cannot be created" };
@@ -688,221 +687,277 @@ void ZVK_Application::create_DepthImageView()
 
 bool ZVK_Application::create_UniformBuffer()
 {
+    Z_StartupReport::scoped_timer timer{ startup_report, "create_UniformBuffer" };
+
     set_view();
-    allocate_UniformMemory();
-    fill_UniformMemory();
+
+    /* The bindless mode reads the same data as a storage buffer */
+    const vk::PhysicalDeviceLimits limits = gpus[0].getProperties().limits;
+    uniform_stream.reset(new ZVK_StreamBuffer(logical_device, gpus[0],
+        vk::BufferUsageFlagBits::eUniformBuffer | vk::BufferUsageFlagBits::eStorageBuffer, sizeof(MVP), 2,
+        std::max(limits.minUniformBufferOffsetAlignment, limits.minStorageBufferOffsetAlignment)));
+    write_Uniforms();
 
     return true;
 }
 
 void ZVK_Application::set_view()
 {
-	float fov = glm::radians(45.0f);
-	if (window.width() > window.height()) {
-		fov *= static_cast<float>(window.height()) / static_cast<float>(window.width());
-	}
-	glm::mat4 projection = glm::perspective(fov,
-		static_cast<float>(window.width()) /
-		static_cast<float>(window.height()), 0.1f, 100.0f);
-
-    auto view = glm::lookAt(
-		glm::vec3(-5,  3, -10), // Camera is at (0,3,10), in World Space
-        glm::vec3( 0,  0,   0),  // and looks at the origin
-        glm::vec3( 0, -1,   0)  // Head is up (set to 0,-1,0 to look upside-down)
-        );
-    auto model = glm::mat4(1.0f);
-    // Vulkan clip space has inverted Y and half Z.
-    auto clip = glm::mat4(1.0f, 0.0f, 0.0f, 0.0f,
-        0.0f, -1.0f, 0.0f, 0.0f,
-        0.0f, 0.0f, 0.5f, 0.0f,
-        0.0f, 0.0f, 0.5f, 1.0f);
-
-    MVP = clip * projection * view * model;
-}
-
-void ZVK_Application::allocate_UniformMemory()
-{
-    vk::BufferCreateInfo buf_info{};
-    buf_info.pNext = nullptr;
-    buf_info.usage = vk::BufferUsageFlagBits::eUniformBuffer;
-    buf_info.size = sizeof(MVP);
-    buf_info.queueFamilyIndexCount = 0;
-    buf_info.pQueueFamilyIndices = nullptr;
-    buf_info.sharingMode = vk::SharingMode::eExclusive;
-
-    uniform_buffer = logical_device.createBuffer(buf_info);
-    if (!uniform_buffer)
+    camera.set_Extent(window.width(), window.height());
+    if (!camera.update())
     {
-        throw std::domain_error{ "Uniform Buffer cannot be created" };
+        return;
     }
 
-    vk::MemoryRequirements mem_reqs = logical_device.getBufferMemoryRequirements(uniform_buffer);
-    uniform_buffer_memory_size = mem_reqs.size;
+    view_projection = camera.get_ViewProjection();
+    MVP = view_projection * mesh_fit * position_dequantization;
+    pixels_per_unit = camera.get_PixelsPerUnit();
+}
 
-    vk::MemoryPropertyFlags requirements_mask;
-    uniform_buffer_memory = logical_device.allocateMemory(get_AllocateInfo(mem_reqs, requirements_mask | vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent));
-	if (!uniform_buffer_memory)
-    {
-        throw std::domain_error{ "Uniform Buffer Memory cannot be allocated" };
-    }
+void ZVK_Application::write_Uniforms()
+{
+    // The previous frame was waited for, its slice is free again.
+    memcpy(uniform_stream->begin_Frame(frame_index), &MVP, sizeof(MVP));
 }
 
-void ZVK_Application::fill_UniformMemory()
+bool ZVK_Application::create_Texture()
 {
-    uint8_t *pData = (uint8_t*)(logical_device.mapMemory(uniform_buffer_memory, 0, uniform_buffer_memory_size));
-    if (!pData)
+    Z_StartupReport::scoped_timer timer{ startup_report, "create_Texture" };
+
+    if (textured_cube != scene)
     {
-        throw std::domain_error{ "Uniform Buffer Memory cannot be mapped" };
+        return true;
     }
 
-    memcpy(pData, &MVP, sizeof(MVP));
+    sampler_cache.reset(new ZVK_SamplerCache(logical_device));
+    mip_generator.reset(new ZVK_MipGenerator(logical_device, gpus[0], has_storage_write_without_format));
+    texture_uploader.reset(new ZVK_TextureUploader(logical_device, gpus[0], device_queue_info.queueFamilyIndex, mip_generator.get()));
+
+    /* A generated checkerboard, so the scene needs no image files */
+    const uint32_t texture_size = 256;
+    const uint32_t cell_size = 32;
+    std::vector<uint32_t> pixels(texture_size * texture_size);
+    for (uint32_t y = 0; y < texture_size; ++y)
+    {
+        for (uint32_t x = 0; x < texture_size; ++x)
+        {
+            bool light = ((x / cell_size) + (y / cell_size)) % 2 == 0;
+            pixels[y * texture_size + x] = light ? 0xFFE0E0E0 : 0xFF8C3A1E;
+        }
+    }
 
-    logical_device.unmapMemory(uniform_buffer_memory);
+    texture = texture_uploader->upload(pixels.data(), pixels.size() * sizeof(pixels[0]),
+        vk::Extent2D{ texture_size, texture_size }, vk::Format::eR8G8B8A8Unorm, true);
+
+    vk::SamplerCreateInfo sampler_info{};
+    sampler_info.magFilter = vk::Filter::eLinear;
+    sampler_info.minFilter = vk::Filter::eLinear;
+    sampler_info.mipmapMode = vk::SamplerMipmapMode::eLinear;
+    sampler_info.addressModeU = vk::SamplerAddressMode::eRepeat;
+    sampler_info.addressModeV = vk::SamplerAddressMode::eRepeat;
+    sampler_info.addressModeW = vk::SamplerAddressMode::eRepeat;
+    sampler_info.maxAnisotropy = 1.0f;
+    sampler_info.compareOp = vk::CompareOp::eNever;
+    sampler_info.maxLod = static_cast<float>(texture.mip_levels);
+    sampler_info.borderColor = vk::BorderColor::eFloatOpaqueWhite;
+    texture_sampler = sampler_cache->get(sampler_info);
+
+    return texture.view && texture_sampler;
+}
 
-    logical_device.bindBufferMemory(uniform_buffer, uniform_buffer_memory, 0);
+ZVK_TextureUploader::statistics ZVK_Application::get_TextureUploadStatistics() const
+{
+    return texture_uploader ? texture_uploader->get_Statistics() : ZVK_TextureUploader::statistics{};
 }
 
 bool ZVK_Application::create_DescriptorSetLayout()
 {
-    /* Note that when we start using textures, this is where our sampler will
-    * need to be specified
-    */
+    Z_StartupReport::scoped_timer timer{ startup_report, "create_DescriptorSetLayout" };
+
+    if (use_bindless)
+    {
+        /* All resources are reached through the one bindless table */
+        bindless_table.reset(new ZVK_BindlessTable(logical_device, gpus[0].getProperties().limits));
+        return true;
+    }
+
+    /* Binding 0 is the MVP, the textured cube adds its sampler at binding 1 */
 	vk::DescriptorSetLayoutBinding layout_binding{};
 	layout_binding.binding = 0;
 	layout_binding.descriptorType = vk::DescriptorType::eUniformBuffer;
 	layout_binding.descriptorCount = 1;
 	layout_binding.stageFlags = vk::ShaderStageFlagBits::eVertex;
 	layout_binding.pImmutableSamplers = nullptr;
+	descriptor_layout_bindings.push_back(layout_binding);
+
+	if (textured_cube == scene)
+	{
+		layout_binding.binding = 1;
+		layout_binding.descriptorType = vk::DescriptorType::eCombinedImageSampler;
+		layout_binding.stageFlags = vk::ShaderStageFlagBits::eFragment;
+		descriptor_layout_bindings.push_back(layout_binding);
+	}
 
     /* Next take layout bindings and use them to create a descriptor set layout
     */
     vk::DescriptorSetLayoutCreateInfo descriptor_layout_info{};
     descriptor_layout_info.setSType(vk::StructureType::eDescriptorSetLayoutCreateInfo);
     descriptor_layout_info.pNext = nullptr;
-    descriptor_layout_info.bindingCount = 1;
-    descriptor_layout_info.pBindings = &layout_binding;
+    descriptor_layout_info.bindingCount = uint32_t( descriptor_layout_bindings.size() );
+    descriptor_layout_info.pBindings = descriptor_layout_bindings.data();
+
+    descriptor_layouts.push_back(own(logical_device->createDescriptorSetLayout(descriptor_layout_info)));
 
-    descriptor_layouts.push_back(logical_device.createDescriptorSetLayout(descriptor_layout_info));
+    /* The update template is generated from the same bindings */
+    if (descriptor_layouts.back())
+    {
+        descriptor_template.reset(new ZVK_DescriptorUpdateTemplate(logical_device,
+            descriptor_layouts.back(), descriptor_layout_bindings, has_update_template_ext));
+    }
     return descriptor_layouts[descriptor_layouts.size()-1] ? true : false;
 }
 
 bool ZVK_Application::create_PipelineLayout()
 {
+    Z_StartupReport::scoped_timer timer{ startup_report, "create_PipelineLayout" };
+
     /* Now use the descriptor layout to create a pipeline layout */
     vk::PipelineLayoutCreateInfo pipeline_layout_info{};
     pipeline_layout_info.pNext = nullptr;
     pipeline_layout_info.pushConstantRangeCount = 0;
     pipeline_layout_info.pPushConstantRanges = nullptr;
-    pipeline_layout_info.setLayoutCount = uint32_t( descriptor_layouts.size() );
-    pipeline_layout_info.pSetLayouts = descriptor_layouts.data();
+    std::vector<vk::DescriptorSetLayout> set_layouts(descriptor_layouts.begin(), descriptor_layouts.end());
+    pipeline_layout_info.setLayoutCount = uint32_t( set_layouts.size() );
+    pipeline_layout_info.pSetLayouts = set_layouts.data();
+
+    /* In bindless mode every draw pushes the index of its object */
+    vk::DescriptorSetLayout bindless_layout{};
+    vk::PushConstantRange draw_index_range{ vk::ShaderStageFlagBits::eVertex, 0, sizeof(uint32_t) };
+    if (use_bindless)
+    {
+        bindless_layout = bindless_table->get_Layout();
+        pipeline_layout_info.setLayoutCount = 1;
+        pipeline_layout_info.pSetLayouts = &bindless_layout;
+        pipeline_layout_info.pushConstantRangeCount = 1;
+        pipeline_layout_info.pPushConstantRanges = &draw_index_range;
+    }
 
-    pipeline_layout = logical_device.createPipelineLayout(pipeline_layout_info);
+    pipeline_layout = own(logical_device->createPipelineLayout(pipeline_layout_info));
 
     return pipeline_layout ? true : false;
 }
 
 bool ZVK_Application::allocate_DescriptorSets()
 {
-    vk::DescriptorPoolSize type_count;
-    type_count.type = vk::DescriptorType::eUniformBuffer;
-    type_count.descriptorCount = 1;
-
-    vk::DescriptorPoolCreateInfo desc_pool_info{};
-    desc_pool_info.setSType(vk::StructureType::eDescriptorPoolCreateInfo);
-    desc_pool_info.pNext = nullptr;
-    desc_pool_info.maxSets = 1;
-    desc_pool_info.poolSizeCount = 1;
-    desc_pool_info.pPoolSizes = &type_count;
+    Z_StartupReport::scoped_timer timer{ startup_report, "allocate_DescriptorSets" };
 
-    desc_pool = logical_device.createDescriptorPool(desc_pool_info);
+    descriptor_allocator.reset(new ZVK_DescriptorAllocator(logical_device));
 
-    if (!desc_pool)
+    /* Sets are allocated by the cache on the first request of a */
+    /* layout and resources combination.                          */
+    descriptor_cache.reset(new ZVK_DescriptorCache(logical_device, *descriptor_allocator));
+    if (descriptor_template && descriptor_layouts.size())
     {
-        throw std::domain_error{ "DescriptorPool was not created" };
+        descriptor_cache->set_Template(descriptor_layouts[0], descriptor_template.get());
     }
 
-    vk::DescriptorSetAllocateInfo alloc_info[1];
-    alloc_info[0].pNext = nullptr;
-    alloc_info[0].descriptorPool = desc_pool;
-    alloc_info[0].descriptorSetCount = uint32_t( descriptor_layouts.size() );
-    alloc_info[0].pSetLayouts = descriptor_layouts.data();
-
-    descriptor_sets = logical_device.allocateDescriptorSets(alloc_info[0]);
+    return true;
+}
 
-    if (!descriptor_sets.size())
+std::vector<ZVK_DescriptorCache::resource> ZVK_Application::get_ObjectResources() const
+{
+    std::vector<ZVK_DescriptorCache::resource> resources{
+        ZVK_DescriptorCache::resource::buffer(0, vk::DescriptorType::eUniformBuffer,
+            uniform_stream->get_Buffer(), uniform_stream->get_Offset(), sizeof(MVP)) };
+    if (textured_cube == scene)
     {
-        throw std::domain_error{ "Descriptor Sets was not allocated" };
+        resources.push_back(ZVK_DescriptorCache::resource::image(1, vk::DescriptorType::eCombinedImageSampler,
+            texture_sampler, texture.view, vk::ImageLayout::eShaderReadOnlyOptimal));
     }
+    return resources;
+}
 
-    return true;
+ZVK_DescriptorCache::statistics ZVK_Application::get_DescriptorCacheStatistics() const
+{
+    return descriptor_cache ? descriptor_cache->get_Statistics() : ZVK_DescriptorCache::statistics{};
 }
 
 void ZVK_Application::update_DescriptorSets()
 {
-	vk::DescriptorBufferInfo buffer_info{ uniform_buffer, 0, sizeof(MVP) };
+	Z_StartupReport::scoped_timer timer{ startup_report, "update_DescriptorSets" };
 
-    vk::WriteDescriptorSet writes;
-    writes.pNext = nullptr;
-    writes.dstSet = descriptor_sets[0];
-    writes.descriptorCount = 1;
-    writes.descriptorType = vk::DescriptorType::eUniformBuffer;
-    writes.pBufferInfo = &buffer_info;
-    writes.dstArrayElement = 0;
-    writes.dstBinding = 0;
+	if (use_bindless)
+	{
+		// Frames push the entry of their own slice.
+		object_indices.clear();
+		for (uint32_t slice = 0; slice < uniform_stream->get_SlicesQty(); ++slice)
+		{
+			object_indices.push_back(bindless_table->add_Buffer(uniform_stream->get_Buffer(), uniform_stream->get_SliceOffset(slice), sizeof(MVP)));
+		}
+		return;
+	}
 
-    logical_device.updateDescriptorSets(1, &writes, 0, nullptr);
+	descriptor_sets.assign(1, descriptor_cache->get(descriptor_layouts[0], get_ObjectResources()));
 }
 
 bool ZVK_Application::create_RenderPass()
 {
+    Z_StartupReport::scoped_timer timer{ startup_report, "create_RenderPass" };
+
+    if (!render_pass_cache)
+    {
+        render_pass_cache.reset(new ZVK_RenderPassCache(logical_device));
+    }
+
     /* Need attachments for render target and depth buffer */
-    vk::AttachmentDescription attachments[2]{};
-    attachments[0].format = surface_format.format;
-    attachments[0].samples = num_samples;
-    attachments[0].loadOp = vk::AttachmentLoadOp::eClear;
-    attachments[0].storeOp = vk::AttachmentStoreOp::eStore;
-    attachments[0].stencilLoadOp = vk::AttachmentLoadOp::eDontCare;
-    attachments[0].stencilStoreOp = vk::AttachmentStoreOp::eDontCare;
-	attachments[0].initialLayout = vk::ImageLayout::eUndefined;
-    attachments[0].finalLayout = vk::ImageLayout::ePresentSrcKHR;
-
-    attachments[1].format = depth_format;
-    attachments[1].samples = num_samples;
-    attachments[1].loadOp = vk::AttachmentLoadOp::eClear;
-    attachments[1].storeOp = vk::AttachmentStoreOp::eStore;
-    attachments[1].stencilLoadOp = vk::AttachmentLoadOp::eLoad;
-    attachments[1].stencilStoreOp = vk::AttachmentStoreOp::eStore;
-	attachments[1].initialLayout = vk::ImageLayout::eUndefined;
-    attachments[1].finalLayout = vk::ImageLayout::eDepthStencilAttachmentOptimal;
-
-    vk::AttachmentReference color_reference{};
-    color_reference.attachment = 0;
-    color_reference.layout = vk::ImageLayout::eColorAttachmentOptimal;
-
-    vk::AttachmentReference depth_reference{};
-    depth_reference.attachment = 1;
-    depth_reference.layout = vk::ImageLayout::eDepthStencilAttachmentOptimal;
-
-    vk::SubpassDescription subpass{};
-    subpass.colorAttachmentCount = 1;
-    subpass.pColorAttachments = &color_reference;
-    subpass.pDepthStencilAttachment = &depth_reference;
-
-    vk::RenderPassCreateInfo rp_info{};
-    rp_info.attachmentCount = 2;
-    rp_info.pAttachments = attachments;
-    rp_info.subpassCount = 1;
-    rp_info.pSubpasses = &subpass;
-
-    render_pass = logical_device.createRenderPass(rp_info);
+    ZVK_RenderPassCache::signature signature{};
+    signature.colors.resize(1);
+    signature.colors[0].format = surface_format.format;
+    signature.colors[0].samples = num_samples;
+    signature.colors[0].load_op = vk::AttachmentLoadOp::eClear;
+    signature.colors[0].store_op = vk::AttachmentStoreOp::eStore;
+    signature.colors[0].stencil_load_op = vk::AttachmentLoadOp::eDontCare;
+    signature.colors[0].stencil_store_op = vk::AttachmentStoreOp::eDontCare;
+    signature.colors[0].initial_layout = vk::ImageLayout::eUndefined;
+    signature.colors[0].final_layout = vk::ImageLayout::ePresentSrcKHR;
+
+    signature.has_depth = true;
+    signature.depth.format = depth_format;
+    signature.depth.samples = num_samples;
+    signature.depth.load_op = vk::AttachmentLoadOp::eClear;
+    signature.depth.store_op = vk::AttachmentStoreOp::eStore;
+    signature.depth.stencil_load_op = vk::AttachmentLoadOp::eLoad;
+    signature.depth.stencil_store_op = vk::AttachmentStoreOp::eStore;
+    signature.depth.initial_layout = vk::ImageLayout::eUndefined;
+    signature.depth.final_layout = vk::ImageLayout::eDepthStencilAttachmentOptimal;
+
+    render_pass = render_pass_cache->get(signature);
 
     return render_pass ? true : false;
 }
 
 bool ZVK_Application::create_Shaders()
 {
+	Z_StartupReport::scoped_timer timer{ startup_report, "create_Shaders" };
+
+	if (textured_cube == scene)
+	{
+		return
+			(instancing
+				? create_shader_module(vert_stage, vert_texture_instanced_spir_v, sizeof(vert_texture_instanced_spir_v))
+				: create_shader_module(vert_stage, vert_texture_spir_v, sizeof(vert_texture_spir_v)))
+			&& create_shader_module(frag_stage, frag_texture_spir_v, sizeof(frag_texture_spir_v));
+	}
+	if (instancing)
+	{
+		return create_shader_module(vert_stage, vert_instanced_spir_v, sizeof(vert_instanced_spir_v))
+			&& create_shader_module(frag_stage, frag_spir_v, sizeof(frag_spir_v));
+	}
+
 	return
-		create_shader_module(vert_stage, vert_spir_v, sizeof(vert_spir_v))
+		(use_bindless
+			? create_shader_module(vert_stage, vert_bindless_spir_v, sizeof(vert_bindless_spir_v))
+			: create_shader_module(vert_stage, vert_spir_v, sizeof(vert_spir_v)))
 		&& create_shader_module(frag_stage, frag_spir_v, sizeof(frag_spir_v));
 }
 
@@ -912,75 +967,123 @@ bool ZVK_Application::create_shader_module(shader_stage stage, const uint32_t* c
 	moduleCreateInfo.pCode = code;
 	moduleCreateInfo.codeSize = sz;
 
-	shaders[stage] = logical_device.createShaderModule(moduleCreateInfo);
+	shaders[stage] = own(logical_device->createShaderModule(moduleCreateInfo));
 
 	return shaders[stage] ? true : false;
 }
 
 bool ZVK_Application::create_FrameBuffers()
 {
-	clear_framebuffers();
+	Z_StartupReport::scoped_timer timer{ startup_report, "create_FrameBuffers" };
+
+	if (!framebuffer_cache)
+	{
+		framebuffer_cache.reset(new ZVK_FramebufferCache(logical_device));
+	}
+	framebuffers.clear();
 
 	/* Need attachments for render target and depth buffer */
 	std::vector<vk::ImageView> attachments(2);
 	attachments[1] = depth_image_view;
 
-	vk::FramebufferCreateInfo fb_info{};
-	fb_info.renderPass = render_pass;
-	fb_info.attachmentCount = (uint32_t)attachments.size();
-	fb_info.pAttachments = attachments.data();
-	fb_info.width = window.width();
-	fb_info.height = window.height();
-	fb_info.layers = 1;
-
-	for (auto iv : image_views)
+	for (auto& iv : image_views)
 	{
 		attachments[0] = iv;
-		framebuffers.push_back(logical_device.createFramebuffer(fb_info));
+		framebuffers.push_back(framebuffer_cache->get(render_pass, attachments, vk::Extent2D{ static_cast<uint32_t>(window.width()), static_cast<uint32_t>(window.height()) }));
 	}
 
 	return framebuffers.size() == image_views.size();
 }
 
-void ZVK_Application::clear_framebuffers()
+void ZVK_Application::retire_ImageView(ZVK_Handle<vk::ImageView>& view)
 {
-	if (framebuffers.size())
+	if (!view)
+	{
+		return;
+	}
+
+	if (framebuffer_cache)
 	{
-		for (auto f : framebuffers)
+		for (auto& f : framebuffer_cache->invalidate(view))
 		{
-			if (f)
-			{
-				logical_device.destroyFramebuffer(f);
-			}
+			retire(f);
 		}
 	}
+	retire(view);
+}
+
+bool ZVK_Application::recreate_Swapchain()
+{
+	return create_Swapchain()
+		&& create_ImageViews()
+		&& create_DepthBuffer()
+		&& create_RenderPass()
+		&& create_FrameBuffers();
 }
 
-bool ZVK_Application::create_VertexBuffer()
+bool ZVK_Application::create_VertexBuffer(Z_ThreadPool& pool)
 {
-	allocate_VertexMemory();
-	fill_VertexMemory();
+	Z_StartupReport::scoped_timer timer{ startup_report, "create_VertexBuffer" };
+
+	if (is_ImportedMesh())
+	{
+		import_Mesh(pool);
+	}
+	else if (has_MeshFile())
+	{
+		load_MeshFile();
+	}
+	else
+	{
+		/* The cubes are triangle soups, shared vertices are welded */
+		if (textured_cube == scene)
+		{
+			mesh = Z_IndexedMesh::weld(g_vb_texture_Data,
+				sizeof(g_vb_texture_Data) / sizeof(g_vb_texture_Data[0]), sizeof(g_vb_texture_Data[0]));
+		}
+		else
+		{
+			mesh = Z_IndexedMesh::weld(g_vb_solid_face_colors_Data,
+				sizeof(g_vb_solid_face_colors_Data) / sizeof(g_vb_solid_face_colors_Data[0]), sizeof(g_vb_solid_face_colors_Data[0]));
+		}
+		Z_MeshOptimizer::optimize(mesh);
+		mesh_layout = Z_MeshFile::make_Layout(cube_vertex_layout(textured_cube == scene));
+		if (Z_VertexQuantizer::position_float32 != vertex_format)
+		{
+			quantize_Vertices();
+		}
+		vertex_stride = mesh.get_VertexStride();
+
+		allocate_VertexMemory();
+		fill_VertexMemory();
+		allocate_IndexMemory();
+		fill_IndexMemory();
+	}
+
+	position_dequantization = glm::translate(glm::mat4(1.0f), glm::vec3(mesh_layout.center[0], mesh_layout.center[1], mesh_layout.center[2]))
+		* glm::scale(glm::mat4(1.0f), glm::vec3(mesh_layout.extent[0], mesh_layout.extent[1], mesh_layout.extent[2]));
 	describe_VertexData();
 
 	return true;
 }
+
 void ZVK_Application::allocate_VertexMemory()
 {
 	vk::BufferCreateInfo buf_info{};
 	buf_info.usage = vk::BufferUsageFlagBits::eVertexBuffer;
-	buf_info.size = sizeof(g_vb_solid_face_colors_Data);
+	buf_info.size = mesh.get_Vertices().size();
 
-	vertex_buffer = logical_device.createBuffer(buf_info);
+	vertex_buffer = own(logical_device->createBuffer(buf_info));
 	if (!vertex_buffer)
 	{
 		throw std::domain_error{ "Vertex Buffer cannot be created" };
 	}
 
-	vk::MemoryRequirements mem_reqs = logical_device.getBufferMemoryRequirements(vertex_buffer);
+	vk::MemoryRequirements mem_reqs = logical_device->getBufferMemoryRequirements(vertex_buffer);
 	vertex_buffer_memory_size = mem_reqs.size;
 
 	vk::MemoryPropertyFlags requirements_mask;
-	vertex_buffer_memory = logical_device.allocateMemory(get_AllocateInfo(mem_reqs, requirements_mask | vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent));
+	vertex_buffer_memory = own(logical_device->allocateMemory(get_AllocateInfo(mem_reqs, requirements_mask | vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent)));
 	if (!vertex_buffer_memory)
 	{
 		throw std::domain_error{ "Vertex Buffer Memory cannot be allocated" };
@@ -989,89 +1092,753 @@ void ZVK_Application::allocate_VertexMemory()
 
 void ZVK_Application::fill_VertexMemory()
 {
-	uint8_t *pData = (uint8_t*)(logical_device.mapMemory(vertex_buffer_memory, 0, vertex_buffer_memory_size));
+	uint8_t *pData = (uint8_t*)(logical_device->mapMemory(vertex_buffer_memory, 0, vertex_buffer_memory_size));
 	if (!pData)
 	{
 		throw std::domain_error{ "Vertex Buffer Memory cannot be mapped" };
 	}
 
-	memcpy(pData, &g_vb_solid_face_colors_Data, sizeof(g_vb_solid_face_colors_Data));
+	memcpy(pData, mesh.get_Vertices().data(), mesh.get_Vertices().size());
 
-	logical_device.unmapMemory(vertex_buffer_memory);
+	logical_device->unmapMemory(vertex_buffer_memory);
 
-	logical_device.bindBufferMemory(vertex_buffer, vertex_buffer_memory, 0);
+	logical_device->bindBufferMemory(vertex_buffer, vertex_buffer_memory, 0);
 }
 
-void ZVK_Application::describe_VertexData()
+void ZVK_Application::quantize_Vertices()
 {
-	vi_binding.binding = 0;
-	vi_binding.stride = sizeof(g_vb_solid_face_colors_Data[0]);
+	const bool textured = textured_cube == scene;
+	const vk::Format formats[] = {
+		Z_VertexQuantizer::position_half == vertex_format ? vk::Format::eR16G16B16A16Sfloat : vk::Format::eR16G16B16A16Snorm,
+		textured ? vk::Format::eR16G16Sfloat : vk::Format::eR8G8B8A8Unorm };
+	for (auto f : formats)
+	{
+		if (!(gpus[0].getFormatProperties(f).bufferFeatures & vk::FormatFeatureFlagBits::eVertexBuffer))
+		{
+			vertex_format = Z_VertexQuantizer::position_float32;
+			return;
+		}
+	}
 
-	vi_attribs[0].binding = 0;
-	vi_attribs[0].location = 0;
-	vi_attribs[0].format = vk::Format::eR32G32B32A32Sfloat;
-	vi_attribs[0].offset = 0;
-	vi_attribs[1].binding = 0;
-	vi_attribs[1].location = 1;
-	vi_attribs[1].format = vk::Format::eR32G32B32A32Sfloat;
-	vi_attribs[1].offset = 16;
+	Z_VertexQuantizer quantizer(cube_vertex_layout(textured), vertex_format);
+	Z_IndexedMesh packed = quantizer.quantize(mesh);
+	vertex_quantization = quantizer.measure_Error(mesh.get_Vertices().data(), packed.get_Vertices().data(), mesh.get_VerticesQty());
+	mesh_layout = Z_MeshFile::make_Layout(quantizer);
+
+	mesh = std::move(packed);
 }
 
-bool ZVK_Application::init_pipeline_cache()
+void ZVK_Application::load_MeshFile()
 {
-	vk::PipelineCacheCreateInfo info{};
-	pipeline_cache = logical_device.createPipelineCache(info);
+	// Mapping reads only the mesh table, the blobs of other meshes stay on disk.
+	Z_MeshFile file(mesh_file_path);
+	const size_t index = mesh_file_name.empty() ? 0 : file.find(mesh_file_name);
+	if (index >= file.get_MeshesQty())
+	{
+		throw std::domain_error{ "Mesh " + mesh_file_name + " is not found in " + mesh_file_path };
+	}
 
-	return pipeline_cache ? true : false;
+	const Z_MeshFile::mesh_entry& entry = file.get_Entry(index);
+	mesh_layout = entry.layout;
+	vertex_stride = entry.layout.stride;
+	index_type = 2 == entry.index_size ? vk::IndexType::eUint16 : vk::IndexType::eUint32;
+	indices_qty = entry.indices_qty;
+	mesh_parts.assign(1, mesh_part{ 0, indices_qty, 0 });
+
+	if (!buffer_uploader)
+	{
+		buffer_uploader.reset(new ZVK_BufferUploader(logical_device, gpus[0], device_queue_info.queueFamilyIndex));
+	}
+	vertex_buffer = buffer_uploader->create_Buffer(entry.vertices_size, vk::BufferUsageFlagBits::eVertexBuffer, vertex_buffer_memory);
+	index_buffer = buffer_uploader->create_Buffer(entry.indices_size, vk::BufferUsageFlagBits::eIndexBuffer, index_buffer_memory);
+	buffer_uploader->upload(vertex_buffer, 0, file.get_Vertices(index), entry.vertices_size);
+	buffer_uploader->upload(index_buffer, 0, file.get_Indices(index), entry.indices_size);
+
+	// The levels follow each other in the blob, the ones used are its beginning.
+	mesh_lods.clear();
+	const uint32_t lods_qty = static_cast<uint32_t>(std::min<size_t>(lods_requested, entry.lods_qty));
+	for (uint32_t l = 0; l < lods_qty; ++l)
+	{
+		const Z_MeshFile::lod_level& level = entry.lods[l];
+		mesh_lods.push_back(mesh_lod{ level.error, std::vector<mesh_part>(1, mesh_part{ level.first_index, level.indices_qty, 0 }) });
+	}
+	if (lods_qty)
+	{
+		const Z_MeshFile::lod_level& last = entry.lods[lods_qty - 1];
+		const vk::DeviceSize lods_size = static_cast<vk::DeviceSize>(last.first_index + last.indices_qty) * entry.index_size;
+		lod_index_buffer = buffer_uploader->create_Buffer(lods_size, vk::BufferUsageFlagBits::eIndexBuffer, lod_index_buffer_memory);
+		buffer_uploader->upload(lod_index_buffer, 0, file.get_LodIndices(index), lods_size);
+	}
+	buffer_uploader->flush();
 }
 
-bool ZVK_Application::create_GraphicsPipeline()
+bool ZVK_Application::is_ImportedMesh() const
 {
-	std::array<vk::DynamicState, VK_DYNAMIC_STATE_RANGE_SIZE> dynamic_state_enables{};
-	vk::PipelineDynamicStateCreateInfo dynamic_state_info{};
-	dynamic_state_info.pDynamicStates = dynamic_state_enables.data();
+	const size_t dot = mesh_file_path.find_last_of('.');
+	if (std::string::npos == dot)
+	{
+		return false;
+	}
+	std::string extension = mesh_file_path.substr(dot);
+	std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+	return ".obj" == extension || ".gltf" == extension;
+}
 
-	vk::PipelineVertexInputStateCreateInfo vertex_input_state_info{};
-	vertex_input_state_info.vertexBindingDescriptionCount = 1;
-	vertex_input_state_info.pVertexBindingDescriptions = &vi_binding;
-	vertex_input_state_info.vertexAttributeDescriptionCount = 2;
-	vertex_input_state_info.pVertexAttributeDescriptions = vi_attribs;
+void ZVK_Application::import_Mesh(Z_ThreadPool& pool)
+{
+	const Z_VertexQuantizer::source_layout layout = cube_vertex_layout(textured_cube == scene);
+	mesh_layout = Z_MeshFile::make_Layout(layout);
+	vertex_stride = layout.stride;
+
+	Z_MeshImporter importer(layout, pool);
+	importer.open(mesh_file_path);
+	index_type = importer.fits_16bit_indices() ? vk::IndexType::eUint16 : vk::IndexType::eUint32;
+	const vk::DeviceSize index_size = vk::IndexType::eUint16 == index_type ? sizeof(uint16_t) : sizeof(uint32_t);
+
+	// Sized for the worst case, parts are streamed in as they are built.
+	const vk::DeviceSize vertices_size = std::max<vk::DeviceSize>(importer.get_MaxVerticesQty() * layout.stride, layout.stride);
+	const vk::DeviceSize indices_size = std::max<vk::DeviceSize>(importer.get_MaxIndicesQty() * index_size, index_size);
+	if (!buffer_uploader)
+	{
+		buffer_uploader.reset(new ZVK_BufferUploader(logical_device, gpus[0], device_queue_info.queueFamilyIndex));
+	}
+	vertex_buffer = buffer_uploader->create_Buffer(vertices_size, vk::BufferUsageFlagBits::eVertexBuffer, vertex_buffer_memory);
+	index_buffer = buffer_uploader->create_Buffer(indices_size, vk::BufferUsageFlagBits::eIndexBuffer, index_buffer_memory);
+
+	mesh_parts.clear();
+	std::vector<Z_IndexedMesh> part_positions;
+	vk::DeviceSize vertices_offset = 0;
+	uint32_t first_index = 0;
+	importer.build([&](const Z_IndexedMesh& part)
+	{
+		if (lods_requested)
+		{
+			std::vector<uint8_t> positions(part.get_VerticesQty() * 3 * sizeof(float));
+			for (size_t v = 0; v < part.get_VerticesQty(); ++v)
+			{
+				memcpy(&positions[v * 3 * sizeof(float)], part.get_Vertices().data() + v * layout.stride + layout.position, 3 * sizeof(float));
+			}
+			part_positions.push_back(Z_IndexedMesh(std::move(positions), 3 * sizeof(float), part.get_Indices()));
+		}
+		buffer_uploader->upload(vertex_buffer, vertices_offset, part.get_Vertices().data(), part.get_Vertices().size());
+		upload_Indices(index_buffer, first_index, part.get_Indices());
+		mesh_parts.push_back(mesh_part{ first_index, static_cast<uint32_t>(part.get_IndicesQty()), static_cast<int32_t>(vertices_offset / layout.stride) });
+		vertices_offset += part.get_Vertices().size();
+		first_index += static_cast<uint32_t>(part.get_IndicesQty());
+	});
+	if (lods_requested)
+	{
+		simplify_Mesh(part_positions, pool);
+	}
+	buffer_uploader->flush();
+	indices_qty = first_index;
+	mesh_import = importer.get_Statistics();
 
-	vk::PipelineInputAssemblyStateCreateInfo input_assembly_state_info{};
-	input_assembly_state_info.topology = vk::PrimitiveTopology::eTriangleList;
+	const float* lo = importer.get_BoundsMin();
+	const float* hi = importer.get_BoundsMax();
+	if (lo[0] <= hi[0])
+	{
+		const float size = std::max(hi[0] - lo[0], std::max(hi[1] - lo[1], hi[2] - lo[2]));
+		const glm::vec3 center{ 0.5f * (lo[0] + hi[0]), 0.5f * (lo[1] + hi[1]), 0.5f * (lo[2] + hi[2]) };
+		mesh_fit = glm::scale(glm::mat4(1.0f), glm::vec3(size > 0.0f ? 2.0f / size : 1.0f))
+			* glm::translate(glm::mat4(1.0f), -center);
+	}
+}
 
-	vk::PipelineRasterizationStateCreateInfo rasterization_state_info{};
-	rasterization_state_info.polygonMode = vk::PolygonMode::eFill;
-	rasterization_state_info.cullMode = vk::CullModeFlagBits::eBack;
-	rasterization_state_info.frontFace = vk::FrontFace::eClockwise;
-	rasterization_state_info.depthClampEnable = VK_TRUE;
-	rasterization_state_info.rasterizerDiscardEnable = VK_FALSE;
-	rasterization_state_info.depthBiasEnable = VK_FALSE;
-	rasterization_state_info.depthBiasConstantFactor = 0;
-	rasterization_state_info.depthBiasClamp = 0;
-	rasterization_state_info.depthBiasSlopeFactor = 0;
-	rasterization_state_info.lineWidth = 1.0f;
+void ZVK_Application::simplify_Mesh(const std::vector<Z_IndexedMesh>& positions, Z_ThreadPool& pool)
+{
+	std::vector<std::vector<Z_MeshSimplifier::level>> part_levels(positions.size());
+	pool.parallel_for(positions.size(), 1, [&](size_t begin, size_t end)
+	{
+		for (size_t p = begin; p < end; ++p)
+		{
+			part_levels[p] = Z_MeshSimplifier::generate_Lods(positions[p], 0, lods_requested);
+		}
+	});
 
-	std::array<vk::PipelineColorBlendAttachmentState, 1> att_state{};
-	att_state[0].colorWriteMask = vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG | vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA;
-	att_state[0].blendEnable = VK_FALSE;
-	att_state[0].alphaBlendOp = vk::BlendOp::eAdd;
-	att_state[0].colorBlendOp = vk::BlendOp::eAdd;
-	att_state[0].srcColorBlendFactor = vk::BlendFactor::eZero;
-	att_state[0].dstColorBlendFactor = vk::BlendFactor::eZero;
-	att_state[0].srcAlphaBlendFactor = vk::BlendFactor::eZero;
-	att_state[0].dstAlphaBlendFactor = vk::BlendFactor::eZero;
-	vk::PipelineColorBlendStateCreateInfo color_blend_state_info{};
-	color_blend_state_info.attachmentCount = 1;
-	color_blend_state_info.pAttachments = att_state.data();
-	color_blend_state_info.logicOpEnable = VK_FALSE;
-	color_blend_state_info.logicOp = vk::LogicOp::eNoOp;
-	color_blend_state_info.blendConstants[0] = 1.0f;
-	color_blend_state_info.blendConstants[1] = 1.0f;
-	color_blend_state_info.blendConstants[2] = 1.0f;
-	color_blend_state_info.blendConstants[3] = 1.0f;
+	size_t levels_qty = 0;
+	for (auto& levels : part_levels)
+	{
+		levels_qty = std::max(levels_qty, levels.size());
+	}
 
-	vk::PipelineViewportStateCreateInfo viewport_state_info{};
+	// Parts that could not be simplified as deeply repeat their coarsest
+	// level, the error of a level is the largest of its parts.
+	std::vector<uint32_t> lod_indices;
+	mesh_lods.assign(levels_qty, mesh_lod{ 0.0f, std::vector<mesh_part>() });
+	for (size_t l = 0; l < levels_qty; ++l)
+	{
+		mesh_lod& lod = mesh_lods[l];
+		for (size_t p = 0; p < positions.size(); ++p)
+		{
+			const std::vector<Z_MeshSimplifier::level>& levels = part_levels[p];
+			const Z_MeshSimplifier::level* level = levels.empty() ? nullptr : &levels[std::min(l, levels.size() - 1)];
+			const std::vector<uint32_t>& indices = level ? level->indices : positions[p].get_Indices();
+			if (level)
+			{
+				lod.error = std::max(lod.error, level->error);
+			}
+			lod.parts.push_back(mesh_part{ static_cast<uint32_t>(lod_indices.size()), static_cast<uint32_t>(indices.size()), mesh_parts[p].vertex_offset });
+			lod_indices.insert(lod_indices.end(), indices.begin(), indices.end());
+		}
+	}
+
+	if (levels_qty)
+	{
+		const vk::DeviceSize lods_size = lod_indices.size() * (vk::IndexType::eUint16 == index_type ? sizeof(uint16_t) : sizeof(uint32_t));
+		lod_index_buffer = buffer_uploader->create_Buffer(lods_size, vk::BufferUsageFlagBits::eIndexBuffer, lod_index_buffer_memory);
+		upload_Indices(lod_index_buffer, 0, lod_indices);
+	}
+}
+
+void ZVK_Application::upload_Indices(vk::Buffer buffer, uint32_t first_index, const std::vector<uint32_t>& indices)
+{
+	if (vk::IndexType::eUint16 == index_type)
+	{
+		const std::vector<uint16_t> packed(indices.begin(), indices.end());
+		buffer_uploader->upload(buffer, first_index * sizeof(uint16_t), packed.data(), packed.size() * sizeof(uint16_t));
+	}
+	else
+	{
+		buffer_uploader->upload(buffer, first_index * sizeof(uint32_t), indices.data(), indices.size() * sizeof(uint32_t));
+	}
+}
+
+ZVK_BufferUploader::statistics ZVK_Application::get_BufferUploadStatistics() const
+{
+	return buffer_uploader ? buffer_uploader->get_Statistics() : ZVK_BufferUploader::statistics{};
+}
+
+void ZVK_Application::allocate_IndexMemory()
+{
+	index_type = mesh.fits_16bit_indices() ? vk::IndexType::eUint16 : vk::IndexType::eUint32;
+	indices_qty = static_cast<uint32_t>(mesh.get_IndicesQty());
+	mesh_parts.assign(1, mesh_part{ 0, indices_qty, 0 });
+
+	vk::BufferCreateInfo buf_info{};
+	buf_info.usage = vk::BufferUsageFlagBits::eIndexBuffer;
+	buf_info.size = mesh.get_IndicesQty() * mesh.get_IndexSize();
+
+	index_buffer = own(logical_device->createBuffer(buf_info));
+	if (!index_buffer)
+	{
+		throw std::domain_error{ "Index Buffer cannot be created" };
+	}
+
+	vk::MemoryRequirements mem_reqs = logical_device->getBufferMemoryRequirements(index_buffer);
+	index_buffer_memory_size = mem_reqs.size;
+
+	vk::MemoryPropertyFlags requirements_mask;
+	index_buffer_memory = own(logical_device->allocateMemory(get_AllocateInfo(mem_reqs, requirements_mask | vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent)));
+	if (!index_buffer_memory)
+	{
+		throw std::domain_error{ "Index Buffer Memory cannot be allocated" };
+	}
+}
+
+void ZVK_Application::fill_IndexMemory()
+{
+	uint8_t *pData = (uint8_t*)(logical_device->mapMemory(index_buffer_memory, 0, index_buffer_memory_size));
+	if (!pData)
+	{
+		throw std::domain_error{ "Index Buffer Memory cannot be mapped" };
+	}
+
+	std::vector<uint8_t> indices = mesh.get_PackedIndices();
+	memcpy(pData, indices.data(), indices.size());
+
+	logical_device->unmapMemory(index_buffer_memory);
+
+	logical_device->bindBufferMemory(index_buffer, index_buffer_memory, 0);
+}
+
+void ZVK_Application::describe_VertexData()
+{
+	vi_bindings[0].binding = 0;
+	vi_bindings[0].stride = vertex_stride;
+	vi_bindings[0].inputRate = vk::VertexInputRate::eVertex;
+	vi_bindings_qty = 1;
+	vi_attribs_qty = 2;
+
+	// Either a color or texture coordinates follow the position. Packed
+	// attributes are decoded by the vertex fetch into the same shader
+	// inputs, snorm16 positions then go through the dequantizing MVP.
+	const Z_MeshFile::attribute_slot slots[] = { Z_MeshFile::slot_position,
+		textured_cube == scene ? Z_MeshFile::slot_uv : Z_MeshFile::slot_color };
+	for (uint32_t i = 0; i < 2; ++i)
+	{
+		const Z_MeshFile::vertex_attribute& attribute = mesh_layout.attributes[slots[i]];
+		vi_attribs[i].binding = 0;
+		vi_attribs[i].location = i;
+		vi_attribs[i].format = to_vertex_format(static_cast<Z_MeshFile::attribute_format>(attribute.format));
+		vi_attribs[i].offset = attribute.offset;
+		if (!(gpus[0].getFormatProperties(vi_attribs[i].format).bufferFeatures & vk::FormatFeatureFlagBits::eVertexBuffer))
+		{
+			throw std::domain_error{ "The mesh vertex format cannot be fetched by the device" };
+		}
+	}
+
+	if (!instancing)
+	{
+		return;
+	}
+
+	// A mat4 input takes four locations, one per column.
+	vi_bindings[1].binding = 1;
+	vi_bindings[1].stride = sizeof(instance_data);
+	vi_bindings[1].inputRate = vk::VertexInputRate::eInstance;
+	vi_bindings_qty = 2;
+	for (uint32_t column = 0; column < 4; ++column)
+	{
+		vk::VertexInputAttributeDescription& a = vi_attribs[vi_attribs_qty++];
+		a.binding = 1;
+		a.location = 2 + column;
+		a.format = vk::Format::eR32G32B32A32Sfloat;
+		a.offset = static_cast<uint32_t>(offsetof(instance_data, mvp) + column * sizeof(glm::vec4));
+	}
+	vk::VertexInputAttributeDescription& color = vi_attribs[vi_attribs_qty++];
+	color.binding = 1;
+	color.location = 6;
+	color.format = vk::Format::eR8G8B8A8Unorm;
+	color.offset = static_cast<uint32_t>(offsetof(instance_data, color));
+}
+
+static_assert(sizeof(ZVK_Application::instance_data) == 17 * sizeof(float), "Instances are fetched as 4 vec4 and 1 RGBA8");
+static_assert(sizeof(ZVK_Application::instance_data) == ZVK_InstanceCuller::visible_stride, "The culling shader writes instances as they are fetched");
+
+void ZVK_Application::set_InstancesQty(size_t qty)
+{
+	if (!instancing && logical_device)
+	{
+		throw std::domain_error{ "Instancing must be selected before create_LogicalDevice" };
+	}
+	instancing = true;
+	instances_qty = qty;
+	instances_dirty = true;
+}
+
+void ZVK_Application::layout_Instances()
+{
+	// A cubic grid as large as the single cube, every instance with
+	// its own color.
+	size_t side = 1;
+	while (side * side * side < instances_qty)
+	{
+		++side;
+	}
+	const float cell = 4.0f / side;
+	// The fit of the mesh to its cell only scales and moves it, so it
+	// folds into the local transform of the instance node.
+	const glm::mat4 object = glm::scale(glm::mat4(1.0f), glm::vec3(0.35f * cell)) * mesh_fit * position_dequantization;
+	const float object_scale[3] = { object[0][0], object[1][1], object[2][2] };
+	instance_transforms = Z_TransformHierarchy();
+	grid_node = instance_transforms.add_Node();
+
+	instance_colors.resize(instances_qty);
+	instance_culler.resize(instances_qty);
+	instance_mins.resize(3 * instances_qty);
+	instance_maxs.resize(3 * instances_qty);
+	instance_bvh_built = false;
+	// The mesh fits in a cube of half size 1 before the object scale.
+	const float half_extent[3] = { 0.35f * cell, 0.35f * cell, 0.35f * cell };
+	const float radius = std::sqrt(3.0f) * half_extent[0];
+	if (mesh_lods.size())
+	{
+		std::vector<float> errors(1, 0.0f);
+		for (auto& lod : mesh_lods)
+		{
+			errors.push_back(lod.error);
+		}
+		lod_selector.set_Levels(errors);
+		lod_selector.resize(instances_qty);
+	}
+	// The level errors are in mesh units, before the fit to the cube.
+	const float error_scale = 0.35f * cell * glm::length(glm::vec3(mesh_fit[0]));
+	std::vector<ZVK_InstanceCuller::instance> gpu_instances(use_gpu_culling ? instances_qty : 0);
+	for (size_t i = 0; i < instances_qty; ++i)
+	{
+		const glm::vec3 center{
+			-2.0f + cell * (0.5f + i % side),
+			-2.0f + cell * (0.5f + i / side % side),
+			-2.0f + cell * (0.5f + i / (side * side)) };
+		const uint32_t node = instance_transforms.add_Node(grid_node);
+		const glm::vec3 translation = center + glm::vec3(object[3]);
+		instance_transforms.set_Translation(node, &translation[0]);
+		instance_transforms.set_Scale(node, object_scale);
+		instance_culler.set_Bounds(i, &center[0], half_extent);
+		for (int a = 0; a < 3; ++a)
+		{
+			instance_mins[3 * i + a] = center[a] - half_extent[a];
+			instance_maxs[3 * i + a] = center[a] + half_extent[a];
+		}
+		if (mesh_lods.size())
+		{
+			lod_selector.set_Object(i, &center[0], radius, error_scale);
+		}
+		const uint32_t hash = static_cast<uint32_t>(i + 1) * 2654435761u;
+		instance_colors[i] = 0xFF000000u | (hash >> 8) | 0x00404040u;
+		if (use_gpu_culling)
+		{
+			auto& instance = gpu_instances[i];
+			memcpy(instance.sphere, &center[0], 3 * sizeof(float));
+			instance.sphere[3] = radius;
+			memcpy(instance.half_extent, half_extent, sizeof(instance.half_extent));
+			instance.color = instance_colors[i];
+		}
+	}
+
+	instance_transforms.update(&get_FrameJobs());
+
+	if (use_gpu_culling)
+	{
+		const float* models = get_InstanceModels();
+		for (size_t i = 0; i < instances_qty; ++i)
+		{
+			memcpy(gpu_instances[i].model, models + 16 * i, sizeof(gpu_instances[i].model));
+		}
+		if (!gpu_culler)
+		{
+			gpu_culler.reset(new ZVK_InstanceCuller(logical_device, gpus[0]));
+		}
+		if (!buffer_uploader)
+		{
+			buffer_uploader.reset(new ZVK_BufferUploader(logical_device, gpus[0], device_queue_info.queueFamilyIndex));
+		}
+		gpu_culler->set_Instances(*buffer_uploader, gpu_instances);
+	}
+
+	instances_dirty = false;
+}
+
+const float* ZVK_Application::get_InstanceModels() const
+{
+	return instances_qty ? instance_transforms.get_Worlds() + 16 * static_cast<size_t>(instance_transforms.get_Slot(grid_node + 1)) : nullptr;
+}
+
+void ZVK_Application::build_InstanceBvh()
+{
+	if (instance_bvh_built)
+	{
+		return;
+	}
+	instance_bvh.build(instance_mins.data(), instance_maxs.data(), instances_qty, &get_FrameJobs());
+	instance_bvh_built = true;
+	std::vector<float>().swap(instance_mins);
+	std::vector<float>().swap(instance_maxs);
+}
+
+Z_JobSystem& ZVK_Application::get_FrameJobs()
+{
+	if (!frame_jobs)
+	{
+		frame_jobs.reset(new Z_JobSystem);
+	}
+	return *frame_jobs;
+}
+
+uint32_t ZVK_Application::pick_Instance(float x, float y)
+{
+	if (!instancing || !instances_qty)
+	{
+		return Z_Bvh::no_object;
+	}
+	if (instances_dirty)
+	{
+		layout_Instances();
+	}
+	build_InstanceBvh();
+
+	// The ray runs from the eye to the point on the far plane, Vulkan
+	// clip space has y down and z from 0 to 1.
+	set_view();
+	const glm::vec4 point{ 2.0f * x - 1.0f, 2.0f * y - 1.0f, 1.0f, 1.0f };
+	const glm::vec4 far_point = glm::inverse(view_projection) * point;
+	const glm::vec3 origin = camera.get_Eye();
+	const glm::vec3 direction = glm::vec3(far_point) / far_point.w - origin;
+	return instance_bvh.cast_Ray(&origin[0], &direction[0], 1.0f).object;
+}
+
+size_t ZVK_Application::get_VisibleInstancesQty() const
+{
+	if (use_gpu_culling)
+	{
+		return gpu_visible_instances;
+	}
+	return culling ? visible_instances.size() : instances_qty;
+}
+
+void ZVK_Application::write_Instances()
+{
+	if (instances_dirty)
+	{
+		layout_Instances();
+	}
+
+	if (use_gpu_culling)
+	{
+		// The instances are on the GPU already, only the planes change.
+		instance_culler.set_Frustum(&view_projection[0][0]);
+		draw_groups.assign(1, draw_group{ 0, 0, static_cast<uint32_t>(instances_qty) });
+		return;
+	}
+
+	// The previous frame was waited for, so the stream may be reallocated.
+	const vk::DeviceSize size = std::max<size_t>(instances_qty, 1) * sizeof(instance_data);
+	if (!instance_stream)
+	{
+		instance_stream.reset(new ZVK_StreamBuffer(logical_device, gpus[0], vk::BufferUsageFlagBits::eVertexBuffer, size));
+	}
+	instance_stream->reserve(size);
+
+	// The culling bounds don't follow the transforms, so the transforms
+	// update meanwhile; nothing to do unless one changed since the last
+	// frame. The job references the counter, it is waited for on throws.
+	Z_JobSystem& jobs = get_FrameJobs();
+	Z_JobSystem::counter transforms_updated;
+	jobs.run("transforms", [this, &jobs] { instance_transforms.update(&jobs); }, &transforms_updated);
+
+	// Instances written in the order of list, all of them without one.
+	const uint32_t* list = nullptr;
+	size_t qty = instances_qty;
+	try
+	{
+		if (culling)
+		{
+			instance_culler.set_Frustum(&view_projection[0][0]);
+			if (bvh_culling)
+			{
+				build_InstanceBvh();
+				visible_instances.clear();
+				instance_bvh.query_Frustum(instance_culler.get_Planes(), visible_instances);
+			}
+			else
+			{
+				instance_culler.cull(visible_instances, &jobs);
+			}
+		}
+		else if (mesh_lods.size())
+		{
+			// The selector takes a list of instances, here all of them.
+			visible_instances.resize(instances_qty);
+			for (size_t i = 0; i < instances_qty; ++i)
+			{
+				visible_instances[i] = static_cast<uint32_t>(i);
+			}
+		}
+
+		if (mesh_lods.size())
+		{
+			// Only the instances which survived culling get a level.
+			lod_selector.set_View(&view_projection[0][0], pixels_per_unit);
+			lod_selector.select(visible_instances.data(), visible_instances.size(), &jobs);
+			list = lod_selector.get_Ordered().data();
+			qty = lod_selector.get_Ordered().size();
+			draw_groups.clear();
+			for (uint32_t l = 0; l < lod_selector.get_LevelsQty(); ++l)
+			{
+				if (lod_selector.get_LevelQty(l))
+				{
+					draw_groups.push_back(draw_group{ l, static_cast<uint32_t>(lod_selector.get_LevelFirst(l)), static_cast<uint32_t>(lod_selector.get_LevelQty(l)) });
+				}
+			}
+		}
+		else
+		{
+			if (culling)
+			{
+				list = visible_instances.data();
+				qty = visible_instances.size();
+			}
+			draw_groups.assign(1, draw_group{ 0, 0, static_cast<uint32_t>(qty) });
+		}
+	}
+	catch (...)
+	{
+		jobs.wait(transforms_updated);
+		throw;
+	}
+	jobs.wait(transforms_updated);
+
+	// Ranges of MVPs and colors are written on the job workers, each
+	// instance once, straight into the mapped slice.
+	instance_data* instances = reinterpret_cast<instance_data*>(instance_stream->begin_Frame(frame_index));
+	const float* models = get_InstanceModels();
+	jobs.parallel_for(qty, 4096, [&](size_t begin, size_t end)
+	{
+		Z_MatrixBatch::multiply(&view_projection[0][0], models, list, begin, end, &instances[0].mvp, sizeof(instance_data));
+		for (size_t i = begin; i < end; ++i)
+		{
+			instances[i].color = instance_colors[list ? list[i] : i];
+		}
+	}, "instances");
+}
+
+std::vector<size_t> ZVK_Application::get_LevelInstancesQty() const
+{
+	std::vector<size_t> qty(mesh_lods.size() + 1, 0);
+	for (auto& group : draw_groups)
+	{
+		qty[group.level] += group.instances_qty;
+	}
+	return qty;
+}
+
+void ZVK_Application::set_LevelsOfDetail(size_t levels_qty, float max_pixels)
+{
+	if (vertex_buffer)
+	{
+		throw std::domain_error{ "Levels of detail must be selected before create_VertexBuffer" };
+	}
+	lod_selector.set_Threshold(max_pixels);
+	lods_requested = levels_qty;
+}
+
+void ZVK_Application::write_DrawCommands()
+{
+	size_t commands_qty = 0;
+	for (auto& group : draw_groups)
+	{
+		commands_qty += get_LevelParts(group.level).size();
+	}
+	const vk::DeviceSize size = std::max<vk::DeviceSize>(commands_qty, 1) * sizeof(vk::DrawIndexedIndirectCommand);
+	if (!indirect_stream)
+	{
+		// The culling shader counts into the commands, then copies the count.
+		vk::BufferUsageFlags usage = vk::BufferUsageFlagBits::eIndirectBuffer;
+		if (use_gpu_culling)
+		{
+			usage |= vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst;
+		}
+		indirect_stream.reset(new ZVK_StreamBuffer(logical_device, gpus[0], usage, size));
+	}
+	indirect_stream->reserve(size);
+
+	// One compact array, written straight into the mapped slice, the
+	// commands of a group after those of the previous one.
+	vk::DrawIndexedIndirectCommand* commands = reinterpret_cast<vk::DrawIndexedIndirectCommand*>(indirect_stream->begin_Frame(frame_index));
+	frame_commands = commands;
+	for (auto& group : draw_groups)
+	{
+		// Culled on the GPU, the commands start with no instances.
+		const uint32_t instances = use_gpu_culling ? 0 : group.instances_qty;
+		for (auto& part : get_LevelParts(group.level))
+		{
+			*commands++ = vk::DrawIndexedIndirectCommand{ part.indices_qty, instances, part.first_index, part.vertex_offset, 0 };
+		}
+	}
+}
+
+void ZVK_Application::record_Draws(vk::CommandBuffer cmd)
+{
+	const uint32_t stride = sizeof(vk::DrawIndexedIndirectCommand);
+	vk::DeviceSize commands_offset = use_indirect ? indirect_stream->get_Offset() : 0;
+	for (auto& group : draw_groups)
+	{
+		// The group starts the instance binding, so firstInstance stays 0.
+		if (instancing)
+		{
+			const vk::DeviceSize instance_offset = use_gpu_culling ? 0 : instance_stream->get_Offset() + group.first_instance * sizeof(instance_data);
+			const vk::Buffer instance_buffer = use_gpu_culling ? gpu_culler->get_VisibleBuffer() : instance_stream->get_Buffer();
+			cmd.bindVertexBuffers(1, 1, &instance_buffer, &instance_offset);
+		}
+		cmd.bindIndexBuffer(group.level ? lod_index_buffer : index_buffer, 0, index_type);
+
+		const std::vector<mesh_part>& parts = get_LevelParts(group.level);
+		if (!use_indirect)
+		{
+			for (auto& part : parts)
+			{
+				cmd.drawIndexed(part.indices_qty, group.instances_qty, part.first_index, part.vertex_offset, 0);
+			}
+			continue;
+		}
+
+		const uint32_t commands_qty = static_cast<uint32_t>(parts.size());
+		const vk::Buffer buffer = indirect_stream->get_Buffer();
+		const uint32_t batch = has_multi_draw_indirect ? max_draw_indirect_count : 1;
+		for (uint32_t first = 0; first < commands_qty; first += batch)
+		{
+			cmd.drawIndexedIndirect(buffer, commands_offset + first * stride, std::min(batch, commands_qty - first), stride);
+		}
+		commands_offset += commands_qty * stride;
+	}
+}
+
+void ZVK_Application::create_TimestampPool()
+{
+	const vk::PhysicalDeviceProperties properties = gpus[0].getProperties();
+	const std::vector<vk::QueueFamilyProperties> families = gpus[0].getQueueFamilyProperties();
+	const uint32_t valid_bits = families[device_queue_info.queueFamilyIndex].timestampValidBits;
+	if (!properties.limits.timestampComputeAndGraphics || !valid_bits)
+	{
+		return;
+	}
+
+	vk::QueryPoolCreateInfo pool_info{};
+	pool_info.queryType = vk::QueryType::eTimestamp;
+	pool_info.queryCount = 2;
+	timestamp_pool = own(logical_device->createQueryPool(pool_info));
+	timestamp_period = properties.limits.timestampPeriod;
+	timestamp_mask = valid_bits >= 64 ? ~0ull : (1ull << valid_bits) - 1;
+}
+
+bool ZVK_Application::init_pipeline_cache()
+{
+	vk::PipelineCacheCreateInfo info{};
+	pipeline_cache = own(logical_device->createPipelineCache(info));
+
+	return pipeline_cache ? true : false;
+}
+
+bool ZVK_Application::create_GraphicsPipeline()
+{
+	Z_StartupReport::scoped_timer timer{ startup_report, "create_GraphicsPipeline" };
+
+	std::array<vk::DynamicState, VK_DYNAMIC_STATE_RANGE_SIZE> dynamic_state_enables{};
+	vk::PipelineDynamicStateCreateInfo dynamic_state_info{};
+	dynamic_state_info.pDynamicStates = dynamic_state_enables.data();
+
+	vk::PipelineVertexInputStateCreateInfo vertex_input_state_info{};
+	vertex_input_state_info.vertexBindingDescriptionCount = vi_bindings_qty;
+	vertex_input_state_info.pVertexBindingDescriptions = vi_bindings;
+	vertex_input_state_info.vertexAttributeDescriptionCount = vi_attribs_qty;
+	vertex_input_state_info.pVertexAttributeDescriptions = vi_attribs;
+
+	vk::PipelineInputAssemblyStateCreateInfo input_assembly_state_info{};
+	input_assembly_state_info.topology = vk::PrimitiveTopology::eTriangleList;
+
+	vk::PipelineRasterizationStateCreateInfo rasterization_state_info{};
+	rasterization_state_info.polygonMode = vk::PolygonMode::eFill;
+	rasterization_state_info.cullMode = vk::CullModeFlagBits::eBack;
+	rasterization_state_info.frontFace = vk::FrontFace::eClockwise;
+	rasterization_state_info.depthClampEnable = VK_TRUE;
+	rasterization_state_info.rasterizerDiscardEnable = VK_FALSE;
+	rasterization_state_info.depthBiasEnable = VK_FALSE;
+	rasterization_state_info.depthBiasConstantFactor = 0;
+	rasterization_state_info.depthBiasClamp = 0;
+	rasterization_state_info.depthBiasSlopeFactor = 0;
+	rasterization_state_info.lineWidth = 1.0f;
+
+	std::array<vk::PipelineColorBlendAttachmentState, 1> att_state{};
+	att_state[0].colorWriteMask = vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG | vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA;
+	att_state[0].blendEnable = VK_FALSE;
+	att_state[0].alphaBlendOp = vk::BlendOp::eAdd;
+	att_state[0].colorBlendOp = vk::BlendOp::eAdd;
+	att_state[0].srcColorBlendFactor = vk::BlendFactor::eZero;
+	att_state[0].dstColorBlendFactor = vk::BlendFactor::eZero;
+	att_state[0].srcAlphaBlendFactor = vk::BlendFactor::eZero;
+	att_state[0].dstAlphaBlendFactor = vk::BlendFactor::eZero;
+	vk::PipelineColorBlendStateCreateInfo color_blend_state_info{};
+	color_blend_state_info.attachmentCount = 1;
+	color_blend_state_info.pAttachments = att_state.data();
+	color_blend_state_info.logicOpEnable = VK_FALSE;
+	color_blend_state_info.logicOp = vk::LogicOp::eNoOp;
+	color_blend_state_info.blendConstants[0] = 1.0f;
+	color_blend_state_info.blendConstants[1] = 1.0f;
+	color_blend_state_info.blendConstants[2] = 1.0f;
+	color_blend_state_info.blendConstants[3] = 1.0f;
+
+	vk::PipelineViewportStateCreateInfo viewport_state_info{};
 	viewport_state_info.viewportCount = 1;
 	dynamic_state_enables[dynamic_state_info.dynamicStateCount++] = vk::DynamicState::eViewport;
 	viewport_state_info.scissorCount = 1;
@@ -1112,6 +1879,15 @@ bool ZVK_Application::create_GraphicsPipeline()
 		shader_stages[i].module = shaders[i];
 	}
 
+	// The bindless vertex shader sizes its buffers array by a specialization constant.
+	const uint32_t objects_qty = use_bindless ? bindless_table->get_BuffersQty() : 0;
+	const vk::SpecializationMapEntry objects_qty_entry{ 0, 0, sizeof(objects_qty) };
+	vk::SpecializationInfo specialization_info{ 1, &objects_qty_entry, sizeof(objects_qty), &objects_qty };
+	if (use_bindless)
+	{
+		shader_stages[vert_stage].pSpecializationInfo = &specialization_info;
+	}
+
 	vk::GraphicsPipelineCreateInfo pipeline_info;
 	pipeline_info.layout = pipeline_layout;
 	pipeline_info.pVertexInputState = &vertex_input_state_info;
@@ -1133,33 +1909,60 @@ bool ZVK_Application::create_GraphicsPipeline()
 		return false;
 	}
 
-	pipeline = logical_device.createGraphicsPipeline(pipeline_cache, pipeline_info);
+	{
+		Z_StartupReport::scoped_timer compile_timer{ startup_report, "createGraphicsPipeline" };
+		pipeline = own(logical_device->createGraphicsPipeline(pipeline_cache, pipeline_info));
+	}
+	create_TimestampPool();
 
 	return pipeline ? true : false;
 }
 
 bool ZVK_Application::draw_GraphicsPipeline()
 {
-	// Start recording command buffer.
-	vk::CommandBufferBeginInfo cmd_buf_info{};
-	command_buffers[currect_command_buffer].begin(cmd_buf_info);
+	auto cpu_start = std::chrono::high_resolution_clock::now();
+
+	// The camera may have moved since the last frame.
+	set_view();
+	write_Uniforms();
 
 	if (!create_Semaphore())
 	{
 		return false;
 	}
 
-	// Set the depth buffer layout.
-	set_image_layout(depth_image, vk::ImageAspectFlagBits::eDepth, vk::ImageLayout::eUndefined, vk::ImageLayout::eDepthStencilAttachmentOptimal);
-
-	// Acquire the swapchain image in order to set its layout.
+	// The image is acquired before anything is recorded, so a frame
+	// dropped here leaves the command buffer and the descriptor cache
+	// as they were. Waiting for the image is not counted as CPU time.
 	vk::Fence fence{};
 	static uint32_t current_buffer = 0;
 	current_buffer += (1 - current_buffer);
-	if (vk::Result::eSuccess != logical_device.acquireNextImageKHR(swap_chain, UINT64_MAX, image_acquired_semaphore, fence, &current_buffer))
+	auto acquire_start = std::chrono::high_resolution_clock::now();
+	const vk::Result acquired = logical_device->acquireNextImageKHR(swap_chain, UINT64_MAX, image_acquired_semaphore, fence, &current_buffer);
+	if (vk::Result::eErrorOutOfDateKHR == acquired)
+	{
+		// No image was acquired, the frame is dropped for a new swap chain.
+		recreate_Swapchain();
+		return false;
+	}
+	if (vk::Result::eSuccess != acquired && vk::Result::eSuboptimalKHR != acquired)
 	{
 		return false;
 	}
+	cpu_start += std::chrono::high_resolution_clock::now() - acquire_start;
+
+	descriptor_cache->begin_frame(frame_index);
+	if (!use_bindless)
+	{
+		descriptor_sets.assign(1, descriptor_cache->get(descriptor_layouts[0], get_ObjectResources()));
+	}
+
+	// Start recording command buffer.
+	vk::CommandBufferBeginInfo cmd_buf_info{};
+	command_buffers[currect_command_buffer].begin(cmd_buf_info);
+
+	// Set the depth buffer layout.
+	set_image_layout(depth_image, vk::ImageAspectFlagBits::eDepth, vk::ImageLayout::eUndefined, vk::ImageLayout::eDepthStencilAttachmentOptimal);
 
 	// Set the layout for the color buffer, transitioning it from
 	// undefined to an optimal color attachment to make it usable in
@@ -1188,38 +1991,84 @@ bool ZVK_Application::draw_GraphicsPipeline()
 	rp_begin.clearValueCount = 2;
 	rp_begin.pClearValues = clear_values;
 
+	if (instancing)
+	{
+		write_Instances();
+	}
+	else
+	{
+		draw_groups.assign(1, draw_group{ 0, 0, 1 });
+	}
+	if (use_indirect)
+	{
+		write_DrawCommands();
+	}
+
+	if (timestamp_pool)
+	{
+		command_buffers[currect_command_buffer].resetQueryPool(timestamp_pool, 0, 2);
+		command_buffers[currect_command_buffer].writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe, timestamp_pool, 0);
+	}
+	if (use_gpu_culling)
+	{
+		gpu_culler->record(command_buffers[currect_command_buffer], frame_index, &view_projection[0][0], instance_culler.get_Planes(),
+			indirect_stream->get_Buffer(), indirect_stream->get_Offset(), static_cast<uint32_t>(mesh_parts.size()));
+	}
 	command_buffers[currect_command_buffer].beginRenderPass(rp_begin, vk::SubpassContents::eInline);
 	command_buffers[currect_command_buffer].bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline);
-	command_buffers[currect_command_buffer].bindDescriptorSets(vk::PipelineBindPoint::eGraphics, pipeline_layout, 0, (uint32_t)descriptor_sets.size(), descriptor_sets.data(), 0, nullptr);
+	if (use_bindless)
+	{
+		// The table is bound once, draws only change the pushed index.
+		vk::DescriptorSet table = bindless_table->get_Set();
+		command_buffers[currect_command_buffer].bindDescriptorSets(vk::PipelineBindPoint::eGraphics, pipeline_layout, 0, 1, &table, 0, nullptr);
+		const uint32_t object_index = object_indices[frame_index % object_indices.size()];
+		command_buffers[currect_command_buffer].pushConstants(pipeline_layout, vk::ShaderStageFlagBits::eVertex, 0, sizeof(object_index), &object_index);
+	}
+	else
+	{
+		command_buffers[currect_command_buffer].bindDescriptorSets(vk::PipelineBindPoint::eGraphics, pipeline_layout, 0, (uint32_t)descriptor_sets.size(), descriptor_sets.data(), 0, nullptr);
+	}
 	const vk::DeviceSize offsets[1]{0};
-	command_buffers[currect_command_buffer].bindVertexBuffers(0, 1, &vertex_buffer, offsets);
+	command_buffers[currect_command_buffer].bindVertexBuffers(0, 1, vertex_buffer.ptr(), offsets);
 	
 	init_viewport();
 	init_scissor();
 
-	command_buffers[currect_command_buffer].draw(12 * 3, 1, 0, 0);
+	record_Draws(command_buffers[currect_command_buffer]);
 	command_buffers[currect_command_buffer].endRenderPass();
+	if (timestamp_pool)
+	{
+		command_buffers[currect_command_buffer].writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe, timestamp_pool, 1);
+	}
 
 	// Stop recording the command.
 	command_buffers[currect_command_buffer].end();
 
 	const vk::CommandBuffer cmd_bufs[] = { command_buffers[currect_command_buffer] };
 
-	vk::FenceCreateInfo fenceInfo{};
-	vk::Fence drawFence = logical_device.createFence(fenceInfo);
+	if (!frame_fence)
+	{
+		vk::FenceCreateInfo fenceInfo{};
+		frame_fence = own(logical_device->createFence(fenceInfo));
+	}
+	else
+	{
+		logical_device->resetFences(1, frame_fence.ptr());
+	}
 
 	vk::PipelineStageFlags pipe_stage_flags = vk::PipelineStageFlagBits::eColorAttachmentOutput;
 	vk::SubmitInfo submit_info[1]{};
 	submit_info[0].waitSemaphoreCount = 1;
-	submit_info[0].pWaitSemaphores = &image_acquired_semaphore;
+	submit_info[0].pWaitSemaphores = image_acquired_semaphore.ptr();
 	submit_info[0].pWaitDstStageMask = &pipe_stage_flags;
 	submit_info[0].commandBufferCount = 1;
 	submit_info[0].pCommandBuffers = cmd_bufs;
 	submit_info[0].signalSemaphoreCount = 0;
 	submit_info[0].pSignalSemaphores = nullptr;
 
-	vk::Queue graphics_queue = logical_device.getQueue(device_info.pQueueCreateInfos->queueFamilyIndex, 0);
-	if (vk::Result::eSuccess != graphics_queue.submit(1, submit_info, drawFence))
+	vk::Queue graphics_queue = logical_device->getQueue(device_info.pQueueCreateInfos->queueFamilyIndex, 0);
+	last_frame_timing.cpu_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - cpu_start).count();
+	if (vk::Result::eSuccess != graphics_queue.submit(1, submit_info, frame_fence))
 	{
 		throw std::domain_error{ "Problem while submitting Graphics Queue" };
 	}
@@ -1227,29 +2076,52 @@ bool ZVK_Application::draw_GraphicsPipeline()
 	vk::Result res{};
 	/* Make sure command buffer is finished before presenting */
 	do {
-		res = logical_device.waitForFences(1, &drawFence, VK_TRUE, 100000000);
+		res = logical_device->waitForFences(1, frame_fence.ptr(), VK_TRUE, 100000000);
 	} while (res == vk::Result::eTimeout);
 	if (vk::Result::eSuccess != res)
 	{
 		throw std::domain_error{ "Problem while processing a Command Buffer" };
 	}
+	if (use_gpu_culling)
+	{
+		gpu_visible_instances = frame_commands->instanceCount;
+	}
+	last_frame_timing.gpu_seconds = 0.0;
+	if (timestamp_pool)
+	{
+		uint64_t ticks[2]{};
+		if (vk::Result::eSuccess == logical_device->getQueryPoolResults(timestamp_pool, 0, 2, sizeof(ticks), ticks, sizeof(ticks[0]),
+			vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait))
+		{
+			last_frame_timing.gpu_seconds = ((ticks[1] - ticks[0]) & timestamp_mask) * timestamp_period * 1e-9;
+		}
+	}
+	// Objects retired up to this frame are no longer referenced by the GPU.
+	deletion_queue.collect(frame_index);
+	descriptor_cache->frame_completed(frame_index++);
 
 	vk::PresentInfoKHR present{};
 	present.swapchainCount = 1;
-	present.pSwapchains = &swap_chain;
+	present.pSwapchains = swap_chain.ptr();
 	present.pImageIndices = &current_buffer;
 	present.pWaitSemaphores = nullptr;
 	present.waitSemaphoreCount = 0;
 	present.pResults = nullptr;
 
-	vk::Queue present_queue = logical_device.getQueue(present_family_index, 0);
-	if (vk::Result::eSuccess != present_queue.presentKHR(present))
+	// The overload taking a pointer returns out of date instead of throwing.
+	vk::Queue present_queue = logical_device->getQueue(present_family_index, 0);
+	const vk::Result presented = present_queue.presentKHR(&present);
+	if (vk::Result::eErrorOutOfDateKHR == presented || vk::Result::eSuboptimalKHR == presented || vk::Result::eSuboptimalKHR == acquired)
+	{
+		// The frame was waited for, the next one draws into a swap chain
+		// matching the surface.
+		recreate_Swapchain();
+	}
+	else if (vk::Result::eSuccess != presented)
 	{
 		throw std::domain_error{ "Problem while presenting" };
 	}
 
-	logical_device.destroyFence(drawFence);
-
 	return true;
 }
 
@@ -1261,12 +2133,12 @@ bool ZVK_Application::create_Semaphore()
 	vk::SemaphoreCreateInfo imageAcquiredSemaphoreCreateInfo;
 	imageAcquiredSemaphoreCreateInfo.pNext = nullptr;
 
-	image_acquired_semaphore = logical_device.createSemaphore(imageAcquiredSemaphoreCreateInfo);
+	image_acquired_semaphore = own(logical_device->createSemaphore(imageAcquiredSemaphoreCreateInfo));
 
 	return image_acquired_semaphore ? true : false;
 }
 
-void ZVK_Application::set_image_layout(vk::Image& image, vk::ImageAspectFlags aspectMask, vk::ImageLayout old_image_layout, vk::ImageLayout new_image_layout)
+void ZVK_Application::set_image_layout(vk::Image image, vk::ImageAspectFlags aspectMask, vk::ImageLayout old_image_layout, vk::ImageLayout new_image_layout)
 {
 	/* DEPENDS on vk::CommandBuffer and vk::DeviceQueueCreateInfo are initialized */
 	if (!command_buffers.size() || UINT32_MAX == device_queue_info.queueFamilyIndex)
@@ -1346,4 +2218,260 @@ void ZVK_Application::init_scissor()
 	scissor.offset.x = 0;
 	scissor.offset.y = 0;
 	command_buffers[currect_command_buffer].setScissor(0, 1, &scissor);
-}
\ No newline at end of file
+}
+
+void ZVK_Application::benchmark_DescriptorAllocation(std::ostream& out, size_t sets_qty)
+{
+	if (!descriptor_layouts.size())
+	{
+		throw std::domain_error{ "Descriptor benchmarks need the per-set descriptor path" };
+	}
+
+	typedef std::chrono::high_resolution_clock clock;
+	auto rate = [](size_t qty, clock::duration d)
+	{
+		return static_cast<double>(qty) / std::chrono::duration<double>(d).count();
+	};
+	const vk::DescriptorSetLayout layout = descriptor_layouts[0];
+
+	out << "Descriptor allocation of " << sets_qty << " sets:\n";
+	out << std::fixed << std::setprecision(0);
+
+	{
+		// Starts with small pools, so the allocator has to grow.
+		ZVK_DescriptorAllocator allocator(logical_device, 16);
+
+		auto start = clock::now();
+		for (size_t i = 0; i < sets_qty; ++i)
+		{
+			allocator.allocate(layout);
+		}
+		auto cold = clock::now() - start;
+		size_t pools_qty = allocator.get_PoolsQty();
+
+		allocator.reset();
+		start = clock::now();
+		for (size_t i = 0; i < sets_qty; ++i)
+		{
+			allocator.allocate(layout);
+		}
+		auto warm = clock::now() - start;
+
+		out << "    growing pools:     " << rate(sets_qty, cold) << " sets/s (" << pools_qty << " pools)\n";
+		out << "    after reset:       " << rate(sets_qty, warm) << " sets/s\n";
+	}
+
+	{
+		// Transient sets of many frames, the pools are reset every frame.
+		const size_t frames_qty = 100;
+		const size_t sets_per_frame = std::max<size_t>(sets_qty / frames_qty, 1);
+		ZVK_DescriptorAllocator allocator(logical_device);
+
+		auto start = clock::now();
+		for (size_t f = 0; f < frames_qty; ++f)
+		{
+			allocator.reset();
+			for (size_t i = 0; i < sets_per_frame; ++i)
+			{
+				allocator.allocate(layout);
+			}
+		}
+		auto transient = clock::now() - start;
+
+		out << "    per-frame reset:   " << rate(frames_qty * sets_per_frame, transient) << " sets/s ("
+			<< allocator.get_PoolsQty() << " pools)\n";
+	}
+
+	{
+		// The way allocate_DescriptorSets worked before: one pool per set.
+		vk::DescriptorPoolSize type_count{ vk::DescriptorType::eUniformBuffer, 1 };
+		vk::DescriptorPoolCreateInfo desc_pool_info{};
+		desc_pool_info.maxSets = 1;
+		desc_pool_info.poolSizeCount = 1;
+		desc_pool_info.pPoolSizes = &type_count;
+
+		vk::DescriptorSetAllocateInfo alloc_info{};
+		alloc_info.descriptorSetCount = 1;
+		alloc_info.pSetLayouts = &layout;
+
+		std::vector<vk::DescriptorPool> pools(sets_qty);
+		auto start = clock::now();
+		for (size_t i = 0; i < sets_qty; ++i)
+		{
+			pools[i] = logical_device->createDescriptorPool(desc_pool_info);
+			alloc_info.descriptorPool = pools[i];
+			vk::DescriptorSet set{};
+			logical_device->allocateDescriptorSets(&alloc_info, &set);
+		}
+		auto single = clock::now() - start;
+		for (auto p : pools)
+		{
+			logical_device->destroyDescriptorPool(p);
+		}
+
+		out << "    pool per set:      " << rate(sets_qty, single) << " sets/s\n";
+	}
+}
+
+void ZVK_Application::benchmark_DescriptorUpdate(std::ostream& out, size_t sets_qty)
+{
+	if (!descriptor_layouts.size())
+	{
+		throw std::domain_error{ "Descriptor benchmarks need the per-set descriptor path" };
+	}
+
+	typedef std::chrono::high_resolution_clock clock;
+	auto per_set = [sets_qty](clock::duration d)
+	{
+		return std::chrono::duration<double, std::nano>(d).count() / sets_qty;
+	};
+
+	ZVK_DescriptorAllocator allocator(logical_device, 1024);
+	std::vector<vk::DescriptorSet> sets(sets_qty);
+	for (auto& set : sets)
+	{
+		set = allocator.allocate(descriptor_layouts[0]);
+	}
+
+	// Individual writes, assembled field by field for every set.
+	auto start = clock::now();
+	for (auto set : sets)
+	{
+		vk::DescriptorBufferInfo buffer_info{ uniform_stream->get_Buffer(), 0, sizeof(MVP) };
+
+		vk::WriteDescriptorSet writes;
+		writes.dstSet = set;
+		writes.descriptorCount = 1;
+		writes.descriptorType = vk::DescriptorType::eUniformBuffer;
+		writes.pBufferInfo = &buffer_info;
+		writes.dstArrayElement = 0;
+		writes.dstBinding = 0;
+
+		logical_device->updateDescriptorSets(1, &writes, 0, nullptr);
+	}
+	auto individual = clock::now() - start;
+
+	// One call per set from a packed struct.
+	std::vector<uint8_t> data(descriptor_template->get_DataSize());
+	vk::DescriptorBufferInfo buffer_info{ uniform_stream->get_Buffer(), 0, sizeof(MVP) };
+	memcpy(data.data() + descriptor_template->get_Offset(0), &buffer_info, sizeof(buffer_info));
+
+	start = clock::now();
+	for (auto set : sets)
+	{
+		descriptor_template->update(set, data.data());
+	}
+	auto templated = clock::now() - start;
+
+	out << "Descriptor update of " << sets_qty << " sets:\n";
+	out << std::fixed << std::setprecision(1);
+	out << "    WriteDescriptorSet:  " << per_set(individual) << " ns/set\n";
+	out << "    update template:     " << per_set(templated) << " ns/set ("
+		<< (descriptor_template->is_Native() ? ZVK_DescriptorUpdateTemplate::extension_name : "emulated") << ")\n";
+}
+
+void ZVK_Application::benchmark_TextureUpload(std::ostream& out, uint32_t texture_size, size_t textures_qty)
+{
+	ZVK_MipGenerator mips(logical_device, gpus[0], has_storage_write_without_format);
+
+	std::vector<uint32_t> pixels(static_cast<size_t>(texture_size) * texture_size);
+	for (size_t i = 0; i < pixels.size(); ++i)
+	{
+		pixels[i] = static_cast<uint32_t>(i * 2654435761u);
+	}
+	const ZVK_TextureUploader::source src{ pixels.data(), pixels.size() * sizeof(pixels[0]),
+		vk::Extent2D{ texture_size, texture_size }, vk::Format::eR8G8B8A8Unorm };
+
+	out << "Texture upload of " << textures_qty << " " << texture_size << "x" << texture_size << " RGBA8 textures:\n";
+	out << std::fixed << std::setprecision(1);
+	auto print = [&out](const char* name, const ZVK_TextureUploader::statistics& stats)
+	{
+		out << "    " << name << " " << stats.bytes / (1024.0 * 1024.0) << " MB in " << stats.seconds * 1000.0 << " ms, "
+			<< stats.megabytes_per_second() << " MB/s\n";
+	};
+
+	// Each texture is destroyed right away, only the upload is measured.
+	{
+		ZVK_TextureUploader uploader(logical_device, gpus[0], device_queue_info.queueFamilyIndex);
+		for (size_t i = 0; i < textures_qty; ++i)
+		{
+			uploader.upload(src.pixels, src.size, src.extent, src.format);
+		}
+		print("level 0 only:      ", uploader.get_Statistics());
+	}
+
+	if (ZVK_MipGenerator::unsupported == mips.get_Method(src.format))
+	{
+		out << "    mip generation is not supported for RGBA8\n";
+		return;
+	}
+
+	{
+		ZVK_TextureUploader uploader(logical_device, gpus[0], device_queue_info.queueFamilyIndex, &mips);
+		for (size_t i = 0; i < textures_qty; ++i)
+		{
+			uploader.upload(src.pixels, src.size, src.extent, src.format, true);
+		}
+		print("with mips:         ", uploader.get_Statistics());
+	}
+
+	{
+		// Batches of 8 textures share one command buffer and submission.
+		const size_t batch_size = 8;
+		ZVK_TextureUploader uploader(logical_device, gpus[0], device_queue_info.queueFamilyIndex, &mips);
+		for (size_t i = 0; i < textures_qty; i += batch_size)
+		{
+			std::vector<ZVK_TextureUploader::source> batch(std::min(batch_size, textures_qty - i), src);
+			uploader.upload_Batch(batch, true);
+		}
+		print("with mips, batched:", uploader.get_Statistics());
+	}
+
+	out << "    mips are generated by "
+		<< (ZVK_MipGenerator::blit == mips.get_Method(src.format) ? "blits" : "a compute shader") << "\n";
+}
+
+void ZVK_Application::benchmark_Instancing(std::ostream& out, size_t max_instances, size_t frames_qty)
+{
+	if (!instancing)
+	{
+		throw std::domain_error{ "Instancing was not selected before create_LogicalDevice" };
+	}
+
+	const size_t selected_qty = instances_qty;
+	out << "Instanced rendering, average of " << frames_qty << " frames:\n";
+	out << std::fixed << std::setprecision(3);
+	for (size_t qty = 1; qty <= max_instances; qty *= 10)
+	{
+		set_InstancesQty(qty);
+		// The first frame lays the instances out and grows the stream.
+		draw_GraphicsPipeline();
+
+		frame_timing total{};
+		for (size_t i = 0; i < frames_qty; ++i)
+		{
+			draw_GraphicsPipeline();
+			total.cpu_seconds += last_frame_timing.cpu_seconds;
+			total.gpu_seconds += last_frame_timing.gpu_seconds;
+		}
+
+		const double cpu_ms = total.cpu_seconds * 1000.0 / frames_qty;
+		out << "    " << std::setw(8) << qty << " instances: CPU " << std::setw(9) << cpu_ms << " ms";
+		if (timestamp_pool)
+		{
+			out << ", GPU " << std::setw(9) << total.gpu_seconds * 1000.0 / frames_qty << " ms";
+		}
+		out << ", " << std::setw(7) << (cpu_ms > 0.0 ? qty / cpu_ms / 1000.0 : 0.0) << " M instances/s of CPU";
+		if (culling)
+		{
+			out << ", " << visible_instances.size() << " visible";
+		}
+		out << "\n";
+	}
+	if (!timestamp_pool)
+	{
+		out << "    the graphics queue has no timestamps, GPU time is not measured\n";
+	}
+
+	set_InstancesQty(selected_qty);
+}
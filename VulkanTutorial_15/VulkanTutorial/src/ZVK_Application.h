@@ -2,7 +2,7 @@
  * VulkanTutorial project
  *
  * Created by Andriy Zhabura on 02-Oct-2016.
- * Last modified on 12-Dec-2016.
+ * Last modified on 19-Oct-2026.
  */
 
 /*
@@ -38,16 +38,68 @@
 #include <vector>
 #include <array>
 #include <string>
+#include <memory>
+#include <ostream>
 
 #define GLM_FORCE_RADIANS
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
 #include "Z_Window.h"
+#include "Z_StartupReport.h"
+#include "Z_IndexedMesh.h"
+#include "Z_VertexQuantizer.h"
+#include "Z_MeshFile.h"
+#include "Z_MeshImporter.h"
+#include "Z_FrustumCuller.h"
+#include "Z_Bvh.h"
+#include "Z_LodSelector.h"
+#include "Z_TransformHierarchy.h"
+#include "Z_Camera.h"
+#include "Z_ThreadPool.h"
+#include "Z_JobSystem.h"
+#include "ZVK_DescriptorAllocator.h"
+#include "ZVK_DescriptorCache.h"
+#include "ZVK_DescriptorUpdateTemplate.h"
+#include "ZVK_BindlessTable.h"
+#include "ZVK_Handle.h"
+#include "ZVK_DeletionQueue.h"
+#include "ZVK_SamplerCache.h"
+#include "ZVK_TextureUploader.h"
+#include "ZVK_BufferUploader.h"
+#include "ZVK_StreamBuffer.h"
+#include "ZVK_InstanceCuller.h"
+#include "ZVK_MipGenerator.h"
+#include "ZVK_RenderPassCache.h"
+#include "ZVK_FramebufferCache.h"
+#include "ZVK_Memory.h"
 
 class ZVK_Application
 {
 public:
+	enum scene_type
+	{
+		solid_faces,
+		textured_cube
+	};
+
+	/* Vertex data of one instance, fetched at the instance rate. */
+	struct instance_data
+	{
+		glm::mat4 mvp;
+		/* RGBA8, multiplies the vertex colors. */
+		uint32_t color;
+	};
+
+	/* CPU time spent preparing and recording a frame, and GPU time of */
+	/* its culling and render pass; gpu_seconds is 0 without timestamp */
+	/* support.                                                        */
+	struct frame_timing
+	{
+		double cpu_seconds;
+		double gpu_seconds;
+	};
+
 	ZVK_Application();
 	~ZVK_Application();
 
@@ -61,6 +113,7 @@ public:
     bool create_ImageViews();
     bool create_DepthBuffer();
     bool create_UniformBuffer();
+    bool create_Texture();
     bool create_DescriptorSetLayout();
     bool create_PipelineLayout();
     bool allocate_DescriptorSets();
@@ -68,14 +121,120 @@ public:
     bool create_RenderPass();
 	bool create_Shaders();
 	bool create_FrameBuffers();
-	bool create_VertexBuffer();
+	/* Imported models are parsed and built on pool. */
+	bool create_VertexBuffer(Z_ThreadPool& pool);
 	bool create_GraphicsPipeline();
 	bool draw_GraphicsPipeline();
+
+	/* Rebuilds the size dependent objects, e.g. after a resize; the   */
+	/* compatible render pass and framebuffers come from the caches.   */
+	/* draw_GraphicsPipeline calls it when acquire or present find the */
+	/* swap chain out of date or suboptimal.                           */
+	bool recreate_Swapchain();
+
+	const Z_StartupReport& get_StartupReport() const { return startup_report; }
+
+	/* Changes take effect at the next frame, which recomputes only what */
+	/* they affect and writes the MVP into its own uniform slice.        */
+	Z_Camera& get_Camera() { return camera; }
+
+	/* Must be selected before create_LogicalDevice. */
+	void set_Scene(scene_type s) { scene = s; }
+	scene_type get_Scene() const { return scene; }
+	ZVK_TextureUploader::statistics get_TextureUploadStatistics() const;
+	const Z_IndexedMesh& get_Mesh() const { return mesh; }
+
+	/* Must be selected before create_VertexBuffer; position_float32 keeps */
+	/* the float vertices, the others pack them with unorm8 colors and     */
+	/* half uvs. Formats a device cannot fetch fall back to the floats.    */
+	void set_VertexFormat(Z_VertexQuantizer::position_format f) { vertex_format = f; }
+	Z_VertexQuantizer::position_format get_VertexFormat() const { return vertex_format; }
+	const Z_VertexQuantizer::error_report& get_VertexQuantizationReport() const { return vertex_quantization; }
+
+	/* Must be selected before create_VertexBuffer. The mesh of that name, */
+	/* or the first one, is drawn instead of the cube: its blobs are read  */
+	/* from the mapped file straight into device local buffers.            */
+	/* .obj and .gltf models are imported whole in the float layout of the */
+	/* scene, part by part into the buffers, and scaled to the cube size.  */
+	void set_MeshFile(const std::string& path, const std::string& name) { mesh_file_path = path; mesh_file_name = name; }
+	bool has_MeshFile() const { return !mesh_file_path.empty(); }
+	bool is_ImportedMesh() const;
+	ZVK_BufferUploader::statistics get_BufferUploadStatistics() const;
+	const Z_MeshImporter::statistics& get_ImportStatistics() const { return mesh_import; }
+
+	/* Must be selected before create_VertexBuffer. Imported models are */
+	/* simplified into up to levels_qty coarser levels, mesh files give */
+	/* the levels they have. Every instance draws the coarsest level    */
+	/* whose error covers at most max_pixels on screen; the cubes and   */
+	/* the GPU culled instances keep the full mesh.                     */
+	void set_LevelsOfDetail(size_t levels_qty, float max_pixels = 1.0f);
+	size_t get_LevelsOfDetailQty() const { return mesh_lods.size(); }
+	/* Instances drawn at every level in the last frame, finest first. */
+	std::vector<size_t> get_LevelInstancesQty() const;
+
+	/* Must be requested before create_LogicalDevice; devices without */
+	/* dynamic indexing of descriptor arrays keep the per-set path.   */
+	void set_BindlessMode(bool enable) { bindless_requested = enable; }
+	bool is_BindlessMode() const { return use_bindless; }
+
+	ZVK_DescriptorCache::statistics get_DescriptorCacheStatistics() const;
+
+	/* Must be selected before create_LogicalDevice, the quantity may then */
+	/* change between frames. The mesh is drawn once per instance on a    */
+	/* grid, with MVPs and colors streamed to the GPU every frame. Takes  */
+	/* precedence over the bindless mode.                                 */
+	void set_InstancesQty(size_t qty);
+	size_t get_InstancesQty() const { return instances_qty; }
+	bool is_Instancing() const { return instancing; }
+	const frame_timing& get_FrameTiming() const { return last_frame_timing; }
+
+	/* Culls the instances against the view frustum on the CPU every */
+	/* frame, only the visible ones are streamed and drawn.          */
+	void set_Culling(bool enable) { culling = enable; }
+	bool is_Culling() const { return culling; }
+	size_t get_VisibleInstancesQty() const;
+	/* The culling walks a BVH of the instance bounds instead of */
+	/* testing every instance.                                   */
+	void set_BvhCulling(bool enable) { bvh_culling = enable; }
+	bool is_BvhCulling() const { return bvh_culling; }
+
+	/* Instance nearest to the camera under the window point, x and */
+	/* y from 0 to 1 from the top left, or Z_Bvh::no_object. Builds */
+	/* the BVH when culling has not yet.                            */
+	uint32_t pick_Instance(float x, float y);
+
+	/* Runs the culling, transform and instance work of the frames, */
+	/* created on first use. Its timing hook is set between frames. */
+	Z_JobSystem& get_FrameJobs();
+
+	/* Must be requested before create_LogicalDevice, together with  */
+	/* instancing, and implies indirect draws. The instances stay on */
+	/* the GPU, where a compute shader culls them and counts the     */
+	/* visible ones into the draw commands; the CPU culling is off.  */
+	void set_GpuCulling(bool enable) { gpu_culling_requested = enable; }
+	bool is_GpuCulling() const { return use_gpu_culling; }
+
+	/* Must be requested before create_LogicalDevice. The CPU writes the */
+	/* draw commands into a buffer once per frame; a device with         */
+	/* multiDrawIndirect takes them all in one command, others one by    */
+	/* one from the same buffer.                                         */
+	void set_IndirectDraws(bool enable) { indirect_requested = enable; }
+	bool is_IndirectDraws() const { return use_indirect; }
+	bool has_MultiDrawIndirect() const { return has_multi_draw_indirect; }
+
+	void benchmark_DescriptorAllocation(std::ostream& out, size_t sets_qty);
+	void benchmark_DescriptorUpdate(std::ostream& out, size_t sets_qty);
+	void benchmark_TextureUpload(std::ostream& out, uint32_t texture_size, size_t textures_qty);
+	/* Draws frames_qty frames of 1, 10, 100... instances up to max_instances. */
+	void benchmark_Instancing(std::ostream& out, size_t max_instances, size_t frames_qty);
 private:
+	/* Declared first, so its time origin precedes the window creation. */
+	Z_StartupReport startup_report;
+
 	vk::ApplicationInfo app_info{};
 	vk::InstanceCreateInfo inst_info{};
 
-	vk::Instance instance{};
+	ZVK_Handle<vk::Instance> instance;
 
 	std::vector<vk::LayerProperties> layer_properties;
 	std::vector<std::vector<vk::ExtensionProperties>> extention_properties;
@@ -87,26 +246,43 @@ private:
 	
 	vk::DeviceQueueCreateInfo device_queue_info{};
 	vk::DeviceCreateInfo device_info{};
-	vk::Device logical_device{};
+	ZVK_Handle<vk::Device> logical_device;
+	ZVK_DeletionQueue deletion_queue;
+	vk::PhysicalDeviceFeatures enabled_features{};
+	bool has_update_template_ext{};
+	bool has_storage_write_without_format{};
+
+	template <typename T>
+	ZVK_Handle<T> own(T handle) const
+	{
+		return ZVK_Handle<T>(logical_device, handle);
+	}
+
+	/* Destroys the object once the frames recorded so far have completed. */
+	template <typename T>
+	void retire(ZVK_Handle<T>& handle)
+	{
+		deletion_queue.retire(std::move(handle), frame_index);
+	}
 	
-	vk::CommandPool cmd_pool{};
+	ZVK_Handle<vk::CommandPool> cmd_pool;
 	std::vector<vk::CommandBuffer> command_buffers;
 
     Z_Window window;
-    vk::SurfaceKHR surface{};
+    ZVK_Handle<vk::SurfaceKHR> surface;
     uint32_t present_family_index{};
     vk::SurfaceFormatKHR surface_format{};
-    vk::SwapchainKHR swap_chain{};
-    std::vector<vk::ImageView> image_views;
+    ZVK_Handle<vk::SwapchainKHR> swap_chain;
+    std::vector<ZVK_Handle<vk::ImageView>> image_views;
 
     void create_Surface();
     void fill_device_queue_info();
     void check_SurfaceFormat();
 
     vk::Format depth_format{};
-    vk::Image depth_image{};
-    vk::DeviceMemory depth_memory{};
-    vk::ImageView depth_image_view{};
+    ZVK_Handle<vk::Image> depth_image;
+    ZVK_Handle<vk::DeviceMemory> depth_memory;
+    ZVK_Handle<vk::ImageView> depth_image_view;
 
     void create_DepthImage();
     void allocate_DepthMemory();
@@ -115,20 +291,42 @@ private:
         vk::MemoryPropertyFlags requirements_mask = vk::MemoryPropertyFlags{});
 
     glm::mat4 MVP{};
-    vk::Buffer uniform_buffer{};
-    vk::DeviceSize uniform_buffer_memory_size{};
-    vk::DeviceMemory uniform_buffer_memory{};
+    Z_Camera camera;
+    /* clip * projection * view, shared by all instances. */
+    glm::mat4 view_projection{ 1.0f };
+    /* One MVP slice per frame in flight, it stays mapped. */
+    std::unique_ptr<ZVK_StreamBuffer> uniform_stream;
 
     void set_view();
-    void allocate_UniformMemory();
-    void fill_UniformMemory();
+    void write_Uniforms();
+
+    scene_type scene{ solid_faces };
+    std::unique_ptr<ZVK_SamplerCache> sampler_cache;
+    std::unique_ptr<ZVK_MipGenerator> mip_generator;
+    std::unique_ptr<ZVK_TextureUploader> texture_uploader;
+    std::unique_ptr<ZVK_BufferUploader> buffer_uploader;
+    ZVK_Texture texture;
+    vk::Sampler texture_sampler{};
 
-    std::vector<vk::DescriptorSetLayout> descriptor_layouts;
-    vk::PipelineLayout pipeline_layout{};
+    std::vector<vk::DescriptorSetLayoutBinding> descriptor_layout_bindings;
+    std::vector<ZVK_Handle<vk::DescriptorSetLayout>> descriptor_layouts;
+    std::unique_ptr<ZVK_DescriptorUpdateTemplate> descriptor_template;
+    ZVK_Handle<vk::PipelineLayout> pipeline_layout;
 
-    vk::DescriptorPool desc_pool{};
+    /* Sets live until the application ends, the cache recycles them. */
+    std::unique_ptr<ZVK_DescriptorAllocator> descriptor_allocator;
+    std::unique_ptr<ZVK_DescriptorCache> descriptor_cache;
     std::vector<vk::DescriptorSet> descriptor_sets;
 
+    std::vector<ZVK_DescriptorCache::resource> get_ObjectResources() const;
+
+    bool bindless_requested{};
+    bool use_bindless{};
+    std::unique_ptr<ZVK_BindlessTable> bindless_table;
+    /* Table entry of every uniform slice. */
+    std::vector<uint32_t> object_indices;
+
+    std::unique_ptr<ZVK_RenderPassCache> render_pass_cache;
     vk::RenderPass render_pass{};
 
     /* Number of samples needs to be the same at image creation,      */
@@ -141,29 +339,146 @@ private:
 		frag_stage,
 		shaders_qty
 	};
-	std::array <vk::ShaderModule, shaders_qty> shaders;
+	std::array <ZVK_Handle<vk::ShaderModule>, shaders_qty> shaders;
 	bool create_shader_module(shader_stage stage, const uint32_t* code, size_t sz);
 
+	std::unique_ptr<ZVK_FramebufferCache> framebuffer_cache;
 	std::vector<vk::Framebuffer> framebuffers;
-	void clear_framebuffers();
+
+	/* Framebuffers using the view are retired together with it. */
+	void retire_ImageView(ZVK_Handle<vk::ImageView>& view);
 	
-	vk::Buffer vertex_buffer{};
+	ZVK_Handle<vk::Buffer> vertex_buffer;
 	vk::DeviceSize vertex_buffer_memory_size{};
-	vk::DeviceMemory vertex_buffer_memory{};
-	vk::VertexInputBindingDescription vi_binding;
-	vk::VertexInputAttributeDescription vi_attribs[2];
+	ZVK_Handle<vk::DeviceMemory> vertex_buffer_memory;
+	uint32_t vertex_stride{};
+	Z_IndexedMesh mesh;
+	Z_VertexQuantizer::position_format vertex_format{ Z_VertexQuantizer::position_float32 };
+	std::string mesh_file_path;
+	std::string mesh_file_name;
+	Z_MeshFile::vertex_layout mesh_layout{};
+	Z_VertexQuantizer::error_report vertex_quantization{};
+	/* Maps snorm16 positions back to the mesh bounds, part of the MVP. */
+	glm::mat4 position_dequantization{ 1.0f };
+	/* Brings imported models of any size where the cube is. */
+	glm::mat4 mesh_fit{ 1.0f };
+	Z_MeshImporter::statistics mesh_import{};
+	ZVK_Handle<vk::Buffer> index_buffer;
+	vk::DeviceSize index_buffer_memory_size{};
+	ZVK_Handle<vk::DeviceMemory> index_buffer_memory;
+	vk::IndexType index_type{ vk::IndexType::eUint16 };
+	uint32_t indices_qty{};
+	/* Ranges of the index buffer drawn one by one, indices are local to */
+	/* the part vertices.                                                */
+	struct mesh_part
+	{
+		uint32_t first_index;
+		uint32_t indices_qty;
+		int32_t vertex_offset;
+	};
+	std::vector<mesh_part> mesh_parts;
+	/* A coarser level, its parts index the same vertices from the lod */
+	/* index buffer.                                                   */
+	struct mesh_lod
+	{
+		float error;
+		std::vector<mesh_part> parts;
+	};
+	size_t lods_requested{};
+	std::vector<mesh_lod> mesh_lods;
+	ZVK_Handle<vk::Buffer> lod_index_buffer;
+	ZVK_Handle<vk::DeviceMemory> lod_index_buffer_memory;
+	const std::vector<mesh_part>& get_LevelParts(uint32_t level) const { return level ? mesh_lods[level - 1].parts : mesh_parts; }
+	/* The mesh binding, then the instance one: mvp columns and color. */
+	vk::VertexInputBindingDescription vi_bindings[2];
+	uint32_t vi_bindings_qty{};
+	vk::VertexInputAttributeDescription vi_attribs[7];
+	uint32_t vi_attribs_qty{};
 	void allocate_VertexMemory();
 	void fill_VertexMemory();
+	void quantize_Vertices();
+	void load_MeshFile();
+	void import_Mesh(Z_ThreadPool& pool);
+	/* Writes indices as index_type at first_index of buffer. */
+	void upload_Indices(vk::Buffer buffer, uint32_t first_index, const std::vector<uint32_t>& indices);
+	/* Levels of the imported parts, from copies of their positions. */
+	void simplify_Mesh(const std::vector<Z_IndexedMesh>& positions, Z_ThreadPool& pool);
+	void allocate_IndexMemory();
+	void fill_IndexMemory();
 	void describe_VertexData();
 
-	vk::Pipeline pipeline{};
-	vk::PipelineCache pipeline_cache{};
+	bool instancing{};
+	size_t instances_qty{};
+	/* Models are rebuilt on the next frame after a quantity change. */
+	bool instances_dirty{};
+	/* The grid node and, created right after it, one child per instance, */
+	/* so the instance worlds are consecutive from the grid node + 1 on.  */
+	Z_TransformHierarchy instance_transforms;
+	uint32_t grid_node{};
+	const float* get_InstanceModels() const;
+	std::vector<uint32_t> instance_colors;
+	std::unique_ptr<ZVK_StreamBuffer> instance_stream;
+	bool culling{};
+	Z_FrustumCuller instance_culler;
+	std::vector<uint32_t> visible_instances;
+	bool bvh_culling{};
+	/* Built when first needed from the instance boxes, which are */
+	/* released then.                                             */
+	Z_Bvh instance_bvh;
+	bool instance_bvh_built{};
+	std::vector<float> instance_mins;
+	std::vector<float> instance_maxs;
+	void build_InstanceBvh();
+	Z_LodSelector lod_selector;
+	/* Screen pixels a world unit covers at distance 1. */
+	float pixels_per_unit{ 1.0f };
+	/* Instances drawn with the same level, consecutive in the stream. */
+	struct draw_group
+	{
+		uint32_t level;
+		uint32_t first_instance;
+		uint32_t instances_qty;
+	};
+	std::vector<draw_group> draw_groups;
+	/* Workers of the per-frame work, created on first use. */
+	std::unique_ptr<Z_JobSystem> frame_jobs;
+	void layout_Instances();
+	/* Writes the instances grouped by level into draw_groups. */
+	void write_Instances();
+
+	bool gpu_culling_requested{};
+	bool use_gpu_culling{};
+	std::unique_ptr<ZVK_InstanceCuller> gpu_culler;
+	/* Read back from the commands once the frame has completed. */
+	uint32_t gpu_visible_instances{};
+
+	bool indirect_requested{};
+	bool use_indirect{};
+	bool has_multi_draw_indirect{};
+	uint32_t max_draw_indirect_count{ 1 };
+	std::unique_ptr<ZVK_StreamBuffer> indirect_stream;
+	/* The commands of the current frame, in the mapped stream. */
+	const vk::DrawIndexedIndirectCommand* frame_commands{};
+	void write_DrawCommands();
+	void record_Draws(vk::CommandBuffer cmd);
+
+	ZVK_Handle<vk::QueryPool> timestamp_pool;
+	/* Nanoseconds per timestamp tick, 0 if the queue has no timestamps. */
+	double timestamp_period{};
+	uint64_t timestamp_mask{};
+	frame_timing last_frame_timing{};
+	void create_TimestampPool();
+
+	ZVK_Handle<vk::Pipeline> pipeline;
+	ZVK_Handle<vk::PipelineCache> pipeline_cache;
 	bool init_pipeline_cache();
 
-	vk::Semaphore image_acquired_semaphore{};
+	ZVK_Handle<vk::Semaphore> image_acquired_semaphore;
+	ZVK_Handle<vk::Fence> frame_fence;
+	uint64_t frame_index{};
 	const size_t currect_command_buffer{ 0 };
 	bool create_Semaphore();
-	void set_image_layout(vk::Image& image, vk::ImageAspectFlags aspectMask, vk::ImageLayout old_image_layout, vk::ImageLayout new_image_layout);
+	void set_image_layout(vk::Image image, vk::ImageAspectFlags aspectMask, vk::ImageLayout old_image_layout, vk::ImageLayout new_image_layout);
 
 	vk::Viewport viewport{};
 	vk::Rect2D scissor{};
@@ -0,0 +1,138 @@
+/* ZVK_BindlessTable.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_BindlessTable.h"
+#include <stdexcept>
+#include <algorithm>
+#include <vector>
+
+bool ZVK_BindlessTable::is_Supported(const vk::PhysicalDeviceFeatures& features)
+{
+	return features.shaderStorageBufferArrayDynamicIndexing ? true : false;
+}
+
+uint32_t ZVK_BindlessTable::get_BuffersQty(const vk::PhysicalDeviceLimits& limits)
+{
+	return std::min({ max_slots,
+		limits.maxPerStageDescriptorStorageBuffers,
+		limits.maxDescriptorSetStorageBuffers });
+}
+
+ZVK_BindlessTable::ZVK_BindlessTable(vk::Device device, const vk::PhysicalDeviceLimits& limits)
+	: device(device)
+	, buffers_qty(get_BuffersQty(limits))
+{
+	vk::DescriptorSetLayoutBinding binding{};
+	binding.binding = 0;
+	binding.descriptorType = vk::DescriptorType::eStorageBuffer;
+	binding.descriptorCount = buffers_qty;
+	binding.stageFlags = vk::ShaderStageFlagBits::eVertex;
+
+	vk::DescriptorSetLayoutCreateInfo layout_info{};
+	layout_info.bindingCount = 1;
+	layout_info.pBindings = &binding;
+
+	layout = device.createDescriptorSetLayout(layout_info);
+	if (!layout)
+	{
+		throw std::domain_error{ "Bindless Descriptor Set Layout was not created" };
+	}
+
+	vk::DescriptorPoolSize size{};
+	size.type = vk::DescriptorType::eStorageBuffer;
+	size.descriptorCount = buffers_qty;
+
+	vk::DescriptorPoolCreateInfo pool_info{};
+	pool_info.maxSets = 1;
+	pool_info.poolSizeCount = 1;
+	pool_info.pPoolSizes = &size;
+
+	pool = device.createDescriptorPool(pool_info);
+	if (!pool)
+	{
+		throw std::domain_error{ "Bindless DescriptorPool was not created" };
+	}
+
+	vk::DescriptorSetAllocateInfo alloc_info{};
+	alloc_info.descriptorPool = pool;
+	alloc_info.descriptorSetCount = 1;
+	alloc_info.pSetLayouts = &layout;
+
+	if (vk::Result::eSuccess != device.allocateDescriptorSets(&alloc_info, &set))
+	{
+		throw std::domain_error{ "Bindless Descriptor Set was not allocated" };
+	}
+}
+
+ZVK_BindlessTable::~ZVK_BindlessTable()
+{
+	if (pool)
+	{
+		device.destroyDescriptorPool(pool);
+	}
+	if (layout)
+	{
+		device.destroyDescriptorSetLayout(layout);
+	}
+}
+
+uint32_t ZVK_BindlessTable::add_Buffer(vk::Buffer buffer, vk::DeviceSize offset, vk::DeviceSize range)
+{
+	if (next_buffer == buffers_qty)
+	{
+		throw std::domain_error{ "Bindless table has no free buffer slot" };
+	}
+
+	vk::DescriptorBufferInfo info{ buffer, offset, range };
+	if (!next_buffer)
+	{
+		// The first buffer stands in for all free slots.
+		std::vector<vk::DescriptorBufferInfo> infos(buffers_qty, info);
+		write(0, buffers_qty, infos.data());
+	}
+	else
+	{
+		write(next_buffer, 1, &info);
+	}
+
+	return next_buffer++;
+}
+
+void ZVK_BindlessTable::write(uint32_t first, uint32_t count, const vk::DescriptorBufferInfo* buffer_info)
+{
+	vk::WriteDescriptorSet write{};
+	write.dstSet = set;
+	write.dstBinding = 0;
+	write.dstArrayElement = first;
+	write.descriptorCount = count;
+	write.descriptorType = vk::DescriptorType::eStorageBuffer;
+	write.pBufferInfo = buffer_info;
+
+	device.updateDescriptorSets(1, &write, 0, nullptr);
+}
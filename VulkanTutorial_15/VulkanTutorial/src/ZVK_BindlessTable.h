@@ -0,0 +1,77 @@
+/* ZVK_BindlessTable.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_BindlessTable_h
+#define ZVK_BindlessTable_h
+
+#include <vulkan/vulkan.hpp>
+
+/* One descriptor set holding a big array of storage buffers. It is     */
+/* bound once per frame, shaders index the array with a per-draw index  */
+/* from push constants, so no descriptor set is bound per draw.         */
+/*                                                                      */
+/* Without descriptor indexing (our Vulkan headers predate it) the      */
+/* array is indexed dynamically, which needs the shaderStorageBuffer-   */
+/* ArrayDynamicIndexing feature, and every array element must hold a    */
+/* valid descriptor: the first registered buffer fills all free slots.  */
+class ZVK_BindlessTable
+{
+public:
+	static const uint32_t max_slots = 256;
+
+	/* Whether the device supports this mode at all. */
+	static bool is_Supported(const vk::PhysicalDeviceFeatures& features);
+	/* Array size which fits into the device limits. */
+	static uint32_t get_BuffersQty(const vk::PhysicalDeviceLimits& limits);
+
+	ZVK_BindlessTable(vk::Device device, const vk::PhysicalDeviceLimits& limits);
+	~ZVK_BindlessTable();
+
+	ZVK_BindlessTable(const ZVK_BindlessTable&) = delete;
+	ZVK_BindlessTable& operator=(const ZVK_BindlessTable&) = delete;
+
+	/* Returns the index shaders use to reach the buffer. */
+	uint32_t add_Buffer(vk::Buffer buffer, vk::DeviceSize offset, vk::DeviceSize range);
+
+	vk::DescriptorSetLayout get_Layout() const { return layout; }
+	vk::DescriptorSet get_Set() const { return set; }
+	uint32_t get_BuffersQty() const { return buffers_qty; }
+private:
+	void write(uint32_t first, uint32_t count, const vk::DescriptorBufferInfo* buffer_info);
+
+	vk::Device device;
+	uint32_t buffers_qty{};
+	uint32_t next_buffer{};
+
+	vk::DescriptorSetLayout layout{};
+	vk::DescriptorPool pool{};
+	vk::DescriptorSet set{};
+};
+
+#endif // !ZVK_BindlessTable_h
@@ -0,0 +1,251 @@
+/* ZVK_BufferUploader.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_BufferUploader.h"
+#include "ZVK_Memory.h"
+#include <stdexcept>
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+
+ZVK_BufferUploader::ZVK_BufferUploader(vk::Device device, vk::PhysicalDevice gpu, uint32_t queue_family_index,
+	vk::DeviceSize ring_size)
+	: device(device)
+	, memory_properties(gpu.getMemoryProperties())
+	, queue(device.getQueue(queue_family_index, 0))
+	, ring_size(ring_size)
+	, batch_ends(batches_qty, 0)
+{
+	vk::BufferCreateInfo buf_info{};
+	buf_info.usage = vk::BufferUsageFlagBits::eTransferSrc;
+	buf_info.size = ring_size;
+	buf_info.sharingMode = vk::SharingMode::eExclusive;
+	ring_buffer = ZVK_Handle<vk::Buffer>(device, device.createBuffer(buf_info));
+	if (!ring_buffer)
+	{
+		throw std::domain_error{ "Staging Ring Buffer cannot be created" };
+	}
+
+	ring_data = static_cast<uint8_t*>(ZVK_Memory::map_Buffer(device, memory_properties, ring_buffer, ring_memory, "Staging Ring"));
+
+	vk::CommandPoolCreateInfo cmd_pool_info{};
+	cmd_pool_info.queueFamilyIndex = queue_family_index;
+	cmd_pool_info.flags = vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer;
+	cmd_pool = ZVK_Handle<vk::CommandPool>(device, device.createCommandPool(cmd_pool_info));
+	if (!cmd_pool)
+	{
+		throw std::domain_error{ "Upload CommandPool was not created" };
+	}
+
+	vk::CommandBufferAllocateInfo cmd_info{};
+	cmd_info.commandPool = cmd_pool;
+	cmd_info.level = vk::CommandBufferLevel::ePrimary;
+	cmd_info.commandBufferCount = static_cast<uint32_t>(batches_qty);
+	cmds = device.allocateCommandBuffers(cmd_info);
+
+	for (size_t i = 0; i < batches_qty; ++i)
+	{
+		fences.push_back(ZVK_Handle<vk::Fence>(device, device.createFence(vk::FenceCreateInfo{})));
+		idle.push_back(batches_qty - 1 - i);
+	}
+}
+
+ZVK_BufferUploader::~ZVK_BufferUploader()
+{
+	// The ring and the command buffers must outlive the copies.
+	try
+	{
+		flush();
+	}
+	catch (...)
+	{
+		device.waitIdle();
+	}
+}
+
+ZVK_Handle<vk::Buffer> ZVK_BufferUploader::create_Buffer(vk::DeviceSize size, vk::BufferUsageFlags usage,
+	ZVK_Handle<vk::DeviceMemory>& memory) const
+{
+	vk::BufferCreateInfo buf_info{};
+	buf_info.usage = usage | vk::BufferUsageFlagBits::eTransferDst;
+	buf_info.size = size;
+	buf_info.sharingMode = vk::SharingMode::eExclusive;
+	ZVK_Handle<vk::Buffer> buffer(device, device.createBuffer(buf_info));
+	if (!buffer)
+	{
+		throw std::domain_error{ "Upload Buffer cannot be created" };
+	}
+
+	memory = ZVK_Memory::allocate(device, memory_properties, device.getBufferMemoryRequirements(buffer),
+		vk::MemoryPropertyFlagBits::eDeviceLocal);
+	if (!memory)
+	{
+		throw std::domain_error{ "Upload Buffer Memory cannot be allocated" };
+	}
+	device.bindBufferMemory(buffer, memory, 0);
+
+	return buffer;
+}
+
+void ZVK_BufferUploader::upload(vk::Buffer dst, vk::DeviceSize dst_offset, const void* data, vk::DeviceSize size)
+{
+	typedef std::chrono::high_resolution_clock clock;
+	auto start = clock::now();
+
+	// Half a ring at most, so a chunk always fits after a wrap.
+	const vk::DeviceSize chunk_size = ring_size / 2;
+	const uint8_t* src = static_cast<const uint8_t*>(data);
+	for (vk::DeviceSize done = 0; done < size;)
+	{
+		const vk::DeviceSize chunk = std::min(chunk_size, size - done);
+		const vk::DeviceSize offset = allocate(chunk);
+		memcpy(ring_data + offset, src + done, static_cast<size_t>(chunk));
+
+		vk::BufferCopy region{ offset, dst_offset + done, chunk };
+		open_Batch().copyBuffer(ring_buffer, dst, 1, &region);
+		done += chunk;
+	}
+
+	stats.bytes += size;
+	stats.seconds += std::chrono::duration<double>(clock::now() - start).count();
+}
+
+void ZVK_BufferUploader::flush()
+{
+	typedef std::chrono::high_resolution_clock clock;
+	auto start = clock::now();
+
+	submit();
+	while (submitted.size())
+	{
+		retire_Oldest();
+	}
+
+	stats.seconds += std::chrono::duration<double>(clock::now() - start).count();
+}
+
+vk::DeviceSize ZVK_BufferUploader::allocate(vk::DeviceSize size)
+{
+	const uint64_t alignment = 16;
+	uint64_t start = (head + alignment - 1) / alignment * alignment;
+	if (start % ring_size + size > ring_size)
+	{
+		// Skips the rest of the lap, the data must be contiguous.
+		start = (start + ring_size - 1) / ring_size * ring_size;
+	}
+
+	while (start + size - tail > ring_size)
+	{
+		if (!submitted.size())
+		{
+			// Only the open batch holds ring space.
+			submit();
+		}
+		if (!submitted.size())
+		{
+			tail = head;
+			break;
+		}
+		++stats.stalls;
+		retire_Oldest();
+	}
+
+	head = start + size;
+	return static_cast<vk::DeviceSize>(start % ring_size);
+}
+
+vk::CommandBuffer ZVK_BufferUploader::open_Batch()
+{
+	if (batches_qty != recording)
+	{
+		return cmds[recording];
+	}
+
+	if (!idle.size())
+	{
+		retire_Oldest();
+	}
+	recording = idle.back();
+	idle.pop_back();
+
+	vk::CommandBufferBeginInfo begin_info{};
+	begin_info.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
+	cmds[recording].begin(begin_info);
+	return cmds[recording];
+}
+
+void ZVK_BufferUploader::submit()
+{
+	if (batches_qty == recording)
+	{
+		return;
+	}
+
+	// Makes the copies visible to any later read of the buffers.
+	vk::MemoryBarrier barrier{};
+	barrier.srcAccessMask = vk::AccessFlagBits::eTransferWrite;
+	barrier.dstAccessMask = vk::AccessFlagBits::eMemoryRead;
+	cmds[recording].pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eAllCommands,
+		vk::DependencyFlags{}, 1, &barrier, 0, nullptr, 0, nullptr);
+	cmds[recording].end();
+
+	vk::SubmitInfo submit_info{};
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers = &cmds[recording];
+
+	device.resetFences(1, fences[recording].ptr());
+	if (vk::Result::eSuccess != queue.submit(1, &submit_info, fences[recording]))
+	{
+		throw std::domain_error{ "Problem while submitting a buffer upload" };
+	}
+
+	batch_ends[recording] = head;
+	submitted.push_back(recording);
+	recording = batches_qty;
+	++stats.batches;
+}
+
+void ZVK_BufferUploader::retire_Oldest()
+{
+	const size_t oldest = submitted.front();
+
+	vk::Result res{};
+	do {
+		res = device.waitForFences(1, fences[oldest].ptr(), VK_TRUE, 100000000);
+	} while (res == vk::Result::eTimeout);
+	if (vk::Result::eSuccess != res)
+	{
+		throw std::domain_error{ "Problem while uploading a buffer" };
+	}
+
+	tail = batch_ends[oldest];
+	submitted.pop_front();
+	idle.push_back(oldest);
+}
+
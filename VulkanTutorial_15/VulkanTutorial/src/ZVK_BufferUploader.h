@@ -0,0 +1,112 @@
+/* ZVK_BufferUploader.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_BufferUploader_h
+#define ZVK_BufferUploader_h
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <deque>
+
+#include "ZVK_Handle.h"
+
+/* Uploads data into device local buffers through a staging ring: a host   */
+/* visible buffer that stays mapped. Sources are copied once, straight     */
+/* into the ring, so a memory mapped file goes from its pages to the GPU   */
+/* without intermediate copies. Staged copies are recorded into the open   */
+/* batch; a full ring submits it and reuses the space of the oldest        */
+/* submitted batch as soon as its fence signals, so filling the ring and   */
+/* GPU copies overlap.                                                     */
+/* Submits to the queue of the given family, the caller must not use that  */
+/* queue from another thread during an upload.                             */
+class ZVK_BufferUploader
+{
+public:
+	struct statistics
+	{
+		vk::DeviceSize bytes;
+		size_t batches;
+		/* Times the ring was full and had to wait for the GPU. */
+		size_t stalls;
+		double seconds;
+
+		double megabytes_per_second() const { return seconds > 0.0 ? bytes / (1024.0 * 1024.0) / seconds : 0.0; }
+	};
+
+	ZVK_BufferUploader(vk::Device device, vk::PhysicalDevice gpu, uint32_t queue_family_index,
+		vk::DeviceSize ring_size = 8 * 1024 * 1024);
+	~ZVK_BufferUploader();
+
+	ZVK_BufferUploader(const ZVK_BufferUploader&) = delete;
+	ZVK_BufferUploader& operator=(const ZVK_BufferUploader&) = delete;
+
+	/* A device local buffer the uploads can be copied into. */
+	ZVK_Handle<vk::Buffer> create_Buffer(vk::DeviceSize size, vk::BufferUsageFlags usage, ZVK_Handle<vk::DeviceMemory>& memory) const;
+
+	/* Stages size bytes of data for a copy into dst at dst_offset; */
+	/* sources larger than the ring are split.                      */
+	void upload(vk::Buffer dst, vk::DeviceSize dst_offset, const void* data, vk::DeviceSize size);
+	/* Submits the open batch and waits for every submitted one. */
+	void flush();
+
+	statistics get_Statistics() const { return stats; }
+private:
+	/* Ring offset of size free bytes, waits for the GPU if it has to. */
+	vk::DeviceSize allocate(vk::DeviceSize size);
+	vk::CommandBuffer open_Batch();
+	void submit();
+	void retire_Oldest();
+
+	vk::Device device;
+	vk::PhysicalDeviceMemoryProperties memory_properties;
+	vk::Queue queue;
+
+	ZVK_Handle<vk::Buffer> ring_buffer;
+	ZVK_Handle<vk::DeviceMemory> ring_memory;
+	vk::DeviceSize ring_size;
+	uint8_t* ring_data{};
+	/* Bytes ever staged and ever released, their difference is in use. */
+	uint64_t head{};
+	uint64_t tail{};
+
+	/* Batches are indices into these, every one has a command buffer, */
+	/* a fence and the head of the ring when it was submitted.         */
+	static const size_t batches_qty = 4;
+	ZVK_Handle<vk::CommandPool> cmd_pool;
+	std::vector<vk::CommandBuffer> cmds;
+	std::vector<ZVK_Handle<vk::Fence>> fences;
+	std::vector<uint64_t> batch_ends;
+	std::vector<size_t> idle;
+	std::deque<size_t> submitted;
+	size_t recording{ batches_qty };
+
+	statistics stats{};
+};
+
+#endif // !ZVK_BufferUploader_h
@@ -0,0 +1,81 @@
+/* ZVK_DeletionQueue.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_DeletionQueue_h
+#define ZVK_DeletionQueue_h
+
+#include <deque>
+#include <functional>
+#include <cstdint>
+
+#include "ZVK_Handle.h"
+
+/* Destroys retired objects only after the frame which used them last    */
+/* has completed on the GPU, so a resource can be replaced while frames  */
+/* are in flight without waiting for the device to become idle.          */
+class ZVK_DeletionQueue
+{
+public:
+	ZVK_DeletionQueue() {}
+	~ZVK_DeletionQueue() { flush(); }
+
+	ZVK_DeletionQueue(const ZVK_DeletionQueue&) = delete;
+	ZVK_DeletionQueue& operator=(const ZVK_DeletionQueue&) = delete;
+
+	template <typename T>
+	void retire(ZVK_Handle<T>&& handle, uint64_t last_used_frame)
+	{
+		if (!handle)
+		{
+			return;
+		}
+
+		auto parent = handle.get_Parent();
+		T h = handle.release();
+		retired.push_back(entry{ last_used_frame, [parent, h] { ZVK_HandleTraits<T>::destroy(parent, h); } });
+	}
+
+	/* Frames are completed in order, so the queue is ordered by frame. */
+	void collect(uint64_t completed_frame);
+
+	/* Destroys everything, the device must be idle. */
+	void flush();
+
+	size_t size() const { return retired.size(); }
+private:
+	struct entry
+	{
+		uint64_t frame;
+		std::function<void()> destroy;
+	};
+
+	std::deque<entry> retired;
+};
+
+#endif // !ZVK_DeletionQueue_h
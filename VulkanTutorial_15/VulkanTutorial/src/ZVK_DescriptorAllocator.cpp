@@ -0,0 +1,177 @@
+/* ZVK_DescriptorAllocator.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_DescriptorAllocator.h"
+#include <stdexcept>
+#include <algorithm>
+
+namespace
+{
+	// Pools grow twice on each exhaustion up to this number of sets.
+	const uint32_t max_pool_sets = 4096;
+
+	// VK_ERROR_OUT_OF_POOL_MEMORY_KHR of VK_KHR_maintenance1, newer than
+	// the Vulkan headers of this project.
+	const vk::Result error_out_of_pool_memory = static_cast<vk::Result>(-1000069000);
+}
+
+const std::vector<ZVK_DescriptorAllocator::pool_size_ratio> ZVK_DescriptorAllocator::default_ratios{
+	{ vk::DescriptorType::eUniformBuffer, 2.0f },
+	{ vk::DescriptorType::eUniformBufferDynamic, 1.0f },
+	{ vk::DescriptorType::eStorageBuffer, 1.0f },
+	{ vk::DescriptorType::eCombinedImageSampler, 4.0f },
+	{ vk::DescriptorType::eSampledImage, 1.0f },
+	{ vk::DescriptorType::eSampler, 0.5f },
+	{ vk::DescriptorType::eStorageImage, 0.5f },
+};
+
+ZVK_DescriptorAllocator::ZVK_DescriptorAllocator(vk::Device device, uint32_t sets_per_pool,
+	const std::vector<pool_size_ratio>& ratios)
+	: device(device)
+	, ratios(ratios)
+	, next_pool_sets(std::max<uint32_t>(sets_per_pool, 1))
+{
+	if (!device)
+	{
+		throw std::domain_error{ "Descriptor Allocator needs a Logical Device" };
+	}
+}
+
+ZVK_DescriptorAllocator::~ZVK_DescriptorAllocator()
+{
+	for (auto p : used_pools)
+	{
+		device.destroyDescriptorPool(p);
+	}
+	for (auto p : free_pools)
+	{
+		device.destroyDescriptorPool(p);
+	}
+}
+
+vk::DescriptorSet ZVK_DescriptorAllocator::allocate(vk::DescriptorSetLayout layout)
+{
+	return allocate(std::vector<vk::DescriptorSetLayout>{ layout })[0];
+}
+
+std::vector<vk::DescriptorSet> ZVK_DescriptorAllocator::allocate(const std::vector<vk::DescriptorSetLayout>& layouts)
+{
+	std::vector<vk::DescriptorSet> sets(layouts.size());
+	if (!layouts.size())
+	{
+		return sets;
+	}
+
+	if (!current_pool)
+	{
+		current_pool = grab_pool();
+	}
+
+	vk::DescriptorSetAllocateInfo alloc_info{};
+	alloc_info.descriptorPool = current_pool;
+	alloc_info.descriptorSetCount = static_cast<uint32_t>(layouts.size());
+	alloc_info.pSetLayouts = layouts.data();
+
+	vk::Result res = device.allocateDescriptorSets(&alloc_info, sets.data());
+	if (is_pool_exhausted(res))
+	{
+		// The current pool is full, continue with a new one.
+		current_pool = grab_pool();
+		alloc_info.descriptorPool = current_pool;
+		res = device.allocateDescriptorSets(&alloc_info, sets.data());
+	}
+
+	if (vk::Result::eSuccess != res)
+	{
+		throw std::domain_error{ "Descriptor Sets were not allocated" };
+	}
+
+	allocated_qty += sets.size();
+
+	return sets;
+}
+
+void ZVK_DescriptorAllocator::reset()
+{
+	for (auto p : used_pools)
+	{
+		device.resetDescriptorPool(p);
+		free_pools.push_back(p);
+	}
+	used_pools.clear();
+	current_pool = nullptr;
+	allocated_qty = 0;
+}
+
+vk::DescriptorPool ZVK_DescriptorAllocator::grab_pool()
+{
+	vk::DescriptorPool pool{};
+	if (free_pools.size())
+	{
+		pool = free_pools.back();
+		free_pools.pop_back();
+	}
+	else
+	{
+		pool = create_pool(next_pool_sets);
+		next_pool_sets = std::min(next_pool_sets * 2, max_pool_sets);
+	}
+
+	used_pools.push_back(pool);
+
+	return pool;
+}
+
+vk::DescriptorPool ZVK_DescriptorAllocator::create_pool(uint32_t max_sets)
+{
+	std::vector<vk::DescriptorPoolSize> sizes;
+	for (auto& r : ratios)
+	{
+		uint32_t count = static_cast<uint32_t>(r.ratio * max_sets);
+		sizes.push_back(vk::DescriptorPoolSize{ r.type, count ? count : 1 });
+	}
+
+	vk::DescriptorPoolCreateInfo desc_pool_info{};
+	desc_pool_info.maxSets = max_sets;
+	desc_pool_info.poolSizeCount = static_cast<uint32_t>(sizes.size());
+	desc_pool_info.pPoolSizes = sizes.data();
+
+	vk::DescriptorPool pool = device.createDescriptorPool(desc_pool_info);
+	if (!pool)
+	{
+		throw std::domain_error{ "DescriptorPool was not created" };
+	}
+
+	return pool;
+}
+
+bool ZVK_DescriptorAllocator::is_pool_exhausted(vk::Result res) const
+{
+	return vk::Result::eErrorFragmentedPool == res || error_out_of_pool_memory == res;
+}
@@ -0,0 +1,82 @@
+/* ZVK_DescriptorAllocator.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_DescriptorAllocator_h
+#define ZVK_DescriptorAllocator_h
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+
+/* Allocates descriptor sets from a growing list of descriptor pools.     */
+/* Every pool is sized by sets_per_pool and per-type ratios (descriptors  */
+/* of a type per set). When the current pool runs out of memory or is     */
+/* fragmented, a new, bigger pool is taken. reset() returns all pools at  */
+/* once, which is how transient per-frame sets are released.              */
+class ZVK_DescriptorAllocator
+{
+public:
+	struct pool_size_ratio
+	{
+		vk::DescriptorType type;
+		float ratio;
+	};
+
+	static const std::vector<pool_size_ratio> default_ratios;
+
+	ZVK_DescriptorAllocator(vk::Device device, uint32_t sets_per_pool = 64,
+		const std::vector<pool_size_ratio>& ratios = default_ratios);
+	~ZVK_DescriptorAllocator();
+
+	ZVK_DescriptorAllocator(const ZVK_DescriptorAllocator&) = delete;
+	ZVK_DescriptorAllocator& operator=(const ZVK_DescriptorAllocator&) = delete;
+
+	vk::DescriptorSet allocate(vk::DescriptorSetLayout layout);
+	std::vector<vk::DescriptorSet> allocate(const std::vector<vk::DescriptorSetLayout>& layouts);
+
+	/* All sets allocated so far become invalid. */
+	void reset();
+
+	size_t get_PoolsQty() const { return used_pools.size() + free_pools.size(); }
+	size_t get_AllocatedQty() const { return allocated_qty; }
+private:
+	vk::DescriptorPool grab_pool();
+	vk::DescriptorPool create_pool(uint32_t max_sets);
+	bool is_pool_exhausted(vk::Result res) const;
+
+	vk::Device device;
+	std::vector<pool_size_ratio> ratios;
+	uint32_t next_pool_sets;
+
+	vk::DescriptorPool current_pool{};
+	std::vector<vk::DescriptorPool> used_pools;
+	std::vector<vk::DescriptorPool> free_pools;
+	size_t allocated_qty{};
+};
+
+#endif // !ZVK_DescriptorAllocator_h
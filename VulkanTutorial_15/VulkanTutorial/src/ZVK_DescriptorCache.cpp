@@ -0,0 +1,215 @@
+/* ZVK_DescriptorCache.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_DescriptorCache.h"
+#include "ZVK_Hash.h"
+#include <cstring>
+
+ZVK_DescriptorCache::resource ZVK_DescriptorCache::resource::buffer(uint32_t binding,
+	vk::DescriptorType type, vk::Buffer buffer, vk::DeviceSize offset, vk::DeviceSize range)
+{
+	ZVK_DescriptorCache::resource r{};
+	r.binding = binding;
+	r.array_element = 0;
+	r.type = type;
+	r.buffer_info = vk::DescriptorBufferInfo{ buffer, offset, range };
+	return r;
+}
+
+ZVK_DescriptorCache::resource ZVK_DescriptorCache::resource::image(uint32_t binding,
+	vk::DescriptorType type, vk::Sampler sampler, vk::ImageView view, vk::ImageLayout layout)
+{
+	ZVK_DescriptorCache::resource r{};
+	r.binding = binding;
+	r.array_element = 0;
+	r.type = type;
+	r.image_info = vk::DescriptorImageInfo{ sampler, view, layout };
+	return r;
+}
+
+bool ZVK_DescriptorCache::resource::operator==(const resource& rhs) const
+{
+	return binding == rhs.binding
+		&& array_element == rhs.array_element
+		&& type == rhs.type
+		&& buffer_info == rhs.buffer_info
+		&& image_info == rhs.image_info;
+}
+
+ZVK_DescriptorCache::ZVK_DescriptorCache(vk::Device device, ZVK_DescriptorAllocator& allocator, size_t capacity)
+	: device(device)
+	, allocator(allocator)
+	, capacity(capacity)
+{
+}
+
+void ZVK_DescriptorCache::set_Template(vk::DescriptorSetLayout layout, const ZVK_DescriptorUpdateTemplate* update_template)
+{
+	templates[static_cast<VkDescriptorSetLayout>(layout)] = update_template;
+}
+
+vk::DescriptorSet ZVK_DescriptorCache::get(vk::DescriptorSetLayout layout, const std::vector<resource>& resources)
+{
+	key k;
+	k.layout = static_cast<VkDescriptorSetLayout>(layout);
+	k.resources = resources;
+	k.hash = compute_hash(k.layout, resources);
+
+	auto found = entries.find(k);
+	if (found != entries.end())
+	{
+		++hits;
+		found->second->last_used_frame = current_frame;
+		lru.splice(lru.begin(), lru, found->second);
+		return found->second->set;
+	}
+
+	++misses;
+
+	entry e;
+	e.set = acquire_set(k.layout);
+	e.last_used_frame = current_frame;
+	write_set(k.layout, e.set, resources);
+	e.k = std::move(k);
+
+	lru.push_front(std::move(e));
+	entries.emplace(lru.front().k, lru.begin());
+
+	return lru.front().set;
+}
+
+void ZVK_DescriptorCache::begin_frame(uint64_t frame)
+{
+	current_frame = frame;
+}
+
+void ZVK_DescriptorCache::frame_completed(uint64_t frame)
+{
+	// Evict least recently used entries, but never one the GPU may
+	// still read: those used by a frame later than the completed one.
+	while (entries.size() > capacity && lru.back().last_used_frame <= frame)
+	{
+		entry& e = lru.back();
+		free_sets[e.k.layout].push_back(e.set);
+		entries.erase(e.k);
+		lru.pop_back();
+		++evictions;
+	}
+}
+
+ZVK_DescriptorCache::statistics ZVK_DescriptorCache::get_Statistics() const
+{
+	statistics s{};
+	s.hits = hits;
+	s.misses = misses;
+	s.evictions = evictions;
+	s.entries = entries.size();
+	return s;
+}
+
+size_t ZVK_DescriptorCache::compute_hash(VkDescriptorSetLayout layout, const std::vector<resource>& resources)
+{
+	size_t seed = 0;
+	hash_handle(seed, layout);
+	for (auto& b : resources)
+	{
+		hash_combine(seed, b.binding);
+		hash_combine(seed, b.array_element);
+		hash_combine(seed, static_cast<uint32_t>(b.type));
+		hash_handle(seed, static_cast<VkBuffer>(b.buffer_info.buffer));
+		hash_combine(seed, b.buffer_info.offset);
+		hash_combine(seed, b.buffer_info.range);
+		hash_handle(seed, static_cast<VkSampler>(b.image_info.sampler));
+		hash_handle(seed, static_cast<VkImageView>(b.image_info.imageView));
+		hash_combine(seed, static_cast<uint32_t>(b.image_info.imageLayout));
+	}
+	return seed;
+}
+
+vk::DescriptorSet ZVK_DescriptorCache::acquire_set(VkDescriptorSetLayout layout)
+{
+	auto& recycled = free_sets[layout];
+	if (recycled.size())
+	{
+		vk::DescriptorSet set = recycled.back();
+		recycled.pop_back();
+		return set;
+	}
+
+	return allocator.allocate(vk::DescriptorSetLayout(layout));
+}
+
+void ZVK_DescriptorCache::write_set(VkDescriptorSetLayout layout, vk::DescriptorSet set, const std::vector<resource>& resources)
+{
+	// A template writes the whole set, so every descriptor must be listed.
+	auto found = templates.find(layout);
+	if (found != templates.end() && found->second && found->second->get_DescriptorsQty() == resources.size())
+	{
+		const ZVK_DescriptorUpdateTemplate& update_template = *found->second;
+		template_data.assign(update_template.get_DataSize(), 0);
+		for (auto& r : resources)
+		{
+			uint8_t* at = template_data.data() + update_template.get_Offset(r.binding);
+			if (ZVK_DescriptorUpdateTemplate::is_Buffer(r.type))
+			{
+				memcpy(at + r.array_element * sizeof(r.buffer_info), &r.buffer_info, sizeof(r.buffer_info));
+			}
+			else
+			{
+				memcpy(at + r.array_element * sizeof(r.image_info), &r.image_info, sizeof(r.image_info));
+			}
+		}
+		update_template.update(set, template_data.data());
+		return;
+	}
+
+	std::vector<vk::WriteDescriptorSet> writes(resources.size());
+	for (size_t i = 0; i < resources.size(); ++i)
+	{
+		writes[i].dstSet = set;
+		writes[i].dstBinding = resources[i].binding;
+		writes[i].dstArrayElement = resources[i].array_element;
+		writes[i].descriptorCount = 1;
+		writes[i].descriptorType = resources[i].type;
+		switch (resources[i].type)
+		{
+		case vk::DescriptorType::eUniformBuffer:
+		case vk::DescriptorType::eStorageBuffer:
+		case vk::DescriptorType::eUniformBufferDynamic:
+		case vk::DescriptorType::eStorageBufferDynamic:
+			writes[i].pBufferInfo = &resources[i].buffer_info;
+			break;
+		default:
+			writes[i].pImageInfo = &resources[i].image_info;
+			break;
+		}
+	}
+
+	device.updateDescriptorSets(static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+}
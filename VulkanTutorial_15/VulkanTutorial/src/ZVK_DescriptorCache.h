@@ -0,0 +1,141 @@
+/* ZVK_DescriptorCache.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_DescriptorCache_h
+#define ZVK_DescriptorCache_h
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <list>
+#include <unordered_map>
+
+#include "ZVK_DescriptorAllocator.h"
+#include "ZVK_DescriptorUpdateTemplate.h"
+
+/* Returns an already written descriptor set when the same layout is      */
+/* requested with the same bound buffers/images/samplers and ranges.      */
+/* Entries are kept in LRU order; an entry may be evicted only after the  */
+/* frame which used it last has completed on the GPU. Sets of evicted     */
+/* entries are recycled for the next miss with the same layout. Sets of   */
+/* layouts with an update template are written through it.               */
+class ZVK_DescriptorCache
+{
+public:
+	/* One descriptor to write: a buffer range or an image/sampler. */
+	struct resource
+	{
+		uint32_t binding;
+		uint32_t array_element;
+		vk::DescriptorType type;
+		vk::DescriptorBufferInfo buffer_info;
+		vk::DescriptorImageInfo image_info;
+
+		static resource buffer(uint32_t binding, vk::DescriptorType type,
+			vk::Buffer buffer, vk::DeviceSize offset, vk::DeviceSize range);
+		static resource image(uint32_t binding, vk::DescriptorType type,
+			vk::Sampler sampler, vk::ImageView view, vk::ImageLayout layout);
+
+		bool operator==(const resource& rhs) const;
+	};
+
+	struct statistics
+	{
+		size_t hits;
+		size_t misses;
+		size_t evictions;
+		size_t entries;
+
+		double hit_rate() const { return hits + misses ? double(hits) / (hits + misses) : 0.0; }
+	};
+
+	ZVK_DescriptorCache(vk::Device device, ZVK_DescriptorAllocator& allocator, size_t capacity = 1024);
+
+	ZVK_DescriptorCache(const ZVK_DescriptorCache&) = delete;
+	ZVK_DescriptorCache& operator=(const ZVK_DescriptorCache&) = delete;
+
+	/* Misses of the layout which list every descriptor of the template */
+	/* are written through it. The template must outlive the cache.     */
+	void set_Template(vk::DescriptorSetLayout layout, const ZVK_DescriptorUpdateTemplate* update_template);
+
+	vk::DescriptorSet get(vk::DescriptorSetLayout layout, const std::vector<resource>& resources);
+
+	/* Sets returned by get() from now on are used by this frame. */
+	void begin_frame(uint64_t frame);
+	/* The GPU has finished the frame, entries last used by it or */
+	/* earlier may be evicted when the cache is over capacity.     */
+	void frame_completed(uint64_t frame);
+
+	statistics get_Statistics() const;
+private:
+	struct key
+	{
+		VkDescriptorSetLayout layout;
+		std::vector<resource> resources;
+		size_t hash;
+
+		bool operator==(const key& rhs) const
+		{
+			return hash == rhs.hash && layout == rhs.layout && resources == rhs.resources;
+		}
+	};
+	struct key_hash
+	{
+		size_t operator()(const key& k) const { return k.hash; }
+	};
+	struct entry
+	{
+		key k;
+		vk::DescriptorSet set;
+		uint64_t last_used_frame;
+	};
+	typedef std::list<entry> lru_list;
+
+	static size_t compute_hash(VkDescriptorSetLayout layout, const std::vector<resource>& resources);
+	vk::DescriptorSet acquire_set(VkDescriptorSetLayout layout);
+	void write_set(VkDescriptorSetLayout layout, vk::DescriptorSet set, const std::vector<resource>& resources);
+
+	vk::Device device;
+	ZVK_DescriptorAllocator& allocator;
+	size_t capacity;
+	uint64_t current_frame{};
+
+	// Most recently used entries are at the front.
+	lru_list lru;
+	std::unordered_map<key, lru_list::iterator, key_hash> entries;
+	std::unordered_map<VkDescriptorSetLayout, std::vector<vk::DescriptorSet>> free_sets;
+	std::unordered_map<VkDescriptorSetLayout, const ZVK_DescriptorUpdateTemplate*> templates;
+	// Packed descriptors of the set written through a template.
+	std::vector<uint8_t> template_data;
+
+	size_t hits{};
+	size_t misses{};
+	size_t evictions{};
+};
+
+#endif // !ZVK_DescriptorCache_h
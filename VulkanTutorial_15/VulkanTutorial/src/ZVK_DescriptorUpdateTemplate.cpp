@@ -0,0 +1,151 @@
+/* ZVK_DescriptorUpdateTemplate.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_DescriptorUpdateTemplate.h"
+#include <stdexcept>
+
+namespace
+{
+	const VkStructureType structure_type_create_info = static_cast<VkStructureType>(1000085000);
+	const uint32_t template_type_descriptor_set = 0;
+}
+
+const char* ZVK_DescriptorUpdateTemplate::extension_name = "VK_KHR_descriptor_update_template";
+
+ZVK_DescriptorUpdateTemplate::ZVK_DescriptorUpdateTemplate(vk::Device device, vk::DescriptorSetLayout layout,
+	const std::vector<vk::DescriptorSetLayoutBinding>& bindings, bool use_extension)
+	: device(device)
+{
+	for (auto& b : bindings)
+	{
+		if (vk::DescriptorType::eUniformTexelBuffer == b.descriptorType
+			|| vk::DescriptorType::eStorageTexelBuffer == b.descriptorType)
+		{
+			throw std::domain_error{ "Descriptor Update Template does not support texel buffers" };
+		}
+
+		entry e{};
+		e.dstBinding = b.binding;
+		e.dstArrayElement = 0;
+		e.descriptorCount = b.descriptorCount;
+		e.descriptorType = static_cast<VkDescriptorType>(b.descriptorType);
+		e.stride = is_Buffer(b.descriptorType) ? sizeof(vk::DescriptorBufferInfo) : sizeof(vk::DescriptorImageInfo);
+		e.offset = data_size;
+		data_size += e.stride * e.descriptorCount;
+		descriptors_qty += e.descriptorCount;
+		entries.push_back(e);
+	}
+
+	if (use_extension)
+	{
+		auto create_fn = reinterpret_cast<PFN_create>(device.getProcAddr("vkCreateDescriptorUpdateTemplateKHR"));
+		destroy_fn = reinterpret_cast<PFN_destroy>(device.getProcAddr("vkDestroyDescriptorUpdateTemplateKHR"));
+		update_fn = reinterpret_cast<PFN_update>(device.getProcAddr("vkUpdateDescriptorSetWithTemplateKHR"));
+
+		if (create_fn && destroy_fn && update_fn)
+		{
+			create_info info{};
+			info.sType = structure_type_create_info;
+			info.descriptorUpdateEntryCount = static_cast<uint32_t>(entries.size());
+			info.pDescriptorUpdateEntries = entries.data();
+			info.templateType = template_type_descriptor_set;
+			info.descriptorSetLayout = static_cast<VkDescriptorSetLayout>(layout);
+
+			if (VK_SUCCESS != create_fn(static_cast<VkDevice>(device), &info, nullptr, &native_template))
+			{
+				throw std::domain_error{ "Descriptor Update Template was not created" };
+			}
+			return;
+		}
+	}
+
+	// No driver template: one write per binding, its descriptors are
+	// consecutive in the packed data.
+	writes.resize(entries.size());
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		writes[i].dstBinding = entries[i].dstBinding;
+		writes[i].dstArrayElement = entries[i].dstArrayElement;
+		writes[i].descriptorCount = entries[i].descriptorCount;
+		writes[i].descriptorType = static_cast<vk::DescriptorType>(entries[i].descriptorType);
+	}
+}
+
+ZVK_DescriptorUpdateTemplate::~ZVK_DescriptorUpdateTemplate()
+{
+	if (native_template)
+	{
+		destroy_fn(static_cast<VkDevice>(device), native_template, nullptr);
+	}
+}
+
+size_t ZVK_DescriptorUpdateTemplate::get_Offset(uint32_t binding) const
+{
+	for (auto& e : entries)
+	{
+		if (e.dstBinding == binding)
+		{
+			return e.offset;
+		}
+	}
+	throw std::domain_error{ "Descriptor Update Template has no such binding" };
+}
+
+void ZVK_DescriptorUpdateTemplate::update(vk::DescriptorSet set, const void* data) const
+{
+	if (native_template)
+	{
+		update_fn(static_cast<VkDevice>(device), static_cast<VkDescriptorSet>(set), native_template, data);
+		return;
+	}
+
+	const uint8_t* base = static_cast<const uint8_t*>(data);
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		writes[i].dstSet = set;
+		if (is_Buffer(writes[i].descriptorType))
+		{
+			writes[i].pBufferInfo = reinterpret_cast<const vk::DescriptorBufferInfo*>(base + entries[i].offset);
+		}
+		else
+		{
+			writes[i].pImageInfo = reinterpret_cast<const vk::DescriptorImageInfo*>(base + entries[i].offset);
+		}
+	}
+
+	device.updateDescriptorSets(static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+}
+
+bool ZVK_DescriptorUpdateTemplate::is_Buffer(vk::DescriptorType type)
+{
+	return vk::DescriptorType::eUniformBuffer == type
+		|| vk::DescriptorType::eStorageBuffer == type
+		|| vk::DescriptorType::eUniformBufferDynamic == type
+		|| vk::DescriptorType::eStorageBufferDynamic == type;
+}
@@ -0,0 +1,115 @@
+/* ZVK_DescriptorUpdateTemplate.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_DescriptorUpdateTemplate_h
+#define ZVK_DescriptorUpdateTemplate_h
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+
+/* Updates a whole descriptor set from one packed struct in one call.     */
+/* Entries are generated from the bindings of the set layout: every       */
+/* binding takes descriptorCount consecutive vk::DescriptorBufferInfo or  */
+/* vk::DescriptorImageInfo in binding order. With VK_KHR_descriptor_      */
+/* update_template (core in Vulkan 1.1) the driver template is used,      */
+/* otherwise the same packed data is turned into one updateDescriptorSets */
+/* call which points straight into it.                                    */
+class ZVK_DescriptorUpdateTemplate
+{
+public:
+	/* Declarations of VK_KHR_descriptor_update_template, which is newer  */
+	/* than the Vulkan headers of this project.                           */
+	static const char* extension_name;
+
+	struct entry
+	{
+		uint32_t dstBinding;
+		uint32_t dstArrayElement;
+		uint32_t descriptorCount;
+		VkDescriptorType descriptorType;
+		size_t offset;
+		size_t stride;
+	};
+
+	/* use_extension must be true only if the extension was enabled on the device. */
+	ZVK_DescriptorUpdateTemplate(vk::Device device, vk::DescriptorSetLayout layout,
+		const std::vector<vk::DescriptorSetLayoutBinding>& bindings, bool use_extension);
+	~ZVK_DescriptorUpdateTemplate();
+
+	ZVK_DescriptorUpdateTemplate(const ZVK_DescriptorUpdateTemplate&) = delete;
+	ZVK_DescriptorUpdateTemplate& operator=(const ZVK_DescriptorUpdateTemplate&) = delete;
+
+	/* Size of the packed struct and offset of a binding inside it. */
+	size_t get_DataSize() const { return data_size; }
+	size_t get_Offset(uint32_t binding) const;
+	/* Descriptors of all bindings, every one must be in the data. */
+	size_t get_DescriptorsQty() const { return descriptors_qty; }
+	bool is_Native() const { return native_template != 0; }
+
+	void update(vk::DescriptorSet set, const void* data) const;
+
+	/* Buffer descriptors take vk::DescriptorBufferInfo, others */
+	/* vk::DescriptorImageInfo.                                 */
+	static bool is_Buffer(vk::DescriptorType type);
+private:
+	typedef uint64_t native_handle;
+
+	struct create_info
+	{
+		VkStructureType sType;
+		const void* pNext;
+		VkFlags flags;
+		uint32_t descriptorUpdateEntryCount;
+		const entry* pDescriptorUpdateEntries;
+		uint32_t templateType;
+		VkDescriptorSetLayout descriptorSetLayout;
+		VkPipelineBindPoint pipelineBindPoint;
+		VkPipelineLayout pipelineLayout;
+		uint32_t set;
+	};
+
+	typedef VkResult (VKAPI_PTR *PFN_create)(VkDevice, const create_info*, const VkAllocationCallbacks*, native_handle*);
+	typedef void (VKAPI_PTR *PFN_destroy)(VkDevice, native_handle, const VkAllocationCallbacks*);
+	typedef void (VKAPI_PTR *PFN_update)(VkDevice, VkDescriptorSet, native_handle, const void*);
+
+
+	vk::Device device;
+	std::vector<entry> entries;
+	size_t data_size{};
+	size_t descriptors_qty{};
+
+	native_handle native_template{};
+	PFN_destroy destroy_fn{};
+	PFN_update update_fn{};
+
+	// Emulation: writes with pointers relative to the packed data.
+	mutable std::vector<vk::WriteDescriptorSet> writes;
+};
+
+#endif // !ZVK_DescriptorUpdateTemplate_h
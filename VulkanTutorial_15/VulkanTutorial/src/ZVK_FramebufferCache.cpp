@@ -0,0 +1,109 @@
+/* ZVK_FramebufferCache.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_FramebufferCache.h"
+#include "ZVK_Hash.h"
+#include <algorithm>
+#include <stdexcept>
+
+ZVK_FramebufferCache::ZVK_FramebufferCache(vk::Device device)
+	: device(device)
+{
+}
+
+vk::Framebuffer ZVK_FramebufferCache::get(vk::RenderPass render_pass, const std::vector<vk::ImageView>& views, vk::Extent2D extent)
+{
+	key k{ render_pass, std::vector<VkImageView>(views.begin(), views.end()), extent.width, extent.height };
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto found = framebuffers.find(k);
+	if (found != framebuffers.end())
+	{
+		return found->second;
+	}
+
+	vk::FramebufferCreateInfo fb_info{};
+	fb_info.renderPass = render_pass;
+	fb_info.attachmentCount = static_cast<uint32_t>(views.size());
+	fb_info.pAttachments = views.data();
+	fb_info.width = extent.width;
+	fb_info.height = extent.height;
+	fb_info.layers = 1;
+
+	ZVK_Handle<vk::Framebuffer> framebuffer(device, device.createFramebuffer(fb_info));
+	if (!framebuffer)
+	{
+		throw std::domain_error{ "Framebuffer cannot be created" };
+	}
+
+	vk::Framebuffer result = framebuffer;
+	framebuffers.emplace(std::move(k), std::move(framebuffer));
+	return result;
+}
+
+std::vector<ZVK_Handle<vk::Framebuffer>> ZVK_FramebufferCache::invalidate(vk::ImageView view)
+{
+	std::vector<ZVK_Handle<vk::Framebuffer>> removed;
+	const VkImageView v = view;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	for (auto it = framebuffers.begin(); it != framebuffers.end();)
+	{
+		if (std::find(it->first.views.begin(), it->first.views.end(), v) != it->first.views.end())
+		{
+			removed.push_back(std::move(it->second));
+			it = framebuffers.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+	return removed;
+}
+
+size_t ZVK_FramebufferCache::size() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return framebuffers.size();
+}
+
+size_t ZVK_FramebufferCache::key_hash::operator()(const key& k) const
+{
+	size_t seed = 0;
+	hash_handle(seed, k.render_pass);
+	for (auto v : k.views)
+	{
+		hash_handle(seed, v);
+	}
+	hash_combine(seed, k.width);
+	hash_combine(seed, k.height);
+	return seed;
+}
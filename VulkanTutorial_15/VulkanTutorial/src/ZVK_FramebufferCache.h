@@ -0,0 +1,83 @@
+/* ZVK_FramebufferCache.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_FramebufferCache_h
+#define ZVK_FramebufferCache_h
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+#include "ZVK_Handle.h"
+
+/* Shares framebuffers between requests with the same render pass,      */
+/* attachments and extent. A framebuffer must not outlive its image      */
+/* views, so the owner of a view invalidates it before destroying it.    */
+class ZVK_FramebufferCache
+{
+public:
+	explicit ZVK_FramebufferCache(vk::Device device);
+
+	ZVK_FramebufferCache(const ZVK_FramebufferCache&) = delete;
+	ZVK_FramebufferCache& operator=(const ZVK_FramebufferCache&) = delete;
+
+	vk::Framebuffer get(vk::RenderPass render_pass, const std::vector<vk::ImageView>& views, vk::Extent2D extent);
+
+	/* Removes the framebuffers which use the view. They are handed   */
+	/* back, as a frame in flight may still be rendering into them.    */
+	std::vector<ZVK_Handle<vk::Framebuffer>> invalidate(vk::ImageView view);
+
+	size_t size() const;
+private:
+	struct key
+	{
+		VkRenderPass render_pass;
+		std::vector<VkImageView> views;
+		uint32_t width;
+		uint32_t height;
+
+		bool operator==(const key& rhs) const
+		{
+			return render_pass == rhs.render_pass && views == rhs.views
+				&& width == rhs.width && height == rhs.height;
+		}
+	};
+	struct key_hash
+	{
+		size_t operator()(const key& k) const;
+	};
+
+	vk::Device device;
+
+	mutable std::mutex mutex;
+	std::unordered_map<key, ZVK_Handle<vk::Framebuffer>, key_hash> framebuffers;
+};
+
+#endif // !ZVK_FramebufferCache_h
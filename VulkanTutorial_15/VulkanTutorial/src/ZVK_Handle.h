@@ -0,0 +1,255 @@
+/* ZVK_Handle.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_Handle_h
+#define ZVK_Handle_h
+
+#include <vulkan/vulkan.hpp>
+#include <cstddef>
+#include <utility>
+
+/* How a Vulkan object is destroyed and which object it belongs to. */
+template <typename T>
+struct ZVK_HandleTraits;
+
+template <>
+struct ZVK_HandleTraits<vk::Instance>
+{
+	typedef std::nullptr_t parent_type;
+	static void destroy(parent_type, vk::Instance h) { h.destroy(); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::Device>
+{
+	typedef std::nullptr_t parent_type;
+	static void destroy(parent_type, vk::Device h) { h.destroy(); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::SurfaceKHR>
+{
+	typedef vk::Instance parent_type;
+	static void destroy(parent_type i, vk::SurfaceKHR h) { i.destroySurfaceKHR(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::SwapchainKHR>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::SwapchainKHR h) { d.destroySwapchainKHR(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::CommandPool>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::CommandPool h) { d.destroyCommandPool(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::Buffer>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::Buffer h) { d.destroyBuffer(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::Image>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::Image h) { d.destroyImage(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::ImageView>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::ImageView h) { d.destroyImageView(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::DeviceMemory>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::DeviceMemory h) { d.freeMemory(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::Sampler>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::Sampler h) { d.destroySampler(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::DescriptorSetLayout>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::DescriptorSetLayout h) { d.destroyDescriptorSetLayout(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::DescriptorPool>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::DescriptorPool h) { d.destroyDescriptorPool(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::PipelineLayout>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::PipelineLayout h) { d.destroyPipelineLayout(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::PipelineCache>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::PipelineCache h) { d.destroyPipelineCache(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::Pipeline>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::Pipeline h) { d.destroyPipeline(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::RenderPass>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::RenderPass h) { d.destroyRenderPass(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::Framebuffer>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::Framebuffer h) { d.destroyFramebuffer(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::ShaderModule>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::ShaderModule h) { d.destroyShaderModule(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::Semaphore>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::Semaphore h) { d.destroySemaphore(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::Fence>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::Fence h) { d.destroyFence(h); }
+};
+
+template <>
+struct ZVK_HandleTraits<vk::QueryPool>
+{
+	typedef vk::Device parent_type;
+	static void destroy(parent_type d, vk::QueryPool h) { d.destroyQueryPool(h); }
+};
+
+/* Move-only owner of one Vulkan object, destroyed with its owner. */
+/* Converts to the plain handle, so it is passed to the API as is; */
+/* members of vk::Instance and vk::Device are reached through ->.  */
+template <typename T>
+class ZVK_Handle
+{
+public:
+	typedef typename ZVK_HandleTraits<T>::parent_type parent_type;
+
+	ZVK_Handle() {}
+	ZVK_Handle(parent_type parent, T handle)
+		: parent(parent)
+		, handle(handle)
+	{
+	}
+	ZVK_Handle(ZVK_Handle&& other)
+		: parent(other.parent)
+		, handle(other.release())
+	{
+	}
+	ZVK_Handle& operator=(ZVK_Handle&& other)
+	{
+		if (this != &other)
+		{
+			reset();
+			parent = other.parent;
+			handle = other.release();
+		}
+		return *this;
+	}
+	~ZVK_Handle()
+	{
+		reset();
+	}
+
+	ZVK_Handle(const ZVK_Handle&) = delete;
+	ZVK_Handle& operator=(const ZVK_Handle&) = delete;
+
+	void reset()
+	{
+		if (handle)
+		{
+			ZVK_HandleTraits<T>::destroy(parent, handle);
+			handle = T{};
+		}
+	}
+
+	/* The caller becomes responsible for destroying the object. */
+	T release()
+	{
+		T h = handle;
+		handle = T{};
+		return h;
+	}
+
+	T get() const { return handle; }
+	parent_type get_Parent() const { return parent; }
+	const T* ptr() const { return &handle; }
+
+	operator T() const { return handle; }
+	explicit operator bool() const { return static_cast<bool>(handle); }
+	const T* operator->() const { return &handle; }
+private:
+	parent_type parent{};
+	T handle{};
+};
+
+#endif // !ZVK_Handle_h
@@ -0,0 +1,59 @@
+/* ZVK_Hash.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_Hash_h
+#define ZVK_Hash_h
+
+#include <vulkan/vulkan.hpp>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+/* Hashing of the keys of the object caches. */
+template <typename T>
+inline void hash_combine(size_t& seed, const T& v)
+{
+	seed ^= std::hash<T>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// -0.0f and 0.0f compare equal, so they have to hash equally too.
+inline void hash_combine(size_t& seed, float v)
+{
+	hash_combine<float>(seed, v + 0.0f);
+}
+
+/* Takes the C handle types, e.g. VkBuffer. They are pointers on 64-bit */
+/* targets and uint64_t on 32-bit ones, the C cast converts either.     */
+template <typename H>
+inline void hash_handle(size_t& seed, H handle)
+{
+	hash_combine(seed, (uint64_t)handle);
+}
+
+#endif // !ZVK_Hash_h
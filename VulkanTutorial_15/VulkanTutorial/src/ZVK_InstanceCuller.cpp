@@ -0,0 +1,201 @@
+/* ZVK_InstanceCuller.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_InstanceCuller.h"
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+
+#include "Z_Shaders.h"
+
+namespace
+{
+	/* The std140 uniform of the compute shader. */
+	struct frame_parameters
+	{
+		float view_projection[16];
+		Z_FrustumCuller::plane planes[6];
+		uint32_t instances_qty;
+	};
+
+	const uint32_t slices_qty = 2;
+	const vk::DeviceSize instance_count_offset = offsetof(VkDrawIndexedIndirectCommand, instanceCount);
+
+	vk::BufferMemoryBarrier buffer_barrier(vk::Buffer buffer, vk::DeviceSize offset, vk::DeviceSize size,
+		vk::AccessFlags src_access, vk::AccessFlags dst_access)
+	{
+		return vk::BufferMemoryBarrier{ src_access, dst_access, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, buffer, offset, size };
+	}
+}
+
+static_assert(sizeof(ZVK_InstanceCuller::instance) == 96, "Instances are read with the std430 stride of 96 bytes");
+
+ZVK_InstanceCuller::ZVK_InstanceCuller(vk::Device device, vk::PhysicalDevice gpu)
+	: device(device)
+	, gpu(gpu)
+{
+}
+
+void ZVK_InstanceCuller::set_Instances(ZVK_BufferUploader& uploader, const std::vector<instance>& instances)
+{
+	instances_qty = instances.size();
+
+	const vk::DeviceSize qty = std::max<size_t>(instances_qty, 1);
+	instances_buffer = uploader.create_Buffer(qty * sizeof(instance), vk::BufferUsageFlagBits::eStorageBuffer, instances_memory);
+	visible_buffer = uploader.create_Buffer(qty * visible_stride,
+		vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eVertexBuffer, visible_memory);
+	if (instances_qty)
+	{
+		uploader.upload(instances_buffer, 0, instances.data(), instances_qty * sizeof(instance));
+		uploader.flush();
+	}
+}
+
+void ZVK_InstanceCuller::record(vk::CommandBuffer cmd, uint64_t frame, const float* view_projection, const Z_FrustumCuller::plane* planes,
+	vk::Buffer commands, vk::DeviceSize commands_offset, uint32_t commands_qty)
+{
+	if (!pipeline)
+	{
+		create_ComputePipeline();
+	}
+	if (!instances_buffer)
+	{
+		throw std::domain_error{ "Instances to cull were not set" };
+	}
+
+	frame_parameters* params = reinterpret_cast<frame_parameters*>(frame_params->begin_Frame(frame));
+	memcpy(params->view_projection, view_projection, sizeof(params->view_projection));
+	std::copy(planes, planes + 6, params->planes);
+	params->instances_qty = static_cast<uint32_t>(instances_qty);
+
+	// The instances and the commands may be other buffers than two
+	// frames ago, so the set of the slice is written every time.
+	const vk::DeviceSize commands_size = commands_qty * sizeof(vk::DrawIndexedIndirectCommand);
+	const vk::DescriptorSet set = sets[frame % slices_qty];
+	const vk::DescriptorBufferInfo infos[4]{
+		{ frame_params->get_Buffer(), frame_params->get_Offset(), sizeof(frame_parameters) },
+		{ instances_buffer, 0, VK_WHOLE_SIZE },
+		{ visible_buffer, 0, VK_WHOLE_SIZE },
+		{ commands, commands_offset, commands_size } };
+	vk::WriteDescriptorSet writes[4]{};
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		writes[i].dstSet = set;
+		writes[i].dstBinding = i;
+		writes[i].descriptorCount = 1;
+		writes[i].descriptorType = i ? vk::DescriptorType::eStorageBuffer : vk::DescriptorType::eUniformBuffer;
+		writes[i].pBufferInfo = &infos[i];
+	}
+	device.updateDescriptorSets(4, writes, 0, nullptr);
+
+	// Draws of the frames before may still fetch the visible instances.
+	cmd.pipelineBarrier(vk::PipelineStageFlagBits::eVertexInput, vk::PipelineStageFlagBits::eComputeShader,
+		vk::DependencyFlags{}, 0, nullptr, 0, nullptr, 0, nullptr);
+	cmd.bindPipeline(vk::PipelineBindPoint::eCompute, pipeline);
+	cmd.bindDescriptorSets(vk::PipelineBindPoint::eCompute, pipeline_layout, 0, 1, &set, 0, nullptr);
+	if (instances_qty)
+	{
+		cmd.dispatch(static_cast<uint32_t>((instances_qty + local_size - 1) / local_size), 1, 1);
+	}
+
+	const vk::BufferMemoryBarrier culled[2]{
+		buffer_barrier(visible_buffer, 0, VK_WHOLE_SIZE, vk::AccessFlagBits::eShaderWrite, vk::AccessFlagBits::eVertexAttributeRead),
+		buffer_barrier(commands, commands_offset, commands_size, vk::AccessFlagBits::eShaderWrite,
+			vk::AccessFlagBits::eIndirectCommandRead | vk::AccessFlagBits::eTransferRead | vk::AccessFlagBits::eHostRead) };
+	// The host may read the count back once the frame has completed.
+	cmd.pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader,
+		vk::PipelineStageFlagBits::eDrawIndirect | vk::PipelineStageFlagBits::eVertexInput | vk::PipelineStageFlagBits::eTransfer
+		| vk::PipelineStageFlagBits::eHost,
+		vk::DependencyFlags{}, 0, nullptr, 2, culled, 0, nullptr);
+	if (commands_qty < 2)
+	{
+		return;
+	}
+
+	// Only the first command counted, the others draw as many.
+	std::vector<vk::BufferCopy> copies;
+	for (uint32_t i = 1; i < commands_qty; ++i)
+	{
+		copies.push_back(vk::BufferCopy{ commands_offset + instance_count_offset,
+			commands_offset + i * sizeof(vk::DrawIndexedIndirectCommand) + instance_count_offset, sizeof(uint32_t) });
+	}
+	cmd.copyBuffer(commands, commands, static_cast<uint32_t>(copies.size()), copies.data());
+	const vk::BufferMemoryBarrier copied = buffer_barrier(commands, commands_offset, commands_size,
+		vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eIndirectCommandRead);
+	cmd.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eDrawIndirect,
+		vk::DependencyFlags{}, 0, nullptr, 1, &copied, 0, nullptr);
+}
+
+void ZVK_InstanceCuller::create_ComputePipeline()
+{
+	vk::DescriptorSetLayoutBinding bindings[4]{};
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		bindings[i].binding = i;
+		bindings[i].descriptorType = i ? vk::DescriptorType::eStorageBuffer : vk::DescriptorType::eUniformBuffer;
+		bindings[i].descriptorCount = 1;
+		bindings[i].stageFlags = vk::ShaderStageFlagBits::eCompute;
+	}
+
+	vk::DescriptorSetLayoutCreateInfo set_layout_info{};
+	set_layout_info.bindingCount = 4;
+	set_layout_info.pBindings = bindings;
+	set_layout = ZVK_Handle<vk::DescriptorSetLayout>(device, device.createDescriptorSetLayout(set_layout_info));
+
+	vk::PipelineLayoutCreateInfo pipeline_layout_info{};
+	pipeline_layout_info.setLayoutCount = 1;
+	pipeline_layout_info.pSetLayouts = set_layout.ptr();
+	pipeline_layout = ZVK_Handle<vk::PipelineLayout>(device, device.createPipelineLayout(pipeline_layout_info));
+
+	vk::ShaderModuleCreateInfo module_info{};
+	module_info.pCode = comp_cull_spir_v;
+	module_info.codeSize = sizeof(comp_cull_spir_v);
+	shader = ZVK_Handle<vk::ShaderModule>(device, device.createShaderModule(module_info));
+
+	vk::ComputePipelineCreateInfo pipeline_info{};
+	pipeline_info.stage.stage = vk::ShaderStageFlagBits::eCompute;
+	pipeline_info.stage.module = shader;
+	pipeline_info.stage.pName = "main";
+	pipeline_info.layout = pipeline_layout;
+	pipeline = ZVK_Handle<vk::Pipeline>(device, device.createComputePipeline(vk::PipelineCache{}, pipeline_info));
+	if (!pipeline)
+	{
+		throw std::domain_error{ "Culling Compute Pipeline was not created" };
+	}
+
+	const std::vector<ZVK_DescriptorAllocator::pool_size_ratio> ratios{
+		{ vk::DescriptorType::eUniformBuffer, 1.0f },
+		{ vk::DescriptorType::eStorageBuffer, 3.0f } };
+	descriptor_allocator.reset(new ZVK_DescriptorAllocator(device, slices_qty, ratios));
+	sets = descriptor_allocator->allocate(std::vector<vk::DescriptorSetLayout>(slices_qty, set_layout));
+
+	frame_params.reset(new ZVK_StreamBuffer(device, gpu, vk::BufferUsageFlagBits::eUniformBuffer, sizeof(frame_parameters),
+		slices_qty, gpu.getProperties().limits.minUniformBufferOffsetAlignment));
+}
@@ -0,0 +1,109 @@
+/* ZVK_InstanceCuller.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_InstanceCuller_h
+#define ZVK_InstanceCuller_h
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "ZVK_Handle.h"
+#include "ZVK_DescriptorAllocator.h"
+#include "ZVK_BufferUploader.h"
+#include "ZVK_StreamBuffer.h"
+#include "Z_FrustumCuller.h"
+
+/* Culls instances against the view frustum in a compute shader, so the  */
+/* CPU neither tests them nor streams the visible ones every frame. The  */
+/* instances stay in a device local buffer; every visible one takes a    */
+/* slot from an atomic counter, which is the instanceCount of the first  */
+/* indirect draw command, and writes its MVP and color there in a        */
+/* buffer fetched at the instance rate by the same frame's draws.        */
+class ZVK_InstanceCuller
+{
+public:
+	/* One instance as the compute shader reads it, std430 layout. */
+	struct instance
+	{
+		float model[16];
+		/* Center and bounding sphere radius. */
+		float sphere[4];
+		float half_extent[3];
+		/* RGBA8, copied to the visible instance. */
+		uint32_t color;
+	};
+
+	/* A visible instance is a column-major MVP and the color. */
+	static const uint32_t visible_stride = 17 * sizeof(float);
+	static const uint32_t local_size = 64;
+
+	ZVK_InstanceCuller(vk::Device device, vk::PhysicalDevice gpu);
+
+	ZVK_InstanceCuller(const ZVK_InstanceCuller&) = delete;
+	ZVK_InstanceCuller& operator=(const ZVK_InstanceCuller&) = delete;
+
+	/* Copies the instances to the device, the GPU must not be using */
+	/* the previous ones any more.                                   */
+	void set_Instances(ZVK_BufferUploader& uploader, const std::vector<instance>& instances);
+	size_t get_InstancesQty() const { return instances_qty; }
+
+	/* Records the culling, outside of a render pass. commands_qty     */
+	/* indexed indirect commands at commands_offset have been written  */
+	/* with instanceCount 0; afterwards all of them draw the visible   */
+	/* instances. As with stream buffers, the parameters of a frame    */
+	/* are reused two frames later.                                    */
+	void record(vk::CommandBuffer cmd, uint64_t frame, const float* view_projection, const Z_FrustumCuller::plane* planes,
+		vk::Buffer commands, vk::DeviceSize commands_offset, uint32_t commands_qty);
+
+	vk::Buffer get_VisibleBuffer() const { return visible_buffer; }
+private:
+	void create_ComputePipeline();
+
+	vk::Device device;
+	vk::PhysicalDevice gpu;
+
+	ZVK_Handle<vk::DescriptorSetLayout> set_layout;
+	ZVK_Handle<vk::PipelineLayout> pipeline_layout;
+	ZVK_Handle<vk::ShaderModule> shader;
+	ZVK_Handle<vk::Pipeline> pipeline;
+	std::unique_ptr<ZVK_DescriptorAllocator> descriptor_allocator;
+	/* One per slice of the frame parameters. */
+	std::vector<vk::DescriptorSet> sets;
+	std::unique_ptr<ZVK_StreamBuffer> frame_params;
+
+	size_t instances_qty{};
+	ZVK_Handle<vk::Buffer> instances_buffer;
+	ZVK_Handle<vk::DeviceMemory> instances_memory;
+	ZVK_Handle<vk::Buffer> visible_buffer;
+	ZVK_Handle<vk::DeviceMemory> visible_memory;
+};
+
+#endif // !ZVK_InstanceCuller_h
@@ -0,0 +1,72 @@
+/* ZVK_Memory.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_Memory.h"
+#include <stdexcept>
+
+uint32_t ZVK_Memory::find_Type(const vk::PhysicalDeviceMemoryProperties& properties, uint32_t type_bits,
+	vk::MemoryPropertyFlags flags)
+{
+	for (uint32_t i = 0; i < properties.memoryTypeCount; ++i)
+	{
+		if ((type_bits & (1u << i)) && (properties.memoryTypes[i].propertyFlags & flags) == flags)
+		{
+			return i;
+		}
+	}
+	throw std::domain_error{ "No suitable Memory Type found" };
+}
+
+ZVK_Handle<vk::DeviceMemory> ZVK_Memory::allocate(vk::Device device, const vk::PhysicalDeviceMemoryProperties& properties,
+	const vk::MemoryRequirements& mem_reqs, vk::MemoryPropertyFlags flags)
+{
+	vk::MemoryAllocateInfo mem_alloc{};
+	mem_alloc.allocationSize = mem_reqs.size;
+	mem_alloc.memoryTypeIndex = find_Type(properties, mem_reqs.memoryTypeBits, flags);
+	return ZVK_Handle<vk::DeviceMemory>(device, device.allocateMemory(mem_alloc));
+}
+
+void* ZVK_Memory::map_Buffer(vk::Device device, const vk::PhysicalDeviceMemoryProperties& properties, vk::Buffer buffer,
+	ZVK_Handle<vk::DeviceMemory>& memory, const std::string& name)
+{
+	memory = allocate(device, properties, device.getBufferMemoryRequirements(buffer),
+		vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent);
+	if (!memory)
+	{
+		throw std::domain_error{ name + " Memory cannot be allocated" };
+	}
+	device.bindBufferMemory(buffer, memory, 0);
+
+	void* data = device.mapMemory(memory, 0, VK_WHOLE_SIZE);
+	if (!data)
+	{
+		throw std::domain_error{ name + " Memory cannot be mapped" };
+	}
+	return data;
+}
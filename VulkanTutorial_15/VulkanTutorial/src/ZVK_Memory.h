@@ -0,0 +1,59 @@
+/* ZVK_Memory.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_Memory_h
+#define ZVK_Memory_h
+
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <string>
+
+#include "ZVK_Handle.h"
+
+/* Device memory allocation shared by the objects owning their memory. */
+class ZVK_Memory
+{
+public:
+	/* First type of type_bits having all flags, throws std::domain_error */
+	/* when there is none.                                                */
+	static uint32_t find_Type(const vk::PhysicalDeviceMemoryProperties& properties, uint32_t type_bits,
+		vk::MemoryPropertyFlags flags);
+
+	/* Memory of flags for mem_reqs, null when it cannot be allocated. */
+	static ZVK_Handle<vk::DeviceMemory> allocate(vk::Device device, const vk::PhysicalDeviceMemoryProperties& properties,
+		const vk::MemoryRequirements& mem_reqs, vk::MemoryPropertyFlags flags);
+
+	/* Binds host visible, coherent memory to buffer and maps all of it. */
+	/* Freeing the memory unmaps it, so it is never unmapped explicitly. */
+	/* Errors are std::domain_error about the "<name> Memory".           */
+	static void* map_Buffer(vk::Device device, const vk::PhysicalDeviceMemoryProperties& properties, vk::Buffer buffer,
+		ZVK_Handle<vk::DeviceMemory>& memory, const std::string& name);
+};
+
+#endif // !ZVK_Memory_h
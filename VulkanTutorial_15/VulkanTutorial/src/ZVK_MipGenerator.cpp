@@ -0,0 +1,365 @@
+/* ZVK_MipGenerator.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_MipGenerator.h"
+#include <stdexcept>
+#include <algorithm>
+
+#include "Z_Shaders.h"
+
+namespace
+{
+	const uint32_t local_size = 8;
+
+	vk::ImageMemoryBarrier level_barrier(vk::Image image, uint32_t level, uint32_t levels_qty,
+		vk::ImageLayout old_layout, vk::ImageLayout new_layout, vk::AccessFlags src_access, vk::AccessFlags dst_access)
+	{
+		vk::ImageMemoryBarrier barrier{};
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image = image;
+		barrier.subresourceRange = vk::ImageSubresourceRange{ vk::ImageAspectFlagBits::eColor, level, levels_qty, 0, 1 };
+		barrier.oldLayout = old_layout;
+		barrier.newLayout = new_layout;
+		barrier.srcAccessMask = src_access;
+		barrier.dstAccessMask = dst_access;
+		return barrier;
+	}
+
+	int32_t level_size(uint32_t size, uint32_t level)
+	{
+		return static_cast<int32_t>(std::max(size >> level, 1u));
+	}
+}
+
+ZVK_MipGenerator::ZVK_MipGenerator(vk::Device device, vk::PhysicalDevice gpu, bool storage_write_without_format)
+	: device(device)
+	, gpu(gpu)
+	, storage_write_without_format(storage_write_without_format)
+{
+}
+
+uint32_t ZVK_MipGenerator::get_LevelsQty(vk::Extent2D extent)
+{
+	uint32_t levels = 1;
+	for (uint32_t size = std::max(extent.width, extent.height); size > 1; size >>= 1)
+	{
+		++levels;
+	}
+	return levels;
+}
+
+ZVK_MipGenerator::method ZVK_MipGenerator::get_Method(vk::Format format) const
+{
+	vk::FormatFeatureFlags features = gpu.getFormatProperties(format).optimalTilingFeatures;
+
+	const vk::FormatFeatureFlags blit_features = vk::FormatFeatureFlagBits::eBlitSrc
+		| vk::FormatFeatureFlagBits::eBlitDst | vk::FormatFeatureFlagBits::eSampledImageFilterLinear;
+	if ((features & blit_features) == blit_features)
+	{
+		return blit;
+	}
+
+	const vk::FormatFeatureFlags compute_features = vk::FormatFeatureFlagBits::eSampledImage
+		| vk::FormatFeatureFlagBits::eStorageImage;
+	if (storage_write_without_format && (features & compute_features) == compute_features)
+	{
+		return compute;
+	}
+
+	return unsupported;
+}
+
+vk::ImageUsageFlags ZVK_MipGenerator::get_RequiredUsage(vk::Format format) const
+{
+	switch (get_Method(format))
+	{
+	case blit:
+		return vk::ImageUsageFlagBits::eTransferSrc | vk::ImageUsageFlagBits::eTransferDst;
+	case compute:
+		return vk::ImageUsageFlagBits::eStorage | vk::ImageUsageFlagBits::eTransferDst;
+	default:
+		throw std::domain_error{ "Mip generation is not supported for the texture format" };
+	}
+}
+
+void ZVK_MipGenerator::record(vk::CommandBuffer cmd, const std::vector<const ZVK_Texture*>& textures)
+{
+	std::vector<const ZVK_Texture*> blitted;
+	std::vector<const ZVK_Texture*> computed;
+	for (auto t : textures)
+	{
+		switch (get_Method(t->format))
+		{
+		case blit:
+			blitted.push_back(t);
+			break;
+		case compute:
+			computed.push_back(t);
+			break;
+		default:
+			throw std::domain_error{ "Mip generation is not supported for the texture format" };
+		}
+	}
+
+	if (blitted.size())
+	{
+		record_Blit(cmd, blitted);
+	}
+	if (computed.size())
+	{
+		record_Compute(cmd, computed);
+	}
+}
+
+void ZVK_MipGenerator::batch_completed()
+{
+	if (descriptor_allocator)
+	{
+		descriptor_allocator->reset();
+	}
+	level_views.clear();
+}
+
+void ZVK_MipGenerator::record_Blit(vk::CommandBuffer cmd, const std::vector<const ZVK_Texture*>& textures)
+{
+	uint32_t max_levels = 0;
+	for (auto t : textures)
+	{
+		max_levels = std::max(max_levels, t->mip_levels);
+	}
+
+	std::vector<vk::ImageMemoryBarrier> barriers;
+	for (uint32_t level = 1; level < max_levels; ++level)
+	{
+		// The previous level of every texture becomes the blit source.
+		barriers.clear();
+		for (auto t : textures)
+		{
+			if (level < t->mip_levels)
+			{
+				barriers.push_back(level_barrier(t->image, level - 1, 1,
+					vk::ImageLayout::eTransferDstOptimal, vk::ImageLayout::eTransferSrcOptimal,
+					vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eTransferRead));
+			}
+		}
+		cmd.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eTransfer,
+			vk::DependencyFlags{}, 0, nullptr, 0, nullptr, static_cast<uint32_t>(barriers.size()), barriers.data());
+
+		for (auto t : textures)
+		{
+			if (level >= t->mip_levels)
+			{
+				continue;
+			}
+
+			vk::ImageBlit region{};
+			region.srcSubresource = vk::ImageSubresourceLayers{ vk::ImageAspectFlagBits::eColor, level - 1, 0, 1 };
+			region.srcOffsets[1] = vk::Offset3D{ level_size(t->extent.width, level - 1), level_size(t->extent.height, level - 1), 1 };
+			region.dstSubresource = vk::ImageSubresourceLayers{ vk::ImageAspectFlagBits::eColor, level, 0, 1 };
+			region.dstOffsets[1] = vk::Offset3D{ level_size(t->extent.width, level), level_size(t->extent.height, level), 1 };
+
+			cmd.blitImage(t->image, vk::ImageLayout::eTransferSrcOptimal, t->image, vk::ImageLayout::eTransferDstOptimal,
+				1, &region, vk::Filter::eLinear);
+		}
+	}
+
+	// Sources are in eTransferSrcOptimal, only the last level is not.
+	barriers.clear();
+	for (auto t : textures)
+	{
+		if (t->mip_levels > 1)
+		{
+			barriers.push_back(level_barrier(t->image, 0, t->mip_levels - 1,
+				vk::ImageLayout::eTransferSrcOptimal, vk::ImageLayout::eShaderReadOnlyOptimal,
+				vk::AccessFlagBits::eTransferRead, vk::AccessFlagBits::eShaderRead));
+		}
+		barriers.push_back(level_barrier(t->image, t->mip_levels - 1, 1,
+			vk::ImageLayout::eTransferDstOptimal, vk::ImageLayout::eShaderReadOnlyOptimal,
+			vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eShaderRead));
+	}
+	cmd.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eFragmentShader,
+		vk::DependencyFlags{}, 0, nullptr, 0, nullptr, static_cast<uint32_t>(barriers.size()), barriers.data());
+}
+
+void ZVK_MipGenerator::record_Compute(vk::CommandBuffer cmd, const std::vector<const ZVK_Texture*>& textures)
+{
+	if (!compute_pipeline)
+	{
+		create_ComputePipeline();
+	}
+
+	uint32_t max_levels = 0;
+	for (auto t : textures)
+	{
+		max_levels = std::max(max_levels, t->mip_levels);
+	}
+
+	cmd.bindPipeline(vk::PipelineBindPoint::eCompute, compute_pipeline);
+
+	const vk::PipelineStageFlags src_stages = vk::PipelineStageFlagBits::eTransfer | vk::PipelineStageFlagBits::eComputeShader;
+	std::vector<vk::ImageMemoryBarrier> barriers;
+	for (uint32_t level = 1; level < max_levels; ++level)
+	{
+		// The previous level is read, the current one is written.
+		barriers.clear();
+		for (auto t : textures)
+		{
+			if (level >= t->mip_levels)
+			{
+				continue;
+			}
+			bool uploaded = level == 1;
+			barriers.push_back(level_barrier(t->image, level - 1, 1,
+				uploaded ? vk::ImageLayout::eTransferDstOptimal : vk::ImageLayout::eGeneral,
+				vk::ImageLayout::eShaderReadOnlyOptimal,
+				uploaded ? vk::AccessFlagBits::eTransferWrite : vk::AccessFlagBits::eShaderWrite,
+				vk::AccessFlagBits::eShaderRead));
+			barriers.push_back(level_barrier(t->image, level, 1,
+				vk::ImageLayout::eUndefined, vk::ImageLayout::eGeneral,
+				vk::AccessFlags{}, vk::AccessFlagBits::eShaderWrite));
+		}
+		cmd.pipelineBarrier(src_stages, vk::PipelineStageFlagBits::eComputeShader,
+			vk::DependencyFlags{}, 0, nullptr, 0, nullptr, static_cast<uint32_t>(barriers.size()), barriers.data());
+
+		for (auto t : textures)
+		{
+			if (level >= t->mip_levels)
+			{
+				continue;
+			}
+
+			vk::DescriptorSet set = descriptor_allocator->allocate(compute_set_layout);
+
+			vk::DescriptorImageInfo src_info{ nearest_sampler, create_LevelView(*t, level - 1), vk::ImageLayout::eShaderReadOnlyOptimal };
+			vk::DescriptorImageInfo dst_info{ vk::Sampler{}, create_LevelView(*t, level), vk::ImageLayout::eGeneral };
+			vk::WriteDescriptorSet writes[2]{};
+			writes[0].dstSet = set;
+			writes[0].dstBinding = 0;
+			writes[0].descriptorCount = 1;
+			writes[0].descriptorType = vk::DescriptorType::eCombinedImageSampler;
+			writes[0].pImageInfo = &src_info;
+			writes[1].dstSet = set;
+			writes[1].dstBinding = 1;
+			writes[1].descriptorCount = 1;
+			writes[1].descriptorType = vk::DescriptorType::eStorageImage;
+			writes[1].pImageInfo = &dst_info;
+			device.updateDescriptorSets(2, writes, 0, nullptr);
+
+			const int32_t sizes[4]{
+				level_size(t->extent.width, level), level_size(t->extent.height, level),
+				level_size(t->extent.width, level - 1) - 1, level_size(t->extent.height, level - 1) - 1 };
+			cmd.bindDescriptorSets(vk::PipelineBindPoint::eCompute, compute_pipeline_layout, 0, 1, &set, 0, nullptr);
+			cmd.pushConstants(compute_pipeline_layout, vk::ShaderStageFlagBits::eCompute, 0, sizeof(sizes), sizes);
+			cmd.dispatch((sizes[0] + local_size - 1) / local_size, (sizes[1] + local_size - 1) / local_size, 1);
+		}
+	}
+
+	// Only the last level has not been read yet.
+	barriers.clear();
+	for (auto t : textures)
+	{
+		bool uploaded = t->mip_levels == 1;
+		barriers.push_back(level_barrier(t->image, t->mip_levels - 1, 1,
+			uploaded ? vk::ImageLayout::eTransferDstOptimal : vk::ImageLayout::eGeneral,
+			vk::ImageLayout::eShaderReadOnlyOptimal,
+			uploaded ? vk::AccessFlagBits::eTransferWrite : vk::AccessFlagBits::eShaderWrite,
+			vk::AccessFlagBits::eShaderRead));
+	}
+	cmd.pipelineBarrier(src_stages, vk::PipelineStageFlagBits::eFragmentShader,
+		vk::DependencyFlags{}, 0, nullptr, 0, nullptr, static_cast<uint32_t>(barriers.size()), barriers.data());
+}
+
+void ZVK_MipGenerator::create_ComputePipeline()
+{
+	vk::DescriptorSetLayoutBinding bindings[2]{};
+	bindings[0].binding = 0;
+	bindings[0].descriptorType = vk::DescriptorType::eCombinedImageSampler;
+	bindings[0].descriptorCount = 1;
+	bindings[0].stageFlags = vk::ShaderStageFlagBits::eCompute;
+	bindings[1].binding = 1;
+	bindings[1].descriptorType = vk::DescriptorType::eStorageImage;
+	bindings[1].descriptorCount = 1;
+	bindings[1].stageFlags = vk::ShaderStageFlagBits::eCompute;
+
+	vk::DescriptorSetLayoutCreateInfo set_layout_info{};
+	set_layout_info.bindingCount = 2;
+	set_layout_info.pBindings = bindings;
+	compute_set_layout = ZVK_Handle<vk::DescriptorSetLayout>(device, device.createDescriptorSetLayout(set_layout_info));
+
+	vk::PushConstantRange sizes_range{ vk::ShaderStageFlagBits::eCompute, 0, 4 * sizeof(int32_t) };
+	vk::PipelineLayoutCreateInfo pipeline_layout_info{};
+	pipeline_layout_info.setLayoutCount = 1;
+	pipeline_layout_info.pSetLayouts = compute_set_layout.ptr();
+	pipeline_layout_info.pushConstantRangeCount = 1;
+	pipeline_layout_info.pPushConstantRanges = &sizes_range;
+	compute_pipeline_layout = ZVK_Handle<vk::PipelineLayout>(device, device.createPipelineLayout(pipeline_layout_info));
+
+	vk::ShaderModuleCreateInfo module_info{};
+	module_info.pCode = comp_downsample_spir_v;
+	module_info.codeSize = sizeof(comp_downsample_spir_v);
+	compute_shader = ZVK_Handle<vk::ShaderModule>(device, device.createShaderModule(module_info));
+
+	vk::ComputePipelineCreateInfo pipeline_info{};
+	pipeline_info.stage.stage = vk::ShaderStageFlagBits::eCompute;
+	pipeline_info.stage.module = compute_shader;
+	pipeline_info.stage.pName = "main";
+	pipeline_info.layout = compute_pipeline_layout;
+	compute_pipeline = ZVK_Handle<vk::Pipeline>(device, device.createComputePipeline(vk::PipelineCache{}, pipeline_info));
+	if (!compute_pipeline)
+	{
+		throw std::domain_error{ "Mip generation Compute Pipeline was not created" };
+	}
+
+	vk::SamplerCreateInfo sampler_info{};
+	sampler_info.magFilter = vk::Filter::eNearest;
+	sampler_info.minFilter = vk::Filter::eNearest;
+	sampler_info.addressModeU = vk::SamplerAddressMode::eClampToEdge;
+	sampler_info.addressModeV = vk::SamplerAddressMode::eClampToEdge;
+	sampler_info.addressModeW = vk::SamplerAddressMode::eClampToEdge;
+	sampler_info.maxAnisotropy = 1.0f;
+	nearest_sampler = ZVK_Handle<vk::Sampler>(device, device.createSampler(sampler_info));
+
+	const std::vector<ZVK_DescriptorAllocator::pool_size_ratio> ratios{
+		{ vk::DescriptorType::eCombinedImageSampler, 1.0f },
+		{ vk::DescriptorType::eStorageImage, 1.0f } };
+	descriptor_allocator.reset(new ZVK_DescriptorAllocator(device, 64, ratios));
+}
+
+vk::ImageView ZVK_MipGenerator::create_LevelView(const ZVK_Texture& texture, uint32_t level)
+{
+	vk::ImageViewCreateInfo view_info{};
+	view_info.image = texture.image;
+	view_info.viewType = vk::ImageViewType::e2D;
+	view_info.format = texture.format;
+	view_info.subresourceRange = vk::ImageSubresourceRange{ vk::ImageAspectFlagBits::eColor, level, 1, 0, 1 };
+
+	level_views.push_back(ZVK_Handle<vk::ImageView>(device, device.createImageView(view_info)));
+	return level_views.back();
+}
@@ -0,0 +1,96 @@
+/* ZVK_MipGenerator.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_MipGenerator_h
+#define ZVK_MipGenerator_h
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <memory>
+
+#include "ZVK_Handle.h"
+#include "ZVK_DescriptorAllocator.h"
+#include "ZVK_TextureUploader.h"
+
+/* Generates the mip chain of textures on the GPU. Every level is blitted */
+/* with linear filtering from the previous one; formats which cannot be  */
+/* blitted that way are downsampled by a compute shader instead.         */
+/* A batch records the same level of all its textures between the same   */
+/* barriers, so many textures are processed by one command buffer.      */
+class ZVK_MipGenerator
+{
+public:
+	enum method
+	{
+		unsupported,
+		blit,
+		compute
+	};
+
+	/* The compute path writes storage images without a format qualifier, */
+	/* it needs shaderStorageImageWriteWithoutFormat to be enabled.        */
+	ZVK_MipGenerator(vk::Device device, vk::PhysicalDevice gpu, bool storage_write_without_format);
+
+	ZVK_MipGenerator(const ZVK_MipGenerator&) = delete;
+	ZVK_MipGenerator& operator=(const ZVK_MipGenerator&) = delete;
+
+	static uint32_t get_LevelsQty(vk::Extent2D extent);
+
+	method get_Method(vk::Format format) const;
+	/* Usage the image has to be created with for its mips to be generated. */
+	vk::ImageUsageFlags get_RequiredUsage(vk::Format format) const;
+
+	/* Level 0 of every texture is written, all its levels are in         */
+	/* eTransferDstOptimal; afterwards they are in eShaderReadOnlyOptimal. */
+	void record(vk::CommandBuffer cmd, const std::vector<const ZVK_Texture*>& textures);
+
+	/* The command buffers recorded so far have completed. */
+	void batch_completed();
+private:
+	void record_Blit(vk::CommandBuffer cmd, const std::vector<const ZVK_Texture*>& textures);
+	void record_Compute(vk::CommandBuffer cmd, const std::vector<const ZVK_Texture*>& textures);
+	void create_ComputePipeline();
+	vk::ImageView create_LevelView(const ZVK_Texture& texture, uint32_t level);
+
+	vk::Device device;
+	vk::PhysicalDevice gpu;
+	bool storage_write_without_format;
+
+	ZVK_Handle<vk::DescriptorSetLayout> compute_set_layout;
+	ZVK_Handle<vk::PipelineLayout> compute_pipeline_layout;
+	ZVK_Handle<vk::ShaderModule> compute_shader;
+	ZVK_Handle<vk::Pipeline> compute_pipeline;
+	ZVK_Handle<vk::Sampler> nearest_sampler;
+
+	// Used by recorded command buffers until batch_completed().
+	std::unique_ptr<ZVK_DescriptorAllocator> descriptor_allocator;
+	std::vector<ZVK_Handle<vk::ImageView>> level_views;
+};
+
+#endif // !ZVK_MipGenerator_h
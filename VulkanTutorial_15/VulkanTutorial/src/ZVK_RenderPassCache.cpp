@@ -0,0 +1,158 @@
+/* ZVK_RenderPassCache.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_RenderPassCache.h"
+#include "ZVK_Hash.h"
+#include <stdexcept>
+
+namespace
+{
+	void hash_attachment(size_t& seed, const ZVK_RenderPassCache::attachment& a)
+	{
+		hash_combine(seed, static_cast<uint32_t>(a.format));
+		hash_combine(seed, static_cast<uint32_t>(a.samples));
+		hash_combine(seed, static_cast<uint32_t>(a.load_op));
+		hash_combine(seed, static_cast<uint32_t>(a.store_op));
+		hash_combine(seed, static_cast<uint32_t>(a.stencil_load_op));
+		hash_combine(seed, static_cast<uint32_t>(a.stencil_store_op));
+		hash_combine(seed, static_cast<uint32_t>(a.initial_layout));
+		hash_combine(seed, static_cast<uint32_t>(a.final_layout));
+	}
+
+	vk::AttachmentDescription describe(const ZVK_RenderPassCache::attachment& a)
+	{
+		vk::AttachmentDescription d{};
+		d.format = a.format;
+		d.samples = a.samples;
+		d.loadOp = a.load_op;
+		d.storeOp = a.store_op;
+		d.stencilLoadOp = a.stencil_load_op;
+		d.stencilStoreOp = a.stencil_store_op;
+		d.initialLayout = a.initial_layout;
+		d.finalLayout = a.final_layout;
+		return d;
+	}
+}
+
+bool ZVK_RenderPassCache::attachment::operator==(const attachment& rhs) const
+{
+	return format == rhs.format
+		&& samples == rhs.samples
+		&& load_op == rhs.load_op
+		&& store_op == rhs.store_op
+		&& stencil_load_op == rhs.stencil_load_op
+		&& stencil_store_op == rhs.stencil_store_op
+		&& initial_layout == rhs.initial_layout
+		&& final_layout == rhs.final_layout;
+}
+
+bool ZVK_RenderPassCache::signature::operator==(const signature& rhs) const
+{
+	return colors == rhs.colors
+		&& has_depth == rhs.has_depth
+		&& (!has_depth || depth == rhs.depth);
+}
+
+ZVK_RenderPassCache::ZVK_RenderPassCache(vk::Device device)
+	: device(device)
+{
+}
+
+vk::RenderPass ZVK_RenderPassCache::get(const signature& s)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto found = render_passes.find(s);
+	if (found != render_passes.end())
+	{
+		return found->second;
+	}
+
+	ZVK_Handle<vk::RenderPass> render_pass(device, create_RenderPass(s));
+	if (!render_pass)
+	{
+		throw std::domain_error{ "Render Pass cannot be created" };
+	}
+
+	vk::RenderPass result = render_pass;
+	render_passes.emplace(s, std::move(render_pass));
+	return result;
+}
+
+size_t ZVK_RenderPassCache::size() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return render_passes.size();
+}
+
+vk::RenderPass ZVK_RenderPassCache::create_RenderPass(const signature& s)
+{
+	std::vector<vk::AttachmentDescription> attachments;
+	std::vector<vk::AttachmentReference> color_references;
+	for (auto& c : s.colors)
+	{
+		color_references.push_back(vk::AttachmentReference{ static_cast<uint32_t>(attachments.size()), vk::ImageLayout::eColorAttachmentOptimal });
+		attachments.push_back(describe(c));
+	}
+
+	vk::AttachmentReference depth_reference{ static_cast<uint32_t>(attachments.size()), vk::ImageLayout::eDepthStencilAttachmentOptimal };
+	if (s.has_depth)
+	{
+		attachments.push_back(describe(s.depth));
+	}
+
+	vk::SubpassDescription subpass{};
+	subpass.pipelineBindPoint = vk::PipelineBindPoint::eGraphics;
+	subpass.colorAttachmentCount = static_cast<uint32_t>(color_references.size());
+	subpass.pColorAttachments = color_references.data();
+	subpass.pDepthStencilAttachment = s.has_depth ? &depth_reference : nullptr;
+
+	vk::RenderPassCreateInfo rp_info{};
+	rp_info.attachmentCount = static_cast<uint32_t>(attachments.size());
+	rp_info.pAttachments = attachments.data();
+	rp_info.subpassCount = 1;
+	rp_info.pSubpasses = &subpass;
+
+	return device.createRenderPass(rp_info);
+}
+
+size_t ZVK_RenderPassCache::signature_hash::operator()(const signature& s) const
+{
+	size_t seed = 0;
+	for (auto& c : s.colors)
+	{
+		hash_attachment(seed, c);
+	}
+	hash_combine(seed, s.has_depth);
+	if (s.has_depth)
+	{
+		hash_attachment(seed, s.depth);
+	}
+	return seed;
+}
@@ -0,0 +1,91 @@
+/* ZVK_RenderPassCache.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_RenderPassCache_h
+#define ZVK_RenderPassCache_h
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+#include "ZVK_Handle.h"
+
+/* Shares render passes between requests with the same attachments.     */
+/* A signature describes a single subpass render pass: its color         */
+/* attachments in order, followed by an optional depth/stencil one.      */
+class ZVK_RenderPassCache
+{
+public:
+	struct attachment
+	{
+		vk::Format format;
+		vk::SampleCountFlagBits samples;
+		vk::AttachmentLoadOp load_op;
+		vk::AttachmentStoreOp store_op;
+		vk::AttachmentLoadOp stencil_load_op;
+		vk::AttachmentStoreOp stencil_store_op;
+		vk::ImageLayout initial_layout;
+		vk::ImageLayout final_layout;
+
+		bool operator==(const attachment& rhs) const;
+	};
+
+	struct signature
+	{
+		std::vector<attachment> colors;
+		bool has_depth;
+		attachment depth;
+
+		bool operator==(const signature& rhs) const;
+	};
+
+	explicit ZVK_RenderPassCache(vk::Device device);
+
+	ZVK_RenderPassCache(const ZVK_RenderPassCache&) = delete;
+	ZVK_RenderPassCache& operator=(const ZVK_RenderPassCache&) = delete;
+
+	vk::RenderPass get(const signature& s);
+
+	size_t size() const;
+private:
+	struct signature_hash
+	{
+		size_t operator()(const signature& s) const;
+	};
+
+	vk::RenderPass create_RenderPass(const signature& s);
+
+	vk::Device device;
+
+	mutable std::mutex mutex;
+	std::unordered_map<signature, ZVK_Handle<vk::RenderPass>, signature_hash> render_passes;
+};
+
+#endif // !ZVK_RenderPassCache_h
@@ -0,0 +1,105 @@
+/* ZVK_SamplerCache.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_SamplerCache.h"
+#include "ZVK_Hash.h"
+#include <stdexcept>
+
+ZVK_SamplerCache::ZVK_SamplerCache(vk::Device device)
+	: device(device)
+{
+}
+
+vk::Sampler ZVK_SamplerCache::get(const vk::SamplerCreateInfo& info)
+{
+	if (info.pNext)
+	{
+		throw std::domain_error{ "Sampler Cache does not support extension structures" };
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto found = samplers.find(info);
+	if (found != samplers.end())
+	{
+		++hits;
+		return found->second;
+	}
+
+	++misses;
+	ZVK_Handle<vk::Sampler> sampler(device, device.createSampler(info));
+	if (!sampler)
+	{
+		throw std::domain_error{ "Sampler cannot be created" };
+	}
+
+	vk::Sampler result = sampler;
+	samplers.emplace(info, std::move(sampler));
+	return result;
+}
+
+size_t ZVK_SamplerCache::size() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return samplers.size();
+}
+
+size_t ZVK_SamplerCache::get_Hits() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return hits;
+}
+
+size_t ZVK_SamplerCache::get_Misses() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return misses;
+}
+
+size_t ZVK_SamplerCache::info_hash::operator()(const vk::SamplerCreateInfo& info) const
+{
+	size_t seed = 0;
+	hash_combine(seed, static_cast<VkSamplerCreateFlags>(info.flags));
+	hash_combine(seed, static_cast<uint32_t>(info.magFilter));
+	hash_combine(seed, static_cast<uint32_t>(info.minFilter));
+	hash_combine(seed, static_cast<uint32_t>(info.mipmapMode));
+	hash_combine(seed, static_cast<uint32_t>(info.addressModeU));
+	hash_combine(seed, static_cast<uint32_t>(info.addressModeV));
+	hash_combine(seed, static_cast<uint32_t>(info.addressModeW));
+	hash_combine(seed, info.mipLodBias);
+	hash_combine(seed, info.anisotropyEnable);
+	hash_combine(seed, info.maxAnisotropy);
+	hash_combine(seed, info.compareEnable);
+	hash_combine(seed, static_cast<uint32_t>(info.compareOp));
+	hash_combine(seed, info.minLod);
+	hash_combine(seed, info.maxLod);
+	hash_combine(seed, static_cast<uint32_t>(info.borderColor));
+	hash_combine(seed, info.unnormalizedCoordinates);
+	return seed;
+}
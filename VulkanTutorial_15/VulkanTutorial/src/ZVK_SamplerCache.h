@@ -0,0 +1,72 @@
+/* ZVK_SamplerCache.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_SamplerCache_h
+#define ZVK_SamplerCache_h
+
+#include <vulkan/vulkan.hpp>
+#include <unordered_map>
+#include <mutex>
+
+#include "ZVK_Handle.h"
+
+/* Shares one vk::Sampler between all requests of the same sampler state. */
+/* Samplers live until the cache is destroyed, as the number of distinct  */
+/* states is small and maxSamplerAllocationCount is limited.              */
+class ZVK_SamplerCache
+{
+public:
+	explicit ZVK_SamplerCache(vk::Device device);
+
+	ZVK_SamplerCache(const ZVK_SamplerCache&) = delete;
+	ZVK_SamplerCache& operator=(const ZVK_SamplerCache&) = delete;
+
+	/* Extension structures are not supported, pNext must be nullptr. */
+	vk::Sampler get(const vk::SamplerCreateInfo& info);
+
+	size_t size() const;
+	size_t get_Hits() const;
+	size_t get_Misses() const;
+private:
+	struct info_hash
+	{
+		size_t operator()(const vk::SamplerCreateInfo& info) const;
+	};
+
+	vk::Device device;
+
+	// Textures are created by concurrent initialization stages.
+	mutable std::mutex mutex;
+	std::unordered_map<vk::SamplerCreateInfo, ZVK_Handle<vk::Sampler>, info_hash> samplers;
+
+	size_t hits{};
+	size_t misses{};
+};
+
+#endif // !ZVK_SamplerCache_h
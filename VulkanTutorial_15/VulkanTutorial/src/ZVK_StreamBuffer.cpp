@@ -0,0 +1,84 @@
+/* ZVK_StreamBuffer.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_StreamBuffer.h"
+#include "ZVK_Memory.h"
+#include <stdexcept>
+#include <algorithm>
+
+ZVK_StreamBuffer::ZVK_StreamBuffer(vk::Device device, vk::PhysicalDevice gpu, vk::BufferUsageFlags usage,
+	vk::DeviceSize slice_size, uint32_t slices_qty, vk::DeviceSize alignment)
+	: device(device)
+	, memory_properties(gpu.getMemoryProperties())
+	, usage(usage)
+	, slice_size(slice_size)
+	, slices_qty(slices_qty)
+	, alignment(alignment)
+{
+	allocate();
+}
+
+uint8_t* ZVK_StreamBuffer::begin_Frame(uint64_t frame)
+{
+	offset = (frame % slices_qty) * slice_stride;
+	return data + offset;
+}
+
+void ZVK_StreamBuffer::reserve(vk::DeviceSize size)
+{
+	if (size <= slice_size)
+	{
+		return;
+	}
+
+	// Grows geometrically, so a slowly rising size reallocates rarely.
+	slice_size = std::max(size, 2 * slice_size);
+	buffer = ZVK_Handle<vk::Buffer>();
+	memory = ZVK_Handle<vk::DeviceMemory>();
+	allocate();
+}
+
+void ZVK_StreamBuffer::allocate()
+{
+	slice_stride = (slice_size + alignment - 1) / alignment * alignment;
+
+	vk::BufferCreateInfo buf_info{};
+	buf_info.usage = usage;
+	buf_info.size = slice_stride * slices_qty;
+	buf_info.sharingMode = vk::SharingMode::eExclusive;
+	buffer = ZVK_Handle<vk::Buffer>(device, device.createBuffer(buf_info));
+	if (!buffer)
+	{
+		throw std::domain_error{ "Stream Buffer cannot be created" };
+	}
+
+	data = static_cast<uint8_t*>(ZVK_Memory::map_Buffer(device, memory_properties, buffer, memory, "Stream Buffer"));
+	offset = 0;
+}
+
@@ -0,0 +1,84 @@
+/* ZVK_StreamBuffer.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_StreamBuffer_h
+#define ZVK_StreamBuffer_h
+
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+#include "ZVK_Handle.h"
+
+/* Host visible buffer of per-frame slices that stays mapped. The CPU     */
+/* writes the slice of the current frame while the GPU may still read     */
+/* the slices of the frames before it, so data streamed every frame needs */
+/* neither staging copies nor map/unmap calls.                            */
+class ZVK_StreamBuffer
+{
+public:
+	/* Slices start at multiples of alignment, e.g. of the uniform buffer */
+	/* offset alignment when they are bound as uniforms.                  */
+	ZVK_StreamBuffer(vk::Device device, vk::PhysicalDevice gpu, vk::BufferUsageFlags usage,
+		vk::DeviceSize slice_size, uint32_t slices_qty = 2, vk::DeviceSize alignment = 256);
+
+	ZVK_StreamBuffer(const ZVK_StreamBuffer&) = delete;
+	ZVK_StreamBuffer& operator=(const ZVK_StreamBuffer&) = delete;
+
+	/* Selects the slice of the frame and returns where to write it. */
+	uint8_t* begin_Frame(uint64_t frame);
+
+	/* Grows the slices, the contents are lost. The GPU must not be using */
+	/* the buffer any more.                                               */
+	void reserve(vk::DeviceSize slice_size);
+
+	vk::Buffer get_Buffer() const { return buffer; }
+	/* Offset of the slice selected by begin_Frame. */
+	vk::DeviceSize get_Offset() const { return offset; }
+	vk::DeviceSize get_SliceSize() const { return slice_size; }
+	uint32_t get_SlicesQty() const { return slices_qty; }
+	/* Offset of a slice, frame f writes slice f % get_SlicesQty(). */
+	vk::DeviceSize get_SliceOffset(uint32_t slice) const { return slice * slice_stride; }
+private:
+	void allocate();
+
+	vk::Device device;
+	vk::PhysicalDeviceMemoryProperties memory_properties;
+	vk::BufferUsageFlags usage;
+	vk::DeviceSize slice_size;
+	vk::DeviceSize slice_stride{};
+	uint32_t slices_qty;
+	vk::DeviceSize alignment;
+
+	ZVK_Handle<vk::Buffer> buffer;
+	ZVK_Handle<vk::DeviceMemory> memory;
+	uint8_t* data{};
+	vk::DeviceSize offset{};
+};
+
+#endif // !ZVK_StreamBuffer_h
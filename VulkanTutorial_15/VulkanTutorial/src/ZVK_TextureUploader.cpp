@@ -0,0 +1,270 @@
+/* ZVK_TextureUploader.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "ZVK_TextureUploader.h"
+#include "ZVK_Memory.h"
+#include "ZVK_MipGenerator.h"
+#include <stdexcept>
+#include <chrono>
+#include <cstring>
+
+ZVK_TextureUploader::ZVK_TextureUploader(vk::Device device, vk::PhysicalDevice gpu, uint32_t queue_family_index,
+	ZVK_MipGenerator* mip_generator)
+	: device(device)
+	, mip_generator(mip_generator)
+	, memory_properties(gpu.getMemoryProperties())
+	, queue(device.getQueue(queue_family_index, 0))
+{
+	vk::CommandPoolCreateInfo cmd_pool_info{};
+	cmd_pool_info.queueFamilyIndex = queue_family_index;
+	cmd_pool_info.flags = vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer;
+	cmd_pool = ZVK_Handle<vk::CommandPool>(device, device.createCommandPool(cmd_pool_info));
+	if (!cmd_pool)
+	{
+		throw std::domain_error{ "Upload CommandPool was not created" };
+	}
+
+	vk::CommandBufferAllocateInfo cmd_info{};
+	cmd_info.commandPool = cmd_pool;
+	cmd_info.level = vk::CommandBufferLevel::ePrimary;
+	cmd_info.commandBufferCount = 1;
+	cmd = device.allocateCommandBuffers(cmd_info)[0];
+
+	fence = ZVK_Handle<vk::Fence>(device, device.createFence(vk::FenceCreateInfo{}));
+}
+
+ZVK_Texture ZVK_TextureUploader::upload(const void* pixels, vk::DeviceSize size, vk::Extent2D extent, vk::Format format,
+	bool generate_mips)
+{
+	return std::move(upload_Batch({ source{ pixels, size, extent, format } }, generate_mips)[0]);
+}
+
+std::vector<ZVK_Texture> ZVK_TextureUploader::upload_Batch(const std::vector<source>& sources, bool generate_mips)
+{
+	if (generate_mips && !mip_generator)
+	{
+		throw std::domain_error{ "Texture Uploader has no Mip Generator" };
+	}
+
+	typedef std::chrono::high_resolution_clock clock;
+	auto start = clock::now();
+
+	// Copy offsets are aligned for any texel size.
+	const vk::DeviceSize alignment = 16;
+	std::vector<vk::DeviceSize> offsets(sources.size());
+	vk::DeviceSize total_size = 0;
+	for (size_t i = 0; i < sources.size(); ++i)
+	{
+		offsets[i] = total_size;
+		total_size += (sources[i].size + alignment - 1) / alignment * alignment;
+	}
+
+	reserve_Staging(total_size);
+	for (size_t i = 0; i < sources.size(); ++i)
+	{
+		memcpy(static_cast<uint8_t*>(staging_data) + offsets[i], sources[i].pixels, static_cast<size_t>(sources[i].size));
+	}
+
+	std::vector<ZVK_Texture> textures;
+	textures.reserve(sources.size());
+	for (auto& src : sources)
+	{
+		textures.push_back(create_Texture(src, generate_mips));
+	}
+
+	vk::CommandBufferBeginInfo begin_info{};
+	begin_info.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
+	cmd.begin(begin_info);
+
+	// All levels become transfer destinations, the mips are blitted into them.
+	std::vector<vk::ImageMemoryBarrier> barriers(textures.size());
+	for (size_t i = 0; i < textures.size(); ++i)
+	{
+		barriers[i].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barriers[i].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barriers[i].image = textures[i].image;
+		barriers[i].subresourceRange = vk::ImageSubresourceRange{ vk::ImageAspectFlagBits::eColor, 0, textures[i].mip_levels, 0, 1 };
+		barriers[i].oldLayout = vk::ImageLayout::eUndefined;
+		barriers[i].newLayout = vk::ImageLayout::eTransferDstOptimal;
+		barriers[i].dstAccessMask = vk::AccessFlagBits::eTransferWrite;
+	}
+	cmd.pipelineBarrier(vk::PipelineStageFlagBits::eTopOfPipe, vk::PipelineStageFlagBits::eTransfer,
+		vk::DependencyFlags{}, 0, nullptr, 0, nullptr, static_cast<uint32_t>(barriers.size()), barriers.data());
+
+	for (size_t i = 0; i < textures.size(); ++i)
+	{
+		vk::BufferImageCopy region{};
+		region.bufferOffset = offsets[i];
+		region.imageSubresource = vk::ImageSubresourceLayers{ vk::ImageAspectFlagBits::eColor, 0, 0, 1 };
+		region.imageExtent = vk::Extent3D{ textures[i].extent.width, textures[i].extent.height, 1 };
+		cmd.copyBufferToImage(staging_buffer, textures[i].image, vk::ImageLayout::eTransferDstOptimal, 1, &region);
+	}
+
+	if (generate_mips)
+	{
+		std::vector<const ZVK_Texture*> batch;
+		for (auto& t : textures)
+		{
+			batch.push_back(&t);
+		}
+		mip_generator->record(cmd, batch);
+	}
+	else
+	{
+		for (auto& b : barriers)
+		{
+			b.oldLayout = vk::ImageLayout::eTransferDstOptimal;
+			b.newLayout = vk::ImageLayout::eShaderReadOnlyOptimal;
+			b.srcAccessMask = vk::AccessFlagBits::eTransferWrite;
+			b.dstAccessMask = vk::AccessFlagBits::eShaderRead;
+		}
+		cmd.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eFragmentShader,
+			vk::DependencyFlags{}, 0, nullptr, 0, nullptr, static_cast<uint32_t>(barriers.size()), barriers.data());
+	}
+
+	cmd.end();
+	submit_and_wait();
+	if (generate_mips)
+	{
+		mip_generator->batch_completed();
+	}
+
+	for (auto& t : textures)
+	{
+		vk::ImageViewCreateInfo view_info{};
+		view_info.image = t.image;
+		view_info.viewType = vk::ImageViewType::e2D;
+		view_info.format = t.format;
+		view_info.components = vk::ComponentMapping{ vk::ComponentSwizzle::eR, vk::ComponentSwizzle::eG,
+			vk::ComponentSwizzle::eB, vk::ComponentSwizzle::eA };
+		view_info.subresourceRange = vk::ImageSubresourceRange{ vk::ImageAspectFlagBits::eColor, 0, t.mip_levels, 0, 1 };
+		t.view = ZVK_Handle<vk::ImageView>(device, device.createImageView(view_info));
+		if (!t.view)
+		{
+			throw std::domain_error{ "Texture Image View is not created" };
+		}
+	}
+
+	stats.textures += textures.size();
+	for (auto& src : sources)
+	{
+		stats.bytes += src.size;
+	}
+	stats.seconds += std::chrono::duration<double>(clock::now() - start).count();
+
+	return textures;
+}
+
+ZVK_Texture ZVK_TextureUploader::create_Texture(const source& src, bool generate_mips)
+{
+	ZVK_Texture texture;
+	texture.format = src.format;
+	texture.extent = src.extent;
+	texture.mip_levels = generate_mips ? ZVK_MipGenerator::get_LevelsQty(src.extent) : 1;
+
+	vk::ImageCreateInfo image_info{};
+	image_info.imageType = vk::ImageType::e2D;
+	image_info.format = src.format;
+	image_info.extent = vk::Extent3D{ src.extent.width, src.extent.height, 1 };
+	image_info.mipLevels = texture.mip_levels;
+	image_info.arrayLayers = 1;
+	image_info.samples = vk::SampleCountFlagBits::e1;
+	image_info.tiling = vk::ImageTiling::eOptimal;
+	image_info.usage = vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled;
+	if (generate_mips)
+	{
+		image_info.usage |= mip_generator->get_RequiredUsage(src.format);
+	}
+	image_info.sharingMode = vk::SharingMode::eExclusive;
+	image_info.initialLayout = vk::ImageLayout::eUndefined;
+
+	texture.image = ZVK_Handle<vk::Image>(device, device.createImage(image_info));
+	if (!texture.image)
+	{
+		throw std::domain_error{ "Texture Image is not created" };
+	}
+
+	texture.memory = ZVK_Memory::allocate(device, memory_properties, device.getImageMemoryRequirements(texture.image),
+		vk::MemoryPropertyFlagBits::eDeviceLocal);
+	if (!texture.memory)
+	{
+		throw std::domain_error{ "Texture Memory cannot be allocated" };
+	}
+	device.bindImageMemory(texture.image, texture.memory, 0);
+
+	return texture;
+}
+
+void ZVK_TextureUploader::reserve_Staging(vk::DeviceSize size)
+{
+	if (size <= staging_size)
+	{
+		return;
+	}
+
+	staging_data = nullptr;
+	staging_memory.reset();
+	staging_buffer.reset();
+
+	vk::BufferCreateInfo buf_info{};
+	buf_info.usage = vk::BufferUsageFlagBits::eTransferSrc;
+	buf_info.size = size;
+	buf_info.sharingMode = vk::SharingMode::eExclusive;
+	staging_buffer = ZVK_Handle<vk::Buffer>(device, device.createBuffer(buf_info));
+	if (!staging_buffer)
+	{
+		throw std::domain_error{ "Staging Buffer cannot be created" };
+	}
+
+	staging_data = ZVK_Memory::map_Buffer(device, memory_properties, staging_buffer, staging_memory, "Staging Buffer");
+	staging_size = size;
+}
+
+
+void ZVK_TextureUploader::submit_and_wait()
+{
+	vk::SubmitInfo submit_info{};
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers = &cmd;
+
+	device.resetFences(1, fence.ptr());
+	if (vk::Result::eSuccess != queue.submit(1, &submit_info, fence))
+	{
+		throw std::domain_error{ "Problem while submitting a texture upload" };
+	}
+
+	vk::Result res{};
+	do {
+		res = device.waitForFences(1, fence.ptr(), VK_TRUE, 100000000);
+	} while (res == vk::Result::eTimeout);
+	if (vk::Result::eSuccess != res)
+	{
+		throw std::domain_error{ "Problem while uploading a texture" };
+	}
+}
@@ -0,0 +1,113 @@
+/* ZVK_TextureUploader.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef ZVK_TextureUploader_h
+#define ZVK_TextureUploader_h
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+
+#include "ZVK_Handle.h"
+
+/* A sampled 2D image in device local memory. */
+struct ZVK_Texture
+{
+	ZVK_Handle<vk::Image> image;
+	ZVK_Handle<vk::DeviceMemory> memory;
+	ZVK_Handle<vk::ImageView> view;
+	vk::Format format{};
+	vk::Extent2D extent{};
+	uint32_t mip_levels{ 1 };
+};
+
+class ZVK_MipGenerator;
+
+/* Uploads textures through a host visible staging buffer into optimal  */
+/* tiled device local images. The staging buffer stays mapped and only */
+/* grows, so uploads of similar sizes do not allocate memory.           */
+/* A batch is copied by one command buffer and one submission.         */
+/* Submits to the queue of the given family, the caller must not use    */
+/* that queue from another thread during an upload.                     */
+class ZVK_TextureUploader
+{
+public:
+	struct statistics
+	{
+		size_t textures;
+		vk::DeviceSize bytes;
+		double seconds;
+
+		double megabytes_per_second() const { return seconds > 0.0 ? bytes / (1024.0 * 1024.0) / seconds : 0.0; }
+	};
+
+	/* Pixels of one texture level 0, tightly packed. */
+	struct source
+	{
+		const void* pixels;
+		vk::DeviceSize size;
+		vk::Extent2D extent;
+		vk::Format format;
+	};
+
+	/* Without a mip generator only level 0 is uploaded. */
+	ZVK_TextureUploader(vk::Device device, vk::PhysicalDevice gpu, uint32_t queue_family_index,
+		ZVK_MipGenerator* mip_generator = nullptr);
+
+	ZVK_TextureUploader(const ZVK_TextureUploader&) = delete;
+	ZVK_TextureUploader& operator=(const ZVK_TextureUploader&) = delete;
+
+	/* Waits for the copy, the image is left in eShaderReadOnlyOptimal. */
+	ZVK_Texture upload(const void* pixels, vk::DeviceSize size, vk::Extent2D extent, vk::Format format,
+		bool generate_mips = false);
+	std::vector<ZVK_Texture> upload_Batch(const std::vector<source>& sources, bool generate_mips = false);
+
+	statistics get_Statistics() const { return stats; }
+private:
+	void reserve_Staging(vk::DeviceSize size);
+	ZVK_Texture create_Texture(const source& src, bool generate_mips);
+	void submit_and_wait();
+
+	vk::Device device;
+	ZVK_MipGenerator* mip_generator;
+	vk::PhysicalDeviceMemoryProperties memory_properties;
+	vk::Queue queue;
+
+	ZVK_Handle<vk::CommandPool> cmd_pool;
+	vk::CommandBuffer cmd{};
+	ZVK_Handle<vk::Fence> fence;
+
+	ZVK_Handle<vk::Buffer> staging_buffer;
+	ZVK_Handle<vk::DeviceMemory> staging_memory;
+	vk::DeviceSize staging_size{};
+	void* staging_data{};
+
+	statistics stats{};
+};
+
+#endif // !ZVK_TextureUploader_h
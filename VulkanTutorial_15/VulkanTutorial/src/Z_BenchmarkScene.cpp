@@ -0,0 +1,66 @@
+/* Z_BenchmarkScene.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_BenchmarkScene.h"
+#include <random>
+#include <cmath>
+
+Z_BenchmarkScene::Z_BenchmarkScene(size_t boxes_qty)
+	: centers(3 * boxes_qty)
+	, half_extents(3 * boxes_qty)
+{
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+	std::uniform_real_distribution<float> size(0.1f, 2.0f);
+	for (size_t i = 0; i < boxes_qty; ++i)
+	{
+		for (size_t a = 0; a < 3; ++a)
+		{
+			centers[3 * i + a] = position(random);
+		}
+		for (size_t a = 0; a < 3; ++a)
+		{
+			half_extents[3 * i + a] = size(random);
+		}
+	}
+
+	const float f = 1.0f / std::tan(0.5f * 3.14159265f / 3.0f);
+	const float n = 0.1f;
+	const float z = 150.0f;
+	const float m[16] = {
+		f, 0.0f, 0.0f, 0.0f,
+		0.0f, -f, 0.0f, 0.0f,
+		0.0f, 0.0f, z / (n - z), -1.0f,
+		0.0f, 0.0f, n * z / (n - z), 0.0f };
+	for (size_t k = 0; k < 16; ++k)
+	{
+		projection[k] = m[k];
+	}
+	focal_length = f;
+}
@@ -0,0 +1,55 @@
+/* Z_BenchmarkScene.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_BenchmarkScene_h
+#define Z_BenchmarkScene_h
+
+#include <vector>
+#include <cstddef>
+
+/* Scene shared by the culling, BVH and level of detail benchmarks, so  */
+/* their timings are of the same boxes. The boxes are scattered over a  */
+/* cube 200 units wide around a camera at the origin looking down -z,   */
+/* which keeps about 6% of them.                                        */
+struct Z_BenchmarkScene
+{
+	explicit Z_BenchmarkScene(size_t boxes_qty);
+
+	/* x, y, z of every box. */
+	std::vector<float> centers;
+	std::vector<float> half_extents;
+
+	/* Column-major Vulkan perspective of 60 degrees, near 0.1 and far 150. */
+	float projection[16];
+	/* Cotangent of the half field of view, a world unit at distance 1    */
+	/* covers it times half the viewport height in pixels.                */
+	float focal_length;
+};
+
+#endif // !Z_BenchmarkScene_h
@@ -0,0 +1,786 @@
+/* Z_Bvh.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_Bvh.h"
+#include "Z_BenchmarkScene.h"
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+	typedef std::chrono::high_resolution_clock clock;
+
+	const size_t bins_qty = 16;
+	const uint32_t max_leaf = 4;
+	/* Ranges of at most this many objects are built by one task. */
+	const size_t subtree_objects = 16384;
+	/* Deeper nodes split at the median, so stacks of 128 are enough. */
+	const uint32_t max_sah_depth = 64;
+	const size_t stack_size = 128;
+	/* Top level node standing for a subtree built by a task. */
+	const uint32_t subtree_marker = 0xFFFFFFFFu;
+	const uint32_t inside_flag = 0x80000000u;
+
+	struct box
+	{
+		float min[3];
+		float max[3];
+
+		void reset()
+		{
+			for (int a = 0; a < 3; ++a)
+			{
+				min[a] = std::numeric_limits<float>::max();
+				max[a] = -std::numeric_limits<float>::max();
+			}
+		}
+
+		void grow(const float* lo, const float* hi)
+		{
+			for (int a = 0; a < 3; ++a)
+			{
+				min[a] = std::min(min[a], lo[a]);
+				max[a] = std::max(max[a], hi[a]);
+			}
+		}
+
+		/* Half the surface area, all the heuristic needs. */
+		float area() const
+		{
+			const float x = max[0] - min[0];
+			const float y = max[1] - min[1];
+			const float z = max[2] - min[2];
+			return x < 0.0f ? 0.0f : x * y + y * z + z * x;
+		}
+	};
+
+	struct build_node
+	{
+		box bounds;
+		uint32_t left;
+		uint32_t right;
+		/* Leaves: first object and count, subtree_marker and task index */
+		/* for subtrees, zero count for inner nodes.                     */
+		uint32_t first;
+		uint32_t count;
+	};
+
+	struct build_task
+	{
+		size_t begin;
+		size_t end;
+		uint32_t depth;
+	};
+
+	struct build_context
+	{
+		const float* bounds;
+		const float* centroids;
+		uint32_t* order;
+	};
+
+	/* Splits [begin, end) of the order and returns the first object of */
+	/* the right half, or end to keep the range as a leaf.              */
+	size_t split_Range(const build_context& context, size_t begin, size_t end, uint32_t depth, box& bounds)
+	{
+		box centroid_bounds;
+		bounds.reset();
+		centroid_bounds.reset();
+		for (size_t i = begin; i < end; ++i)
+		{
+			const float* b = context.bounds + 6 * static_cast<size_t>(context.order[i]);
+			const float* c = context.centroids + 3 * static_cast<size_t>(context.order[i]);
+			bounds.grow(b, b + 3);
+			centroid_bounds.grow(c, c);
+		}
+
+		const size_t count = end - begin;
+		if (count <= 1)
+		{
+			return end;
+		}
+
+		int axis = 0;
+		float extent = centroid_bounds.max[0] - centroid_bounds.min[0];
+		for (int a = 1; a < 3; ++a)
+		{
+			if (centroid_bounds.max[a] - centroid_bounds.min[a] > extent)
+			{
+				axis = a;
+				extent = centroid_bounds.max[a] - centroid_bounds.min[a];
+			}
+		}
+
+		// Coincident centroids can't be binned, and SAH can chain thin
+		// splits too deep for the query stacks.
+		const size_t middle = begin + count / 2;
+		if (extent <= 0.0f)
+		{
+			return count <= max_leaf ? end : middle;
+		}
+		if (depth >= max_sah_depth)
+		{
+			std::nth_element(context.order + begin, context.order + middle, context.order + end,
+				[&](uint32_t a, uint32_t b) { return context.centroids[3 * static_cast<size_t>(a) + axis] < context.centroids[3 * static_cast<size_t>(b) + axis]; });
+			return middle;
+		}
+
+		box bin_bounds[bins_qty];
+		size_t bin_counts[bins_qty] = {};
+		for (size_t b = 0; b < bins_qty; ++b)
+		{
+			bin_bounds[b].reset();
+		}
+		const float origin = centroid_bounds.min[axis];
+		const float scale = bins_qty / extent;
+		auto bin_of = [&](uint32_t object)
+		{
+			const size_t b = static_cast<size_t>((context.centroids[3 * static_cast<size_t>(object) + axis] - origin) * scale);
+			return std::min(b, bins_qty - 1);
+		};
+		for (size_t i = begin; i < end; ++i)
+		{
+			const size_t b = bin_of(context.order[i]);
+			const float* bounds_of = context.bounds + 6 * static_cast<size_t>(context.order[i]);
+			bin_bounds[b].grow(bounds_of, bounds_of + 3);
+			++bin_counts[b];
+		}
+
+		// Areas and counts left of every plane, then the sweep from the right
+		// prices each plane.
+		float left_areas[bins_qty - 1];
+		size_t left_counts[bins_qty - 1];
+		box sweep;
+		sweep.reset();
+		size_t swept = 0;
+		for (size_t b = 0; b + 1 < bins_qty; ++b)
+		{
+			sweep.grow(bin_bounds[b].min, bin_bounds[b].max);
+			swept += bin_counts[b];
+			left_areas[b] = sweep.area();
+			left_counts[b] = swept;
+		}
+
+		float best_cost = std::numeric_limits<float>::max();
+		size_t best_plane = 0;
+		sweep.reset();
+		swept = 0;
+		for (size_t b = bins_qty - 1; b > 0; --b)
+		{
+			sweep.grow(bin_bounds[b].min, bin_bounds[b].max);
+			swept += bin_counts[b];
+			if (swept == 0 || swept == count)
+			{
+				continue;
+			}
+			const float cost = left_areas[b - 1] * left_counts[b - 1] + sweep.area() * swept;
+			if (cost < best_cost)
+			{
+				best_cost = cost;
+				best_plane = b;
+			}
+		}
+
+		// A traversal step costs about as much as testing one object.
+		const float area = bounds.area();
+		if (count <= max_leaf && (best_plane == 0 || area <= 0.0f || 1.0f + best_cost / area >= static_cast<float>(count)))
+		{
+			return end;
+		}
+		if (best_plane == 0)
+		{
+			return middle;
+		}
+
+		uint32_t* split = std::partition(context.order + begin, context.order + end,
+			[&](uint32_t object) { return bin_of(object) < best_plane; });
+		return static_cast<size_t>(split - context.order);
+	}
+
+	/* Builds [begin, end) into nodes and returns the index of its root. */
+	/* With tasks, ranges small enough become subtree markers queued as  */
+	/* tasks instead.                                                    */
+	uint32_t build_Range(const build_context& context, size_t begin, size_t end, uint32_t depth,
+		std::vector<build_node>& nodes, std::vector<build_task>* tasks)
+	{
+		const uint32_t index = static_cast<uint32_t>(nodes.size());
+		nodes.push_back(build_node());
+		if (tasks && end - begin <= subtree_objects)
+		{
+			nodes[index].first = subtree_marker;
+			nodes[index].count = static_cast<uint32_t>(tasks->size());
+			build_task task = { begin, end, depth };
+			tasks->push_back(task);
+			return index;
+		}
+
+		box bounds;
+		const size_t split = split_Range(context, begin, end, depth, bounds);
+		nodes[index].bounds = bounds;
+		if (split == end)
+		{
+			nodes[index].first = static_cast<uint32_t>(begin);
+			nodes[index].count = static_cast<uint32_t>(end - begin);
+			return index;
+		}
+
+		const uint32_t left = build_Range(context, begin, split, depth + 1, nodes, tasks);
+		const uint32_t right = build_Range(context, split, end, depth + 1, nodes, tasks);
+		nodes[index].left = left;
+		nodes[index].right = right;
+		nodes[index].count = 0;
+		return index;
+	}
+
+	/* Copies the tree under index depth first, replacing subtree markers */
+	/* by the subtrees.                                                   */
+	void flatten(const std::vector<build_node>& source, uint32_t index, const std::vector<std::vector<build_node>>& subtrees,
+		uint32_t parent, std::vector<Z_Bvh::node>& nodes, std::vector<uint32_t>& parents)
+	{
+		const build_node& from = source[index];
+		if (from.first == subtree_marker)
+		{
+			flatten(subtrees[from.count], 0, subtrees, parent, nodes, parents);
+			return;
+		}
+
+		const uint32_t at = static_cast<uint32_t>(nodes.size());
+		Z_Bvh::node to;
+		std::memcpy(to.min, from.bounds.min, sizeof(to.min));
+		std::memcpy(to.max, from.bounds.max, sizeof(to.max));
+		to.first = from.first;
+		to.count = from.count;
+		nodes.push_back(to);
+		parents.push_back(parent);
+
+		if (from.count == 0)
+		{
+			flatten(source, from.left, subtrees, at, nodes, parents);
+			nodes[at].first = static_cast<uint32_t>(nodes.size());
+			flatten(source, from.right, subtrees, at, nodes, parents);
+		}
+	}
+
+	/* 0 outside, 1 crossing a plane, 2 inside all of them. */
+	int classify_Box(const Z_FrustumCuller::plane* planes, const float* min, const float* max)
+	{
+		const float cx = 0.5f * (min[0] + max[0]), ex = 0.5f * (max[0] - min[0]);
+		const float cy = 0.5f * (min[1] + max[1]), ey = 0.5f * (max[1] - min[1]);
+		const float cz = 0.5f * (min[2] + max[2]), ez = 0.5f * (max[2] - min[2]);
+		int result = 2;
+		for (int p = 0; p < 6; ++p)
+		{
+			const Z_FrustumCuller::plane& plane = planes[p];
+			const float distance = plane.x * cx + plane.y * cy + plane.z * cz + plane.d;
+			const float reach = std::fabs(plane.x) * ex + std::fabs(plane.y) * ey + std::fabs(plane.z) * ez;
+			if (distance + reach < 0.0f)
+			{
+				return 0;
+			}
+			if (distance - reach < 0.0f)
+			{
+				result = 1;
+			}
+		}
+		return result;
+	}
+
+	bool touches_Sphere(const float* center, float radius_squared, const float* min, const float* max)
+	{
+		float distance_squared = 0.0f;
+		for (int a = 0; a < 3; ++a)
+		{
+			const float d = center[a] < min[a] ? min[a] - center[a] : (center[a] > max[a] ? center[a] - max[a] : 0.0f);
+			distance_squared += d * d;
+		}
+		return distance_squared <= radius_squared;
+	}
+
+	/* Entry distance of the ray into the box, or a negative value when it */
+	/* misses the box or enters it beyond limit.                           */
+	float enter_Box(const float* origin, const float* inverse_direction, float limit, const float* min, const float* max)
+	{
+		float entry = 0.0f;
+		float exit = limit;
+		for (int a = 0; a < 3; ++a)
+		{
+			float t0 = (min[a] - origin[a]) * inverse_direction[a];
+			float t1 = (max[a] - origin[a]) * inverse_direction[a];
+			if (t0 > t1)
+			{
+				std::swap(t0, t1);
+			}
+			// Written so NaNs, from a ray on a slab plane, leave the bounds be.
+			entry = t0 > entry ? t0 : entry;
+			exit = t1 < exit ? t1 : exit;
+		}
+		return entry <= exit ? entry : -1.0f;
+	}
+}
+
+void Z_Bvh::build(const float* mins, const float* maxs, size_t objects_qty, Z_JobSystem* jobs)
+{
+	if (objects_qty >= inside_flag)
+	{
+		throw std::domain_error{ "Too many objects for a BVH" };
+	}
+
+	object_bounds.resize(6 * objects_qty);
+	std::vector<float> centroids(3 * objects_qty);
+	objects_order.resize(objects_qty);
+	for (size_t i = 0; i < objects_qty; ++i)
+	{
+		std::memcpy(&object_bounds[6 * i], mins + 3 * i, 3 * sizeof(float));
+		std::memcpy(&object_bounds[6 * i + 3], maxs + 3 * i, 3 * sizeof(float));
+		for (int a = 0; a < 3; ++a)
+		{
+			centroids[3 * i + a] = 0.5f * (mins[3 * i + a] + maxs[3 * i + a]);
+		}
+		objects_order[i] = static_cast<uint32_t>(i);
+	}
+
+	nodes.clear();
+	parents.clear();
+	leaf_of.assign(objects_qty, 0);
+	refit_flags.clear();
+	refit_pending = false;
+	if (objects_qty == 0)
+	{
+		return;
+	}
+
+	build_context context = { object_bounds.data(), centroids.data(), objects_order.data() };
+	std::vector<build_node> top;
+	std::vector<build_task> tasks;
+	build_Range(context, 0, objects_qty, 0, top, jobs ? &tasks : nullptr);
+
+	std::vector<std::vector<build_node>> subtrees(tasks.size());
+	if (tasks.size())
+	{
+		jobs->parallel_for(tasks.size(), 1, [&](size_t begin, size_t end)
+		{
+			for (size_t t = begin; t < end; ++t)
+			{
+				subtrees[t].reserve(2 * (tasks[t].end - tasks[t].begin) / max_leaf + 1);
+				build_Range(context, tasks[t].begin, tasks[t].end, tasks[t].depth, subtrees[t], nullptr);
+			}
+		}, "bvh build");
+	}
+
+	nodes.reserve(2 * objects_qty / max_leaf + 1);
+	parents.reserve(nodes.capacity());
+	flatten(top, 0, subtrees, 0, nodes, parents);
+
+	for (size_t n = 0; n < nodes.size(); ++n)
+	{
+		for (uint32_t i = 0; i < nodes[n].count; ++i)
+		{
+			leaf_of[objects_order[nodes[n].first + i]] = static_cast<uint32_t>(n);
+		}
+	}
+	refit_flags.assign(nodes.size(), 0);
+}
+
+void Z_Bvh::set_Bounds(uint32_t object, const float* min, const float* max)
+{
+	if (object >= leaf_of.size())
+	{
+		throw std::domain_error{ "BVH object out of range" };
+	}
+
+	std::memcpy(&object_bounds[6 * static_cast<size_t>(object)], min, 3 * sizeof(float));
+	std::memcpy(&object_bounds[6 * static_cast<size_t>(object) + 3], max, 3 * sizeof(float));
+	refit_flags[leaf_of[object]] = 1;
+	refit_pending = true;
+}
+
+void Z_Bvh::refit()
+{
+	if (!refit_pending)
+	{
+		return;
+	}
+	refit_pending = false;
+
+	// Children come after their parents, so one backward pass sees every
+	// node after all of its children.
+	for (size_t n = nodes.size(); n-- > 0;)
+	{
+		if (!refit_flags[n])
+		{
+			continue;
+		}
+		refit_flags[n] = 0;
+
+		node& target = nodes[n];
+		box bounds;
+		bounds.reset();
+		if (target.count)
+		{
+			for (uint32_t i = 0; i < target.count; ++i)
+			{
+				const uint32_t object = objects_order[target.first + i];
+				bounds.grow(object_Min(object), object_Max(object));
+			}
+		}
+		else
+		{
+			bounds.grow(nodes[n + 1].min, nodes[n + 1].max);
+			bounds.grow(nodes[target.first].min, nodes[target.first].max);
+		}
+
+		if (std::memcmp(bounds.min, target.min, sizeof(target.min)) || std::memcmp(bounds.max, target.max, sizeof(target.max)))
+		{
+			std::memcpy(target.min, bounds.min, sizeof(target.min));
+			std::memcpy(target.max, bounds.max, sizeof(target.max));
+			if (n)
+			{
+				refit_flags[parents[n]] = 1;
+			}
+		}
+	}
+}
+
+void Z_Bvh::query_Frustum(const Z_FrustumCuller::plane* planes, std::vector<uint32_t>& objects) const
+{
+	if (nodes.empty())
+	{
+		return;
+	}
+
+	// Nodes inside the frustum are flagged, nothing under them is tested.
+	uint32_t stack[stack_size];
+	size_t top = 0;
+	stack[top++] = 0;
+	while (top)
+	{
+		const uint32_t entry = stack[--top];
+		const node& current = nodes[entry & ~inside_flag];
+		uint32_t inside = entry & inside_flag;
+		if (!inside)
+		{
+			const int side = classify_Box(planes, current.min, current.max);
+			if (side == 0)
+			{
+				continue;
+			}
+			inside = side == 2 ? inside_flag : 0;
+		}
+
+		if (current.count == 0)
+		{
+			stack[top++] = current.first | inside;
+			stack[top++] = ((entry & ~inside_flag) + 1) | inside;
+			continue;
+		}
+		for (uint32_t i = 0; i < current.count; ++i)
+		{
+			const uint32_t object = objects_order[current.first + i];
+			if (inside || classify_Box(planes, object_Min(object), object_Max(object)))
+			{
+				objects.push_back(object);
+			}
+		}
+	}
+}
+
+void Z_Bvh::query_Sphere(const float* center, float radius, std::vector<uint32_t>& objects) const
+{
+	if (nodes.empty())
+	{
+		return;
+	}
+
+	const float radius_squared = radius * radius;
+	uint32_t stack[stack_size];
+	size_t top = 0;
+	stack[top++] = 0;
+	while (top)
+	{
+		const uint32_t index = stack[--top];
+		const node& current = nodes[index];
+		if (!touches_Sphere(center, radius_squared, current.min, current.max))
+		{
+			continue;
+		}
+
+		if (current.count == 0)
+		{
+			stack[top++] = current.first;
+			stack[top++] = index + 1;
+			continue;
+		}
+		for (uint32_t i = 0; i < current.count; ++i)
+		{
+			const uint32_t object = objects_order[current.first + i];
+			if (touches_Sphere(center, radius_squared, object_Min(object), object_Max(object)))
+			{
+				objects.push_back(object);
+			}
+		}
+	}
+}
+
+Z_Bvh::ray_hit Z_Bvh::cast_Ray(const float* origin, const float* direction, float max_distance) const
+{
+	ray_hit hit = { no_object, max_distance };
+	if (nodes.empty())
+	{
+		return hit;
+	}
+
+	const float inverse[3] = { 1.0f / direction[0], 1.0f / direction[1], 1.0f / direction[2] };
+	if (enter_Box(origin, inverse, max_distance, nodes[0].min, nodes[0].max) < 0.0f)
+	{
+		return hit;
+	}
+
+	// Entries keep the distance their node was entered at, so nodes behind
+	// a nearer hit found meanwhile are dropped.
+	uint32_t stack[stack_size];
+	float entered[stack_size];
+	size_t top = 0;
+	stack[top] = 0;
+	entered[top++] = 0.0f;
+	while (top)
+	{
+		--top;
+		if (entered[top] > hit.distance)
+		{
+			continue;
+		}
+		const uint32_t index = stack[top];
+		const node& current = nodes[index];
+
+		if (current.count)
+		{
+			for (uint32_t i = 0; i < current.count; ++i)
+			{
+				const uint32_t object = objects_order[current.first + i];
+				const float distance = enter_Box(origin, inverse, hit.distance, object_Min(object), object_Max(object));
+				if (distance >= 0.0f && (distance < hit.distance || hit.object == no_object))
+				{
+					hit.object = object;
+					hit.distance = distance;
+				}
+			}
+			continue;
+		}
+
+		// The nearer child is pushed last to be visited first.
+		uint32_t near_child = index + 1;
+		uint32_t far_child = current.first;
+		float near_distance = enter_Box(origin, inverse, hit.distance, nodes[near_child].min, nodes[near_child].max);
+		float far_distance = enter_Box(origin, inverse, hit.distance, nodes[far_child].min, nodes[far_child].max);
+		if (far_distance >= 0.0f && (near_distance < 0.0f || far_distance < near_distance))
+		{
+			std::swap(near_child, far_child);
+			std::swap(near_distance, far_distance);
+		}
+		if (far_distance >= 0.0f)
+		{
+			stack[top] = far_child;
+			entered[top++] = far_distance;
+		}
+		if (near_distance >= 0.0f)
+		{
+			stack[top] = near_child;
+			entered[top++] = near_distance;
+		}
+	}
+	return hit;
+}
+
+void Z_Bvh::benchmark(std::ostream& out, Z_JobSystem& jobs, size_t objects_qty)
+{
+	// The boxes and the camera of the frustum culling benchmark.
+	const Z_BenchmarkScene scene(objects_qty);
+	std::vector<float> mins(3 * objects_qty);
+	std::vector<float> maxs(3 * objects_qty);
+	for (size_t k = 0; k < 3 * objects_qty; ++k)
+	{
+		mins[k] = scene.centers[k] - scene.half_extents[k];
+		maxs[k] = scene.centers[k] + scene.half_extents[k];
+	}
+	Z_FrustumCuller culler;
+	culler.set_Frustum(scene.projection);
+	const Z_FrustumCuller::plane* planes = culler.get_Planes();
+
+	const auto flags = out.flags();
+	const auto precision = out.precision();
+	out << "BVH of " << objects_qty << " boxes:\n";
+	out << std::fixed << std::setprecision(2);
+	// Brute force times are left out when negative.
+	auto print = [&](const std::string& label, double value, double brute_value, const char* unit, const std::string& rest)
+	{
+		out << "    " << std::left << std::setw(18) << label << std::right << std::setw(10) << value << unit;
+		if (brute_value >= 0.0)
+		{
+			out << ", brute force " << std::setw(10) << brute_value << unit;
+		}
+		out << rest << "\n";
+	};
+	auto milliseconds = [](clock::time_point start) { return std::chrono::duration<double, std::milli>(clock::now() - start).count(); };
+
+	Z_Bvh bvh;
+	auto start = clock::now();
+	bvh.build(mins.data(), maxs.data(), objects_qty, nullptr);
+	print("build, 1 thread:", milliseconds(start), -1.0, " ms", ", " + std::to_string(bvh.get_Nodes().size()) + " nodes");
+	start = clock::now();
+	bvh.build(mins.data(), maxs.data(), objects_qty, &jobs);
+	print("build, " + std::to_string(jobs.size() + 1) + " threads:", milliseconds(start), -1.0, " ms", "");
+
+	// Every box moves, then one in a hundred.
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> jitter(-0.5f, 0.5f);
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		const size_t step = pass ? 100 : 1;
+		for (size_t i = 0; i < objects_qty; i += step)
+		{
+			for (int a = 0; a < 3; ++a)
+			{
+				const float shift = jitter(random);
+				mins[3 * i + a] += shift;
+				maxs[3 * i + a] += shift;
+			}
+		}
+		start = clock::now();
+		for (size_t i = 0; i < objects_qty; i += step)
+		{
+			bvh.set_Bounds(static_cast<uint32_t>(i), &mins[3 * i], &maxs[3 * i]);
+		}
+		bvh.refit();
+		print(pass ? "refit, 1% moved:" : "refit, all moved:", milliseconds(start), -1.0, " ms", "");
+	}
+
+	// Queries of the refit tree against testing every box. Brute force
+	// takes long enough at a million boxes to test only some queries.
+	std::vector<uint32_t> found;
+	std::vector<uint32_t> expected;
+	const size_t frames_qty = 10;
+	start = clock::now();
+	for (size_t frame = 0; frame < frames_qty; ++frame)
+	{
+		found.clear();
+		bvh.query_Frustum(planes, found);
+	}
+	const double frustum_ms = milliseconds(start) / frames_qty;
+	start = clock::now();
+	for (size_t i = 0; i < objects_qty; ++i)
+	{
+		if (classify_Box(planes, &mins[3 * i], &maxs[3 * i]))
+		{
+			expected.push_back(static_cast<uint32_t>(i));
+		}
+	}
+	const double frustum_brute_ms = milliseconds(start);
+	std::sort(found.begin(), found.end());
+	print("frustum:", frustum_ms, frustum_brute_ms, " ms", ", " + std::to_string(found.size()) + " visible" + (found == expected ? "" : ", differs from brute force"));
+
+	const size_t queries_qty = 1000;
+	const size_t brute_queries_qty = 50;
+	std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+	std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+	std::vector<float> origins(3 * queries_qty);
+	std::vector<float> directions(3 * queries_qty);
+	for (size_t q = 0; q < 3 * queries_qty; ++q)
+	{
+		origins[q] = position(random);
+		directions[q] = direction(random);
+	}
+
+	std::vector<ray_hit> hits(queries_qty);
+	start = clock::now();
+	for (size_t q = 0; q < queries_qty; ++q)
+	{
+		hits[q] = bvh.cast_Ray(&origins[3 * q], &directions[3 * q], 1000.0f);
+	}
+	const double ray_us = 1000.0 * milliseconds(start) / queries_qty;
+	size_t ray_mismatches = 0;
+	start = clock::now();
+	for (size_t q = 0; q < brute_queries_qty; ++q)
+	{
+		const float inverse[3] = { 1.0f / directions[3 * q], 1.0f / directions[3 * q + 1], 1.0f / directions[3 * q + 2] };
+		float nearest = 1000.0f;
+		uint32_t object = no_object;
+		for (size_t i = 0; i < objects_qty; ++i)
+		{
+			const float distance = enter_Box(&origins[3 * q], inverse, nearest, &mins[3 * i], &maxs[3 * i]);
+			if (distance >= 0.0f && (distance < nearest || object == no_object))
+			{
+				nearest = distance;
+				object = static_cast<uint32_t>(i);
+			}
+		}
+		// Boxes around the origin tie at zero, the distances must agree.
+		if ((object == no_object) != (hits[q].object == no_object) || nearest != hits[q].distance)
+		{
+			++ray_mismatches;
+		}
+	}
+	const double ray_brute_us = 1000.0 * milliseconds(start) / brute_queries_qty;
+	print("ray:", ray_us, ray_brute_us, " us", ray_mismatches ? ", differs from brute force" : "");
+
+	const float radius = 5.0f;
+	std::vector<size_t> overlaps(queries_qty);
+	start = clock::now();
+	for (size_t q = 0; q < queries_qty; ++q)
+	{
+		found.clear();
+		bvh.query_Sphere(&origins[3 * q], radius, found);
+		overlaps[q] = found.size();
+	}
+	const double sphere_us = 1000.0 * milliseconds(start) / queries_qty;
+	size_t sphere_mismatches = 0;
+	size_t overlaps_qty = 0;
+	start = clock::now();
+	for (size_t q = 0; q < brute_queries_qty; ++q)
+	{
+		size_t touched = 0;
+		for (size_t i = 0; i < objects_qty; ++i)
+		{
+			touched += touches_Sphere(&origins[3 * q], radius * radius, &mins[3 * i], &maxs[3 * i]) ? 1 : 0;
+		}
+		overlaps_qty += touched;
+		sphere_mismatches += touched != overlaps[q] ? 1 : 0;
+	}
+	const double sphere_brute_us = 1000.0 * milliseconds(start) / brute_queries_qty;
+	print("sphere:", sphere_us, sphere_brute_us, " us", ", " + std::to_string(overlaps_qty / brute_queries_qty) + " boxes each" + (sphere_mismatches ? ", differs from brute force" : ""));
+
+	out.flags(flags);
+	out.precision(precision);
+}
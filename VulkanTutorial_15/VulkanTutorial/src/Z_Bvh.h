@@ -0,0 +1,104 @@
+/* Z_Bvh.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_Bvh_h
+#define Z_Bvh_h
+
+#include <vector>
+#include <cstdint>
+#include <ostream>
+
+#include "Z_FrustumCuller.h"
+#include "Z_JobSystem.h"
+
+/* Bounding volume hierarchy of axis aligned boxes. Nodes are split by   */
+/* the surface area heuristic over 16 centroid bins, the top levels on   */
+/* the calling thread and the subtrees below them as jobs. The           */
+/* tree is flattened depth first into 32-byte nodes: the left child of  */
+/* an inner node follows it, the node keeps the index of the right one. */
+/* Moved objects are refit into the nodes of their leaves and up the     */
+/* tree as far as the bounds change, the topology stays as built.        */
+class Z_Bvh
+{
+public:
+	struct node
+	{
+		float min[3];
+		/* Right child of an inner node, first object of a leaf. */
+		uint32_t first;
+		float max[3];
+		/* 0 for inner nodes. */
+		uint32_t count;
+	};
+
+	struct ray_hit
+	{
+		uint32_t object;
+		float distance;
+	};
+
+	static const uint32_t no_object = 0xFFFFFFFFu;
+
+	/* Object i spans mins[3 * i] to maxs[3 * i]. Null jobs build on    */
+	/* the calling thread.                                              */
+	void build(const float* mins, const float* maxs, size_t objects_qty, Z_JobSystem* jobs = nullptr);
+	size_t size() const { return leaf_of.size(); }
+	const std::vector<node>& get_Nodes() const { return nodes; }
+
+	/* Takes effect at the next refit. */
+	void set_Bounds(uint32_t object, const float* min, const float* max);
+	void refit();
+
+	/* Appends the objects whose boxes are not fully behind a plane. */
+	void query_Frustum(const Z_FrustumCuller::plane* planes, std::vector<uint32_t>& objects) const;
+	/* Appends the objects whose boxes the sphere touches. */
+	void query_Sphere(const float* center, float radius, std::vector<uint32_t>& objects) const;
+	/* Nearest box along the ray, within max_distance times the direction */
+	/* length. The object is no_object when nothing is hit.              */
+	ray_hit cast_Ray(const float* origin, const float* direction, float max_distance) const;
+
+	/* Builds, refits and queries objects_qty boxes, and checks the */
+	/* queries against testing every box.                           */
+	static void benchmark(std::ostream& out, Z_JobSystem& jobs, size_t objects_qty);
+private:
+	const float* object_Min(uint32_t object) const { return &object_bounds[6 * static_cast<size_t>(object)]; }
+	const float* object_Max(uint32_t object) const { return &object_bounds[6 * static_cast<size_t>(object) + 3]; }
+
+	std::vector<node> nodes;
+	std::vector<uint32_t> parents;
+	/* Objects of the leaves, every leaf a range of it. */
+	std::vector<uint32_t> objects_order;
+	std::vector<uint32_t> leaf_of;
+	/* Min and max corners of every object. */
+	std::vector<float> object_bounds;
+	std::vector<uint8_t> refit_flags;
+	bool refit_pending{};
+};
+
+#endif // !Z_Bvh_h
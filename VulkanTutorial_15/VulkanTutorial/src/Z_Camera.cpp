@@ -0,0 +1,133 @@
+/* Z_Camera.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_Camera.h"
+#include <stdexcept>
+#include <cmath>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+Z_Camera::Z_Camera()
+	: fov(glm::radians(45.0f))
+	, eye(-5.0f, 3.0f, -10.0f)
+	, target(0.0f, 0.0f, 0.0f)
+	// Head is up (set to 0,-1,0 to look upside-down)
+	, up(0.0f, -1.0f, 0.0f)
+{
+}
+
+void Z_Camera::set_Extent(uint32_t w, uint32_t h)
+{
+	if (!w || !h)
+	{
+		// A minimized window keeps the last projection.
+		return;
+	}
+	if (w != width || h != height)
+	{
+		width = w;
+		height = h;
+		projection_dirty = true;
+	}
+}
+
+void Z_Camera::set_Fov(float radians)
+{
+	if (radians <= 0.0f || radians >= glm::radians(180.0f))
+	{
+		throw std::domain_error{ "Camera field of view out of range" };
+	}
+	if (radians != fov)
+	{
+		fov = radians;
+		projection_dirty = true;
+	}
+}
+
+void Z_Camera::set_DepthRange(float n, float f)
+{
+	if (n <= 0.0f || f <= n)
+	{
+		throw std::domain_error{ "Camera depth range out of range" };
+	}
+	if (n != near_plane || f != far_plane)
+	{
+		near_plane = n;
+		far_plane = f;
+		projection_dirty = true;
+	}
+}
+
+void Z_Camera::look_At(const glm::vec3& e, const glm::vec3& t, const glm::vec3& u)
+{
+	if (e != eye || t != target || u != up)
+	{
+		eye = e;
+		target = t;
+		up = u;
+		view_dirty = true;
+	}
+}
+
+bool Z_Camera::update()
+{
+	if (!projection_dirty && !view_dirty)
+	{
+		return false;
+	}
+
+	if (projection_dirty)
+	{
+		float vertical = fov;
+		if (width > height)
+		{
+			vertical *= static_cast<float>(height) / static_cast<float>(width);
+		}
+		// Vulkan clip space has inverted Y and half Z.
+		const glm::mat4 clip(1.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, -1.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, 0.5f, 0.0f,
+			0.0f, 0.0f, 0.5f, 1.0f);
+		const glm::mat4 perspective = glm::perspective(vertical,
+			static_cast<float>(width) / static_cast<float>(height), near_plane, far_plane);
+		projection = clip * perspective;
+		pixels_per_unit = 0.5f * height * std::abs(perspective[1][1]);
+		projection_dirty = false;
+		++stats.projection_updates;
+	}
+	if (view_dirty)
+	{
+		view = glm::lookAt(eye, target, up);
+		view_dirty = false;
+		++stats.view_updates;
+	}
+
+	view_projection = projection * view;
+	return true;
+}
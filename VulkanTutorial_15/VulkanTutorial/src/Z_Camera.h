@@ -0,0 +1,95 @@
+/* Z_Camera.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_Camera_h
+#define Z_Camera_h
+
+#include <cstdint>
+
+#define GLM_FORCE_RADIANS
+#include <glm/glm.hpp>
+
+/* Perspective camera producing clip * projection * view for Vulkan clip */
+/* space, with inverted y and 0 <= z <= w. Setters only record changes:  */
+/* update rebuilds the projection when the extent, field of view or     */
+/* depth range changed and the view when the camera moved, so calling it */
+/* every frame costs nothing while the camera stands still.              */
+class Z_Camera
+{
+public:
+	struct statistics
+	{
+		uint64_t projection_updates;
+		uint64_t view_updates;
+	};
+
+	Z_Camera();
+
+	void set_Extent(uint32_t width, uint32_t height);
+	/* Vertical angle of square and portrait extents; on landscape ones */
+	/* it shrinks by height / width, so about fov spans the width.      */
+	void set_Fov(float radians);
+	void set_DepthRange(float near_plane, float far_plane);
+	void look_At(const glm::vec3& eye, const glm::vec3& target, const glm::vec3& up);
+
+	const glm::vec3& get_Eye() const { return eye; }
+	const glm::vec3& get_Target() const { return target; }
+	const glm::vec3& get_Up() const { return up; }
+
+	/* Returns whether the view projection changed. */
+	bool update();
+
+	/* clip * perspective, the projection into Vulkan clip space. */
+	const glm::mat4& get_Projection() const { return projection; }
+	const glm::mat4& get_View() const { return view; }
+	const glm::mat4& get_ViewProjection() const { return view_projection; }
+	/* Screen pixels a world unit covers at distance 1. */
+	float get_PixelsPerUnit() const { return pixels_per_unit; }
+
+	statistics get_Statistics() const { return stats; }
+private:
+	uint32_t width{ 1 };
+	uint32_t height{ 1 };
+	float fov;
+	float near_plane{ 0.1f };
+	float far_plane{ 100.0f };
+	glm::vec3 eye;
+	glm::vec3 target;
+	glm::vec3 up;
+
+	bool projection_dirty{ true };
+	bool view_dirty{ true };
+	glm::mat4 projection;
+	glm::mat4 view;
+	glm::mat4 view_projection;
+	float pixels_per_unit{ 1.0f };
+	statistics stats{};
+};
+
+#endif // !Z_Camera_h
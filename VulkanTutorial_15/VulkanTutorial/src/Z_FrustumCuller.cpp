@@ -0,0 +1,338 @@
+/* Z_FrustumCuller.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_FrustumCuller.h"
+#include "Z_Simd.h"
+#include "Z_BenchmarkScene.h"
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+	typedef std::chrono::high_resolution_clock clock;
+
+	/* Objects of a range culled by one task. */
+	const size_t range_size = 16384;
+
+	/* Indices of the set bits of mask, added to base. */
+	size_t append_mask(uint32_t* visible, size_t qty, unsigned mask, uint32_t base)
+	{
+		while (mask)
+		{
+			unsigned bit = 0;
+			while (!(mask & (1u << bit)))
+			{
+				++bit;
+			}
+			visible[qty++] = base + bit;
+			mask &= mask - 1;
+		}
+		return qty;
+	}
+}
+
+Z_FrustumCuller::Z_FrustumCuller()
+{
+	// Until a frustum is set, nothing is culled.
+	for (auto& p : planes)
+	{
+		p = plane{ 0.0f, 0.0f, 0.0f, 1.0f };
+	}
+}
+
+void Z_FrustumCuller::set_Frustum(const float* m)
+{
+	// Gribb & Hartmann: the planes are sums of the matrix rows,
+	// row i is m[i], m[4 + i], m[8 + i], m[12 + i].
+	auto row = [m](size_t i, float sign, size_t j, plane& p)
+	{
+		p.x = m[j] + sign * m[i];
+		p.y = m[4 + j] + sign * m[4 + i];
+		p.z = m[8 + j] + sign * m[8 + i];
+		p.d = m[12 + j] + sign * m[12 + i];
+	};
+	row(0, 1.0f, 3, planes[0]);  // left:   w + x >= 0
+	row(0, -1.0f, 3, planes[1]); // right:  w - x >= 0
+	row(1, 1.0f, 3, planes[2]);  // bottom: w + y >= 0
+	row(1, -1.0f, 3, planes[3]); // top:    w - y >= 0
+	row(2, -1.0f, 3, planes[5]); // far:    w - z >= 0
+	planes[4] = plane{ m[2], m[6], m[10], m[14] }; // near: z >= 0
+
+	// Normalized, so distances compare with the radii.
+	for (auto& p : planes)
+	{
+		const float length = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+		if (length > 0.0f)
+		{
+			p.x /= length;
+			p.y /= length;
+			p.z /= length;
+			p.d /= length;
+		}
+	}
+}
+
+void Z_FrustumCuller::resize(size_t qty)
+{
+	objects_qty = qty;
+	for (auto* a : { &center_x, &center_y, &center_z, &extent_x, &extent_y, &extent_z, &radius })
+	{
+		a->resize(qty, 0.0f);
+	}
+}
+
+void Z_FrustumCuller::set_Bounds(size_t index, const float* center, const float* half_extent)
+{
+	center_x[index] = center[0];
+	center_y[index] = center[1];
+	center_z[index] = center[2];
+	extent_x[index] = half_extent[0];
+	extent_y[index] = half_extent[1];
+	extent_z[index] = half_extent[2];
+	radius[index] = std::sqrt(half_extent[0] * half_extent[0] + half_extent[1] * half_extent[1] + half_extent[2] * half_extent[2]);
+}
+
+void Z_FrustumCuller::cull(std::vector<uint32_t>& visible, Z_JobSystem* jobs)
+{
+	static const Z_Simd::level best = Z_Simd::get_Best();
+	cull(visible, jobs, best);
+}
+
+void Z_FrustumCuller::cull(std::vector<uint32_t>& visible, Z_JobSystem* jobs, Z_Simd::level level)
+{
+	const size_t ranges_qty = (objects_qty + range_size - 1) / range_size;
+	if (!jobs || ranges_qty < 2)
+	{
+		visible.resize(objects_qty);
+		visible.resize(cull_Range(0, objects_qty, visible.data(), level));
+		return;
+	}
+
+	// Every range writes its survivors where its objects are, then they
+	// are moved next to each other in parallel too.
+	scratch.resize(objects_qty);
+	range_counts.resize(ranges_qty);
+	jobs->parallel_for(ranges_qty, 1, [&](size_t begin, size_t end)
+	{
+		for (size_t r = begin; r < end; ++r)
+		{
+			const size_t first = r * range_size;
+			range_counts[r] = cull_Range(first, std::min(first + range_size, objects_qty), scratch.data() + first, level);
+		}
+	}, "cull");
+
+	std::vector<size_t> offsets(ranges_qty + 1, 0);
+	for (size_t r = 0; r < ranges_qty; ++r)
+	{
+		offsets[r + 1] = offsets[r] + range_counts[r];
+	}
+	visible.resize(offsets[ranges_qty]);
+	jobs->parallel_for(ranges_qty, 1, [&](size_t begin, size_t end)
+	{
+		for (size_t r = begin; r < end; ++r)
+		{
+			if (range_counts[r])
+			{
+				std::memcpy(visible.data() + offsets[r], scratch.data() + r * range_size, range_counts[r] * sizeof(uint32_t));
+			}
+		}
+	}, "cull");
+}
+
+size_t Z_FrustumCuller::cull_Range(size_t begin, size_t end, uint32_t* visible, Z_Simd::level level) const
+{
+	switch (level)
+	{
+#ifdef Z_SIMD_AVX
+	case Z_Simd::avx: return cull_Avx(begin, end, visible);
+#endif
+#ifdef Z_SIMD_SSE
+	case Z_Simd::sse: return cull_Sse(begin, end, visible);
+#endif
+	default: return cull_Scalar(begin, end, visible);
+	}
+}
+
+size_t Z_FrustumCuller::cull_Scalar(size_t begin, size_t end, uint32_t* visible) const
+{
+	size_t qty = 0;
+	for (size_t i = begin; i < end; ++i)
+	{
+		bool inside = true;
+		for (size_t k = 0; k < 6 && inside; ++k)
+		{
+			const plane& p = planes[k];
+			// Summed in the order of the SIMD code, for the same results.
+			const float distance = (p.x * center_x[i] + p.y * center_y[i]) + (p.z * center_z[i] + p.d);
+			const float box = std::fabs(p.x) * extent_x[i] + std::fabs(p.y) * extent_y[i] + std::fabs(p.z) * extent_z[i];
+			inside = distance >= -std::min(box, radius[i]);
+		}
+		if (inside)
+		{
+			visible[qty++] = static_cast<uint32_t>(i);
+		}
+	}
+	return qty;
+}
+
+#ifdef Z_SIMD_SSE
+size_t Z_FrustumCuller::cull_Sse(size_t begin, size_t end, uint32_t* visible) const
+{
+	__m128 px[6], py[6], pz[6], pd[6], ax[6], ay[6], az[6];
+	for (size_t k = 0; k < 6; ++k)
+	{
+		px[k] = _mm_set1_ps(planes[k].x);
+		py[k] = _mm_set1_ps(planes[k].y);
+		pz[k] = _mm_set1_ps(planes[k].z);
+		pd[k] = _mm_set1_ps(planes[k].d);
+		ax[k] = _mm_set1_ps(std::fabs(planes[k].x));
+		ay[k] = _mm_set1_ps(std::fabs(planes[k].y));
+		az[k] = _mm_set1_ps(std::fabs(planes[k].z));
+	}
+	const __m128 zero = _mm_setzero_ps();
+
+	size_t qty = 0;
+	size_t i = begin;
+	for (; i + 4 <= end; i += 4)
+	{
+		const __m128 cx = _mm_loadu_ps(&center_x[i]);
+		const __m128 cy = _mm_loadu_ps(&center_y[i]);
+		const __m128 cz = _mm_loadu_ps(&center_z[i]);
+		const __m128 ex = _mm_loadu_ps(&extent_x[i]);
+		const __m128 ey = _mm_loadu_ps(&extent_y[i]);
+		const __m128 ez = _mm_loadu_ps(&extent_z[i]);
+		const __m128 r = _mm_loadu_ps(&radius[i]);
+
+		__m128 outside = zero;
+		for (size_t k = 0; k < 6; ++k)
+		{
+			const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px[k], cx), _mm_mul_ps(py[k], cy)),
+				_mm_add_ps(_mm_mul_ps(pz[k], cz), pd[k]));
+			const __m128 box = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax[k], ex), _mm_mul_ps(ay[k], ey)), _mm_mul_ps(az[k], ez));
+			outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_sub_ps(zero, _mm_min_ps(box, r))));
+		}
+		qty = append_mask(visible, qty, ~_mm_movemask_ps(outside) & 0xf, static_cast<uint32_t>(i));
+	}
+	return qty + cull_Scalar(i, end, visible + qty);
+}
+#endif
+
+#ifdef Z_SIMD_AVX
+Z_AVX_FUNCTION size_t Z_FrustumCuller::cull_Avx(size_t begin, size_t end, uint32_t* visible) const
+{
+	__m256 px[6], py[6], pz[6], pd[6], ax[6], ay[6], az[6];
+	for (size_t k = 0; k < 6; ++k)
+	{
+		px[k] = _mm256_set1_ps(planes[k].x);
+		py[k] = _mm256_set1_ps(planes[k].y);
+		pz[k] = _mm256_set1_ps(planes[k].z);
+		pd[k] = _mm256_set1_ps(planes[k].d);
+		ax[k] = _mm256_set1_ps(std::fabs(planes[k].x));
+		ay[k] = _mm256_set1_ps(std::fabs(planes[k].y));
+		az[k] = _mm256_set1_ps(std::fabs(planes[k].z));
+	}
+	const __m256 zero = _mm256_setzero_ps();
+
+	size_t qty = 0;
+	size_t i = begin;
+	for (; i + 8 <= end; i += 8)
+	{
+		const __m256 cx = _mm256_loadu_ps(&center_x[i]);
+		const __m256 cy = _mm256_loadu_ps(&center_y[i]);
+		const __m256 cz = _mm256_loadu_ps(&center_z[i]);
+		const __m256 ex = _mm256_loadu_ps(&extent_x[i]);
+		const __m256 ey = _mm256_loadu_ps(&extent_y[i]);
+		const __m256 ez = _mm256_loadu_ps(&extent_z[i]);
+		const __m256 r = _mm256_loadu_ps(&radius[i]);
+
+		__m256 outside = zero;
+		for (size_t k = 0; k < 6; ++k)
+		{
+			// No FMA, so the results are the same as the SSE ones.
+			const __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(px[k], cx), _mm256_mul_ps(py[k], cy)),
+				_mm256_add_ps(_mm256_mul_ps(pz[k], cz), pd[k]));
+			const __m256 box = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax[k], ex), _mm256_mul_ps(ay[k], ey)), _mm256_mul_ps(az[k], ez));
+			outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, _mm256_sub_ps(zero, _mm256_min_ps(box, r)), _CMP_LT_OQ));
+		}
+		qty = append_mask(visible, qty, ~_mm256_movemask_ps(outside) & 0xff, static_cast<uint32_t>(i));
+	}
+	// Leaves the upper halves of the YMM registers clean for SSE code.
+	_mm256_zeroupper();
+	return qty + cull_Scalar(i, end, visible + qty);
+}
+#endif
+
+void Z_FrustumCuller::benchmark(std::ostream& out, Z_JobSystem& jobs, size_t objects_qty)
+{
+	const Z_BenchmarkScene scene(objects_qty);
+	Z_FrustumCuller culler;
+	culler.resize(objects_qty);
+	for (size_t i = 0; i < objects_qty; ++i)
+	{
+		culler.set_Bounds(i, &scene.centers[3 * i], &scene.half_extents[3 * i]);
+	}
+	culler.set_Frustum(scene.projection);
+
+	const auto flags = out.flags();
+	const auto precision = out.precision();
+	out << "Frustum culling of " << objects_qty << " boxes:\n";
+	out << std::fixed << std::setprecision(2);
+
+	std::vector<uint32_t> reference;
+	culler.cull(reference, nullptr, Z_Simd::none);
+
+	const char* names[] = { "scalar", "SSE", "AVX" };
+	const size_t frames_qty = 10;
+	for (int level = Z_Simd::none; level <= Z_Simd::get_Best(); ++level)
+	{
+		for (int threaded = 0; threaded < 2; ++threaded)
+		{
+			std::vector<uint32_t> visible;
+			Z_JobSystem* p = threaded ? &jobs : nullptr;
+			auto start = clock::now();
+			for (size_t frame = 0; frame < frames_qty; ++frame)
+			{
+				culler.cull(visible, p, static_cast<Z_Simd::level>(level));
+			}
+			const double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count() / frames_qty;
+
+			out << "    " << std::left << std::setw(7) << names[level] << std::right
+				<< (threaded ? std::to_string(jobs.size() + 1) + " threads: " : "1 thread:  ")
+				<< std::setw(8) << ms << " ms per frame, " << std::setw(8) << objects_qty / ms / 1000.0 << " M objects/s, "
+				<< visible.size() << " visible" << (visible == reference ? "" : ", differs from scalar") << "\n";
+		}
+	}
+
+	out.flags(flags);
+	out.precision(precision);
+}
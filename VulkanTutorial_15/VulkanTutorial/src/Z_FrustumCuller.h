@@ -0,0 +1,95 @@
+/* Z_FrustumCuller.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_FrustumCuller_h
+#define Z_FrustumCuller_h
+
+#include <vector>
+#include <cstdint>
+#include <ostream>
+
+#include "Z_JobSystem.h"
+#include "Z_Simd.h"
+
+/* Frustum culling of axis aligned boxes kept as a structure of arrays,  */
+/* so 4 (SSE) or 8 (AVX) objects are tested against a plane at once.     */
+/* An object is outside when it is behind a plane by more than the       */
+/* smaller of its bounding sphere radius and box projected on the plane. */
+/* Ranges of objects are culled on the job workers and the survivors     */
+/* compacted into one ascending list of indices.                         */
+class Z_FrustumCuller
+{
+public:
+	/* n.p + d >= 0 inside. */
+	struct plane
+	{
+		float x, y, z, d;
+	};
+
+	Z_FrustumCuller();
+
+	/* Column-major clip * projection * view * model, as set_view builds */
+	/* it: Vulkan clip space, with 0 <= z <= w.                          */
+	void set_Frustum(const float* view_projection);
+	const plane* get_Planes() const { return planes; }
+
+	/* New objects are empty boxes at the origin. */
+	void resize(size_t objects_qty);
+	size_t size() const { return objects_qty; }
+	void set_Bounds(size_t index, const float* center, const float* half_extent);
+
+	/* Replaces visible with the indices of the objects in the frustum. */
+	/* Null jobs cull on the calling thread.                            */
+	void cull(std::vector<uint32_t>& visible, Z_JobSystem* jobs = nullptr);
+	void cull(std::vector<uint32_t>& visible, Z_JobSystem* jobs, Z_Simd::level level);
+
+	static void benchmark(std::ostream& out, Z_JobSystem& jobs, size_t objects_qty);
+private:
+	size_t cull_Range(size_t begin, size_t end, uint32_t* visible, Z_Simd::level level) const;
+	size_t cull_Scalar(size_t begin, size_t end, uint32_t* visible) const;
+	size_t cull_Sse(size_t begin, size_t end, uint32_t* visible) const;
+	size_t cull_Avx(size_t begin, size_t end, uint32_t* visible) const;
+
+	size_t objects_qty{};
+	std::vector<float> center_x;
+	std::vector<float> center_y;
+	std::vector<float> center_z;
+	std::vector<float> extent_x;
+	std::vector<float> extent_y;
+	std::vector<float> extent_z;
+	std::vector<float> radius;
+
+	plane planes[6];
+
+	/* Survivors of every range before they are compacted. */
+	std::vector<uint32_t> scratch;
+	std::vector<size_t> range_counts;
+};
+
+#endif // !Z_FrustumCuller_h
@@ -0,0 +1,109 @@
+/* Z_IndexedMesh.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_IndexedMesh.h"
+#include <cstring>
+#include <utility>
+
+namespace
+{
+	uint64_t hash_bytes(const uint8_t* data, size_t size)
+	{
+		// FNV-1a
+		uint64_t h = 14695981039346656037ull;
+		for (size_t i = 0; i < size; ++i)
+		{
+			h ^= data[i];
+			h *= 1099511628211ull;
+		}
+		return h;
+	}
+}
+
+Z_IndexedMesh::Z_IndexedMesh(std::vector<uint8_t> vertices, uint32_t vertex_stride, std::vector<uint32_t> indices)
+	: vertices(std::move(vertices))
+	, indices(std::move(indices))
+	, vertex_stride(vertex_stride)
+{
+}
+
+Z_IndexedMesh Z_IndexedMesh::weld(const void* soup, size_t vertices_qty, uint32_t vertex_stride)
+{
+	Z_IndexedMesh mesh;
+	mesh.vertex_stride = vertex_stride;
+	mesh.indices.reserve(vertices_qty);
+
+	// Open addressing table of unique vertex indices, at most half full.
+	size_t table_size = 16;
+	while (table_size < vertices_qty * 2)
+	{
+		table_size <<= 1;
+	}
+	const uint32_t empty = UINT32_MAX;
+	std::vector<uint32_t> table(table_size, empty);
+
+	const uint8_t* src = static_cast<const uint8_t*>(soup);
+	for (size_t i = 0; i < vertices_qty; ++i)
+	{
+		const uint8_t* v = src + i * vertex_stride;
+		size_t slot = static_cast<size_t>(hash_bytes(v, vertex_stride)) & (table_size - 1);
+		while (table[slot] != empty
+			&& memcmp(&mesh.vertices[table[slot] * static_cast<size_t>(vertex_stride)], v, vertex_stride) != 0)
+		{
+			slot = (slot + 1) & (table_size - 1);
+		}
+
+		if (table[slot] == empty)
+		{
+			table[slot] = static_cast<uint32_t>(mesh.get_VerticesQty());
+			mesh.vertices.insert(mesh.vertices.end(), v, v + vertex_stride);
+		}
+		mesh.indices.push_back(table[slot]);
+	}
+
+	return mesh;
+}
+
+std::vector<uint8_t> Z_IndexedMesh::get_PackedIndices() const
+{
+	std::vector<uint8_t> packed(indices.size() * get_IndexSize());
+	if (fits_16bit_indices())
+	{
+		uint16_t* dst = reinterpret_cast<uint16_t*>(packed.data());
+		for (size_t i = 0; i < indices.size(); ++i)
+		{
+			dst[i] = static_cast<uint16_t>(indices[i]);
+		}
+	}
+	else if (indices.size())
+	{
+		memcpy(packed.data(), indices.data(), packed.size());
+	}
+	return packed;
+}
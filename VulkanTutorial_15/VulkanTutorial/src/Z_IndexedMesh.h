@@ -0,0 +1,71 @@
+/* Z_IndexedMesh.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_IndexedMesh_h
+#define Z_IndexedMesh_h
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/* Triangle list of unique vertices referenced by indices. Vertices are */
+/* opaque records of vertex_stride bytes, so any vertex layout works.   */
+class Z_IndexedMesh
+{
+public:
+	Z_IndexedMesh() {}
+	Z_IndexedMesh(std::vector<uint8_t> vertices, uint32_t vertex_stride, std::vector<uint32_t> indices);
+
+	/* Welds bitwise identical vertices of a triangle soup. */
+	static Z_IndexedMesh weld(const void* soup, size_t vertices_qty, uint32_t vertex_stride);
+
+	const std::vector<uint8_t>& get_Vertices() const { return vertices; }
+	const std::vector<uint32_t>& get_Indices() const { return indices; }
+	uint32_t get_VertexStride() const { return vertex_stride; }
+	size_t get_VerticesQty() const { return vertex_stride ? vertices.size() / vertex_stride : 0; }
+	size_t get_IndicesQty() const { return indices.size(); }
+
+	/* 16-bit indices are enough when every vertex index fits into them. */
+	bool fits_16bit_indices() const { return get_VerticesQty() <= 0x10000; }
+	/* Indices in the smallest sufficient width, 2 or 4 bytes each. */
+	std::vector<uint8_t> get_PackedIndices() const;
+	uint32_t get_IndexSize() const { return fits_16bit_indices() ? 2 : 4; }
+
+	/* With a post-transform cache large enough, a vertex shader runs */
+	/* once per unique vertex instead of once per soup vertex.        */
+	size_t get_SavedInvocations() const { return indices.size() - get_VerticesQty(); }
+private:
+	friend class Z_MeshOptimizer;
+
+	std::vector<uint8_t> vertices;
+	std::vector<uint32_t> indices;
+	uint32_t vertex_stride{};
+};
+
+#endif // !Z_IndexedMesh_h
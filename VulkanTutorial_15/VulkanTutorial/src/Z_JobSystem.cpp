@@ -0,0 +1,445 @@
+/* Z_JobSystem.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_JobSystem.h"
+#include <algorithm>
+#include <iomanip>
+#include <string>
+#include <cmath>
+
+#include "Z_ThreadPool.h"
+
+namespace
+{
+	/* The system the calling thread works for, if any. */
+	thread_local const Z_JobSystem* tls_system = nullptr;
+	thread_local size_t tls_worker_index = 0;
+}
+
+bool Z_JobSystem::counter::is_Done() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return 0 == unfinished;
+}
+
+Z_JobSystem::Z_JobSystem(size_t workers_qty)
+	: queued_jobs(0), sleeping_workers(0), jobs_run(0), jobs_stolen(0)
+{
+	if (!workers_qty)
+	{
+		const size_t hardware_threads = std::thread::hardware_concurrency();
+		workers_qty = hardware_threads > 2 ? hardware_threads - 1 : 1;
+	}
+
+	for (size_t i = 0; i <= workers_qty; ++i)
+	{
+		queues.emplace_back(new job_queue);
+	}
+	workers.reserve(workers_qty);
+	for (size_t i = 0; i < workers_qty; ++i)
+	{
+		workers.emplace_back(&Z_JobSystem::worker_loop, this, i);
+	}
+}
+
+Z_JobSystem::~Z_JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(sleep_mutex);
+		stopping = true;
+	}
+	sleep_cv.notify_all();
+
+	for (auto& w : workers)
+	{
+		w.join();
+	}
+}
+
+void Z_JobSystem::run(const char* name, std::function<void()> work, counter* done)
+{
+	if (done)
+	{
+		std::lock_guard<std::mutex> lock(done->mutex);
+		++done->unfinished;
+	}
+	job queued = { std::move(work), name, done };
+	push(std::move(queued));
+}
+
+void Z_JobSystem::run_After(counter& dependency, const char* name, std::function<void()> work, counter* done)
+{
+	if (done)
+	{
+		std::lock_guard<std::mutex> lock(done->mutex);
+		++done->unfinished;
+	}
+	job queued = { std::move(work), name, done };
+	{
+		// The last job of the dependency queues the continuations under
+		// this lock, so the job is either taken by it or queued here.
+		std::lock_guard<std::mutex> lock(dependency.mutex);
+		if (dependency.unfinished)
+		{
+			dependency.continuations.push_back(std::move(queued));
+			return;
+		}
+	}
+	push(std::move(queued));
+}
+
+void Z_JobSystem::wait(counter& done)
+{
+	const size_t self = current_worker();
+	std::exception_ptr error;
+	for (;;)
+	{
+		{
+			std::lock_guard<std::mutex> lock(done.mutex);
+			if (!done.unfinished)
+			{
+				error = done.error;
+				done.error = nullptr;
+				break;
+			}
+		}
+
+		job found;
+		if (find_Job(self, found))
+		{
+			execute(found, self);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+}
+
+void Z_JobSystem::parallel_for(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body, const char* name)
+{
+	if (!count)
+	{
+		return;
+	}
+
+	grain = std::max<size_t>(grain, 1);
+	const size_t chunks = (count + grain - 1) / grain;
+	std::atomic<size_t> next_chunk(0);
+	auto run_chunks = [&]
+	{
+		for (;;)
+		{
+			const size_t chunk = next_chunk++;
+			if (chunk >= chunks)
+			{
+				return;
+			}
+			const size_t begin = chunk * grain;
+			body(begin, std::min(begin + grain, count));
+		}
+	};
+
+	// The helpers share the chunks with the calling thread, the ones
+	// started after all chunks are taken return at once. They reference
+	// this frame, so they are waited for even when the body throws here.
+	counter done;
+	const size_t helpers = std::min(workers.size(), chunks - 1);
+	for (size_t i = 0; i < helpers; ++i)
+	{
+		run(name, run_chunks, &done);
+	}
+
+	std::exception_ptr error;
+	try
+	{
+		run_chunks();
+	}
+	catch (...)
+	{
+		error = std::current_exception();
+		next_chunk = chunks;
+	}
+	try
+	{
+		wait(done);
+	}
+	catch (...)
+	{
+		if (!error)
+		{
+			error = std::current_exception();
+		}
+	}
+
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+}
+
+size_t Z_JobSystem::current_worker() const
+{
+	return this == tls_system ? tls_worker_index : workers.size();
+}
+
+Z_JobSystem::statistics Z_JobSystem::get_Statistics() const
+{
+	statistics stats = { jobs_run.load(), jobs_stolen.load() };
+	return stats;
+}
+
+void Z_JobSystem::push(job&& queued)
+{
+	// Counted first, so a worker finding the job never sees the count
+	// drop below zero.
+	++queued_jobs;
+	job_queue& queue = *queues[current_worker()];
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.jobs.push_back(std::move(queued));
+	}
+
+	// A worker raises sleeping_workers before it checks queued_jobs, so
+	// either it sees the job or the job sees it.
+	if (sleeping_workers.load())
+	{
+		{
+			std::lock_guard<std::mutex> lock(sleep_mutex);
+		}
+		sleep_cv.notify_one();
+	}
+}
+
+bool Z_JobSystem::find_Job(size_t thread, job& found)
+{
+	{
+		job_queue& own = *queues[thread];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		if (!own.jobs.empty())
+		{
+			found = std::move(own.jobs.back());
+			own.jobs.pop_back();
+			--queued_jobs;
+			return true;
+		}
+	}
+
+	for (size_t i = 1; i < queues.size(); ++i)
+	{
+		job_queue& victim = *queues[(thread + i) % queues.size()];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if (!victim.jobs.empty())
+		{
+			found = std::move(victim.jobs.front());
+			victim.jobs.pop_front();
+			--queued_jobs;
+			++jobs_stolen;
+			return true;
+		}
+	}
+	return false;
+}
+
+void Z_JobSystem::execute(job& current, size_t thread)
+{
+	const clock::time_point start = timing ? clock::now() : clock::time_point();
+	std::exception_ptr error;
+	if (current.done)
+	{
+		try
+		{
+			current.work();
+		}
+		catch (...)
+		{
+			error = std::current_exception();
+		}
+	}
+	else
+	{
+		current.work();
+	}
+
+	if (timing)
+	{
+		job_timing measured = { current.name, thread, start, clock::now() };
+		timing(measured);
+	}
+	++jobs_run;
+	finish(current.done, error);
+}
+
+void Z_JobSystem::finish(counter* done, std::exception_ptr error)
+{
+	if (!done)
+	{
+		return;
+	}
+
+	// The counter may be gone once its lock is released, a waiter can
+	// see it done right then.
+	std::vector<job> released;
+	{
+		std::lock_guard<std::mutex> lock(done->mutex);
+		if (error && !done->error)
+		{
+			done->error = error;
+		}
+		if (0 == --done->unfinished)
+		{
+			released.swap(done->continuations);
+		}
+	}
+	for (auto& continuation : released)
+	{
+		push(std::move(continuation));
+	}
+}
+
+void Z_JobSystem::worker_loop(size_t index)
+{
+	tls_system = this;
+	tls_worker_index = index;
+
+	for (;;)
+	{
+		job found;
+		if (find_Job(index, found))
+		{
+			execute(found, index);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(sleep_mutex);
+		++sleeping_workers;
+		sleep_cv.wait(lock, [this] { return stopping || queued_jobs.load() > 0; });
+		--sleeping_workers;
+		if (stopping && !queued_jobs.load())
+		{
+			return;
+		}
+	}
+}
+
+void Z_JobSystem::benchmark(std::ostream& out, size_t jobs_qty)
+{
+	Z_JobSystem jobs;
+	Z_ThreadPool pool(jobs.size());
+
+	const auto flags = out.flags();
+	const auto precision = out.precision();
+	out << "Job system of " << jobs.size() << " workers and Z_ThreadPool of " << pool.size() << ":\n";
+	out << std::fixed << std::setprecision(2);
+	auto print = [&](const char* label, double jobs_value, double pool_value, const char* unit)
+	{
+		out << "    " << std::left << std::setw(24) << label << std::right << std::setw(10) << jobs_value << unit;
+		if (pool_value >= 0.0)
+		{
+			out << ", thread pool " << std::setw(10) << pool_value << unit;
+		}
+		out << "\n";
+	};
+	auto nanoseconds_per = [](clock::time_point start, size_t qty) { return std::chrono::duration<double, std::nano>(clock::now() - start).count() / qty; };
+
+	// Independent empty jobs under one counter, the pool has no way to
+	// wait for tasks but a loop.
+	counter done;
+	auto start = clock::now();
+	for (size_t i = 0; i < jobs_qty; ++i)
+	{
+		jobs.run("empty", [] {}, &done);
+	}
+	jobs.wait(done);
+	print("empty jobs:", nanoseconds_per(start, jobs_qty), -1.0, " ns per job");
+
+	std::atomic<size_t> items(0);
+	auto count_items = [&](size_t begin, size_t end) { items += end - begin; };
+	start = clock::now();
+	jobs.parallel_for(jobs_qty, 1, count_items);
+	const double jobs_loop_ns = nanoseconds_per(start, jobs_qty);
+	start = clock::now();
+	pool.parallel_for(jobs_qty, 1, count_items);
+	print("loop of grain 1:", jobs_loop_ns, nanoseconds_per(start, jobs_qty), " ns per item");
+
+	// Loops started from loops, as the culling of several views would.
+	const size_t outer_qty = 64;
+	const size_t inner_qty = std::max<size_t>(jobs_qty / outer_qty, 1);
+	std::vector<float> sums(outer_qty);
+	auto inner_body = [&](size_t outer, size_t begin, size_t end)
+	{
+		float sum = 0.0f;
+		for (size_t i = begin; i < end; ++i)
+		{
+			sum += std::sqrt(static_cast<float>(i));
+		}
+		sums[outer] += sum;
+	};
+	start = clock::now();
+	jobs.parallel_for(outer_qty, 1, [&](size_t begin, size_t end)
+	{
+		for (size_t outer = begin; outer < end; ++outer)
+		{
+			jobs.parallel_for(inner_qty, 256, [&](size_t b, size_t e) { inner_body(outer, b, e); });
+		}
+	});
+	const double jobs_nested_ns = nanoseconds_per(start, outer_qty * inner_qty);
+	start = clock::now();
+	pool.parallel_for(outer_qty, 1, [&](size_t begin, size_t end)
+	{
+		for (size_t outer = begin; outer < end; ++outer)
+		{
+			pool.parallel_for(inner_qty, 256, [&](size_t b, size_t e) { inner_body(outer, b, e); });
+		}
+	});
+	print("nested loops:", jobs_nested_ns, nanoseconds_per(start, outer_qty * inner_qty), " ns per item");
+
+	// A chain of jobs each waiting for the previous one.
+	const size_t chain_qty = std::min<size_t>(jobs_qty, 10000);
+	std::vector<counter> chain(chain_qty);
+	start = clock::now();
+	jobs.run("chain", [] {}, &chain[0]);
+	for (size_t i = 1; i < chain_qty; ++i)
+	{
+		jobs.run_After(chain[i - 1], "chain", [] {}, &chain[i]);
+	}
+	jobs.wait(chain[chain_qty - 1]);
+	print("dependent jobs:", nanoseconds_per(start, chain_qty), -1.0, " ns per job");
+
+	const statistics stats = jobs.get_Statistics();
+	out << "    " << stats.jobs << " jobs run, " << stats.steals << " stolen.\n";
+
+	out.flags(flags);
+	out.precision(precision);
+}
@@ -0,0 +1,165 @@
+/* Z_JobSystem.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_JobSystem_h
+#define Z_JobSystem_h
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <chrono>
+#include <exception>
+#include <ostream>
+#include <cstdint>
+
+/* Work-stealing scheduler of short jobs. Every worker has a deque: jobs */
+/* started on a worker go to the back of its own, the worker takes from  */
+/* its back and idle workers steal from the front of the others. Threads */
+/* outside the system share one more deque. A thread waiting for jobs    */
+/* runs queued ones meanwhile, so jobs may start and wait for jobs.      */
+class Z_JobSystem
+{
+public:
+	class counter;
+	typedef std::chrono::steady_clock clock;
+private:
+	struct job
+	{
+		std::function<void()> work;
+		const char* name;
+		counter* done;
+	};
+public:
+	/* Counts the unfinished jobs started with it and keeps the first   */
+	/* exception they threw. It must outlive them, so wait for it first. */
+	class counter
+	{
+	public:
+		counter() {}
+		counter(const counter&) = delete;
+		counter& operator=(const counter&) = delete;
+
+		bool is_Done() const;
+	private:
+		friend class Z_JobSystem;
+
+		mutable std::mutex mutex;
+		size_t unfinished{};
+		/* Jobs started with run_After this counter. */
+		std::vector<job> continuations;
+		std::exception_ptr error;
+	};
+
+	/* Passed to the timing hook on the thread which ran the job. */
+	struct job_timing
+	{
+		const char* name;
+		size_t worker;
+		clock::time_point start;
+		clock::time_point finish;
+	};
+	typedef std::function<void(const job_timing&)> timing_hook;
+
+	struct statistics
+	{
+		uint64_t jobs;
+		uint64_t steals;
+	};
+
+	/* workers_qty == 0 means one worker per hardware thread but the one */
+	/* of the calling thread, which runs jobs while it waits; at least 1. */
+	explicit Z_JobSystem(size_t workers_qty = 0);
+	/* Runs the jobs still queued before it stops the workers. */
+	~Z_JobSystem();
+
+	Z_JobSystem(const Z_JobSystem&) = delete;
+	Z_JobSystem& operator=(const Z_JobSystem&) = delete;
+
+	/* Jobs without a counter must not throw. name is kept as a pointer. */
+	void run(const char* name, std::function<void()> work, counter* done = nullptr);
+	/* Queues the job once dependency is done, whether its jobs threw or */
+	/* not. done counts the job from now on.                             */
+	void run_After(counter& dependency, const char* name, std::function<void()> work, counter* done = nullptr);
+	/* Runs jobs on the calling thread until done is done, then rethrows */
+	/* the first exception of its jobs.                                  */
+	void wait(counter& done);
+
+	/* Calls body(begin, end) for chunks of at most grain items of [0, count) */
+	/* on the workers and the calling thread, and returns when all chunks    */
+	/* are done. The first exception thrown by body is rethrown here.        */
+	void parallel_for(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body, const char* name = "parallel_for");
+
+	size_t size() const { return workers.size(); }
+	/* Index of the calling worker, or size() for other threads. */
+	size_t current_worker() const;
+
+	/* Called after every job, on the thread which ran it, so it must be */
+	/* thread safe. Set it while no jobs run.                            */
+	void set_TimingHook(timing_hook hook) { timing = hook; }
+
+	statistics get_Statistics() const;
+
+	/* Runs jobs_qty empty jobs, fine grained loops and nested loops, */
+	/* against Z_ThreadPool where it can do the same.                 */
+	static void benchmark(std::ostream& out, size_t jobs_qty);
+private:
+	struct job_queue
+	{
+		std::mutex mutex;
+		std::deque<job> jobs;
+	};
+
+	void push(job&& queued);
+	/* The back of the queue of thread, or the front of another one. */
+	bool find_Job(size_t thread, job& found);
+	void execute(job& current, size_t thread);
+	void finish(counter* done, std::exception_ptr error);
+	void worker_loop(size_t index);
+
+	/* One per worker, the last one for the other threads. */
+	std::vector<std::unique_ptr<job_queue>> queues;
+	std::vector<std::thread> workers;
+	/* Jobs pushed and not taken yet, raised before the push. */
+	std::atomic<size_t> queued_jobs;
+	std::atomic<size_t> sleeping_workers;
+	std::mutex sleep_mutex;
+	std::condition_variable sleep_cv;
+	bool stopping{ false };
+
+	timing_hook timing;
+	std::atomic<uint64_t> jobs_run;
+	std::atomic<uint64_t> jobs_stolen;
+};
+
+#endif // !Z_JobSystem_h
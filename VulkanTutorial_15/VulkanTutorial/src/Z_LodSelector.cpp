@@ -0,0 +1,258 @@
+/* Z_LodSelector.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_LodSelector.h"
+#include "Z_FrustumCuller.h"
+#include "Z_BenchmarkScene.h"
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <cmath>
+
+namespace
+{
+	typedef std::chrono::high_resolution_clock clock;
+
+	/* Objects of a range selected by one task. */
+	const size_t range_size = 16384;
+
+	/* Levels are kept in bytes. */
+	const size_t max_levels = 256;
+}
+
+Z_LodSelector::Z_LodSelector()
+	: errors(1, 0.0f), level_first(2, 0)
+{
+	set_Threshold(1.0f);
+	const float w[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+	std::copy(w, w + 4, w_row);
+}
+
+void Z_LodSelector::set_Levels(const std::vector<float>& level_errors)
+{
+	if (level_errors.empty() || level_errors.size() > max_levels)
+	{
+		throw std::domain_error{ "Levels of detail are 1 to " + std::to_string(max_levels) };
+	}
+	errors = level_errors;
+	// A coarser level never shows less error, whatever the simplifier measured.
+	for (size_t l = 1; l < errors.size(); ++l)
+	{
+		errors[l] = std::max(errors[l], errors[l - 1]);
+	}
+	const uint8_t last = static_cast<uint8_t>(errors.size() - 1);
+	for (auto& l : levels)
+	{
+		l = std::min(l, last);
+	}
+}
+
+void Z_LodSelector::set_Threshold(float max_pixels, float hysteresis)
+{
+	if (max_pixels <= 0.0f || hysteresis < 0.0f || hysteresis >= 1.0f)
+	{
+		throw std::domain_error{ "Level of detail threshold out of range" };
+	}
+	finer_limit = max_pixels * (1.0f + hysteresis);
+	coarser_limit = max_pixels * (1.0f - hysteresis);
+}
+
+void Z_LodSelector::resize(size_t qty)
+{
+	for (auto* a : { &center_x, &center_y, &center_z, &radius, &scale })
+	{
+		a->resize(qty, 0.0f);
+	}
+	levels.resize(qty, 0);
+}
+
+void Z_LodSelector::set_Object(size_t index, const float* center, float r, float s)
+{
+	center_x[index] = center[0];
+	center_y[index] = center[1];
+	center_z[index] = center[2];
+	radius[index] = r;
+	scale[index] = s;
+}
+
+void Z_LodSelector::set_View(const float* m, float ppu)
+{
+	for (size_t k = 0; k < 4; ++k)
+	{
+		w_row[k] = m[4 * k + 3];
+	}
+	pixels_per_unit = ppu;
+}
+
+void Z_LodSelector::select(const uint32_t* objects, size_t objects_qty, Z_JobSystem* jobs)
+{
+	const size_t levels_qty = errors.size();
+	const size_t ranges_qty = std::max<size_t>((objects_qty + range_size - 1) / range_size, 1);
+	range_counts.assign(ranges_qty * levels_qty, 0);
+	auto select_ranges = [&](size_t begin, size_t end)
+	{
+		for (size_t r = begin; r < end; ++r)
+		{
+			const size_t first = r * range_size;
+			select_Range(objects + first, std::min(first + range_size, objects_qty) - first, range_counts.data() + r * levels_qty);
+		}
+	};
+	if (jobs && ranges_qty > 1)
+	{
+		jobs->parallel_for(ranges_qty, 1, select_ranges, "lod select");
+	}
+	else
+	{
+		select_ranges(0, ranges_qty);
+	}
+
+	// Every range scatters its objects after those of the earlier ranges
+	// of the same level.
+	std::vector<size_t> offsets(ranges_qty * levels_qty);
+	level_first.assign(levels_qty + 1, 0);
+	size_t offset = 0;
+	for (size_t l = 0; l < levels_qty; ++l)
+	{
+		level_first[l] = offset;
+		for (size_t r = 0; r < ranges_qty; ++r)
+		{
+			offsets[r * levels_qty + l] = offset;
+			offset += range_counts[r * levels_qty + l];
+		}
+	}
+	level_first[levels_qty] = offset;
+
+	ordered.resize(objects_qty);
+	auto scatter_ranges = [&](size_t begin, size_t end)
+	{
+		for (size_t r = begin; r < end; ++r)
+		{
+			size_t* next = offsets.data() + r * levels_qty;
+			const size_t last = std::min((r + 1) * range_size, objects_qty);
+			for (size_t i = r * range_size; i < last; ++i)
+			{
+				ordered[next[levels[objects[i]]]++] = objects[i];
+			}
+		}
+	};
+	if (jobs && ranges_qty > 1)
+	{
+		jobs->parallel_for(ranges_qty, 1, scatter_ranges, "lod select");
+	}
+	else
+	{
+		scatter_ranges(0, ranges_qty);
+	}
+}
+
+void Z_LodSelector::select_Range(const uint32_t* objects, size_t qty, size_t* counts)
+{
+	const uint32_t last = static_cast<uint32_t>(errors.size() - 1);
+	for (size_t i = 0; i < qty; ++i)
+	{
+		const uint32_t o = objects[i];
+		uint32_t level = levels[o];
+
+		// Distance to the nearest point of the sphere along the view axis.
+		const float distance = w_row[0] * center_x[o] + w_row[1] * center_y[o] + w_row[2] * center_z[o] + w_row[3] - radius[o];
+		if (distance <= 1e-4f)
+		{
+			level = 0;
+		}
+		else
+		{
+			const float pixels = scale[o] * pixels_per_unit / distance;
+			while (level > 0 && errors[level] * pixels > finer_limit)
+			{
+				--level;
+			}
+			while (level < last && errors[level + 1] * pixels <= coarser_limit)
+			{
+				++level;
+			}
+		}
+
+		levels[o] = static_cast<uint8_t>(level);
+		++counts[level];
+	}
+}
+
+void Z_LodSelector::benchmark(std::ostream& out, Z_JobSystem& jobs, size_t objects_qty)
+{
+	// The objects the frustum culling benchmark keeps, as the frames select
+	// them, with the errors of a mesh halved at every level. The viewport
+	// is 1080 pixels high.
+	const Z_BenchmarkScene scene(objects_qty);
+	Z_FrustumCuller culler;
+	culler.resize(objects_qty);
+	Z_LodSelector selector;
+	selector.set_Levels({ 0.0f, 0.0005f, 0.001f, 0.002f, 0.004f, 0.008f, 0.016f, 0.032f });
+	selector.resize(objects_qty);
+	for (size_t i = 0; i < objects_qty; ++i)
+	{
+		const float* e = &scene.half_extents[3 * i];
+		const float radius = std::sqrt(e[0] * e[0] + e[1] * e[1] + e[2] * e[2]);
+		culler.set_Bounds(i, &scene.centers[3 * i], e);
+		selector.set_Object(i, &scene.centers[3 * i], radius, radius);
+	}
+	culler.set_Frustum(scene.projection);
+	selector.set_View(scene.projection, 540.0f * scene.focal_length);
+	std::vector<uint32_t> objects;
+	culler.cull(objects);
+
+	const auto flags = out.flags();
+	const auto precision = out.precision();
+	out << "Level of detail selection of " << objects.size() << " visible of " << objects_qty << " objects:\n";
+	out << std::fixed << std::setprecision(2);
+
+	const size_t frames_qty = 10;
+	for (int threaded = 0; threaded < 2; ++threaded)
+	{
+		Z_JobSystem* p = threaded ? &jobs : nullptr;
+		auto start = clock::now();
+		for (size_t frame = 0; frame < frames_qty; ++frame)
+		{
+			selector.select(objects.data(), objects.size(), p);
+		}
+		const double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count() / frames_qty;
+		out << "    " << (threaded ? std::to_string(jobs.size() + 1) + " threads: " : "1 thread:  ")
+			<< std::setw(8) << ms << " ms per frame, " << std::setw(8) << objects.size() / ms / 1000.0 << " M objects/s\n";
+	}
+
+	out << "    objects per level:";
+	for (size_t l = 0; l < selector.get_LevelsQty(); ++l)
+	{
+		out << " " << selector.get_LevelQty(l);
+	}
+	out << "\n";
+
+	out.flags(flags);
+	out.precision(precision);
+}
@@ -0,0 +1,101 @@
+/* Z_LodSelector.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_LodSelector_h
+#define Z_LodSelector_h
+
+#include <vector>
+#include <cstdint>
+#include <ostream>
+
+#include "Z_JobSystem.h"
+
+/* Picks a level of detail per object from the screen space size of the  */
+/* level errors: the coarsest level whose error projects to at most the  */
+/* threshold in pixels at the nearest point of the bounding sphere.      */
+/* Objects remember their level, it changes only when the projected     */
+/* error leaves the threshold by the hysteresis fraction, so objects at  */
+/* the threshold distance do not pop back and forth.                     */
+/* Runs on the visible list the culler produces, in ranges on the job    */
+/* threads, and groups the objects by level for one draw per level.      */
+class Z_LodSelector
+{
+public:
+	Z_LodSelector();
+
+	/* Object space errors of the levels, errors[0] is the full mesh one. */
+	void set_Levels(const std::vector<float>& errors);
+	size_t get_LevelsQty() const { return errors.size(); }
+	void set_Threshold(float max_pixels, float hysteresis = 0.2f);
+
+	/* New objects are points at the origin, at level 0. */
+	void resize(size_t objects_qty);
+	size_t size() const { return levels.size(); }
+	/* scale takes the object space errors to world space. */
+	void set_Object(size_t index, const float* center, float radius, float scale);
+
+	/* Column-major clip * projection * view as set_view builds it, and */
+	/* the pixels a world unit covers at distance 1.                    */
+	void set_View(const float* view_projection, float pixels_per_unit);
+
+	/* Selects the levels of the objects listed and groups them by level, */
+	/* in their listed order within a level. Null jobs select on the     */
+	/* calling thread.                                                   */
+	void select(const uint32_t* objects, size_t objects_qty, Z_JobSystem* jobs = nullptr);
+	const std::vector<uint32_t>& get_Ordered() const { return ordered; }
+	size_t get_LevelFirst(size_t level) const { return level_first[level]; }
+	size_t get_LevelQty(size_t level) const { return level_first[level + 1] - level_first[level]; }
+	uint32_t get_Level(size_t index) const { return levels[index]; }
+
+	static void benchmark(std::ostream& out, Z_JobSystem& jobs, size_t objects_qty);
+private:
+	void select_Range(const uint32_t* objects, size_t qty, size_t* counts);
+
+	std::vector<float> errors;
+	float coarser_limit{};
+	float finer_limit{};
+
+	std::vector<float> center_x;
+	std::vector<float> center_y;
+	std::vector<float> center_z;
+	std::vector<float> radius;
+	std::vector<float> scale;
+	std::vector<uint8_t> levels;
+
+	/* Row of the matrix giving clip w, the distance along the view axis. */
+	float w_row[4];
+	float pixels_per_unit{ 1.0f };
+
+	std::vector<uint32_t> ordered;
+	std::vector<size_t> level_first;
+	/* Objects of every level in every range, before they are grouped. */
+	std::vector<size_t> range_counts;
+};
+
+#endif // !Z_LodSelector_h
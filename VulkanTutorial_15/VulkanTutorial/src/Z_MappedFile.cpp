@@ -0,0 +1,149 @@
+/* Z_MappedFile.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_MappedFile.h"
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+Z_MappedFile::Z_MappedFile(const std::string& path)
+{
+#ifdef _WIN32
+	HANDLE f = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (INVALID_HANDLE_VALUE == f)
+	{
+		throw std::domain_error{ "File " + path + " cannot be opened" };
+	}
+	file = f;
+
+	LARGE_INTEGER file_size{};
+	if (!GetFileSizeEx(f, &file_size) || !file_size.QuadPart)
+	{
+		close();
+		throw std::domain_error{ "File " + path + " is empty" };
+	}
+
+	mapping = CreateFileMappingA(f, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping)
+	{
+		close();
+		throw std::domain_error{ "File " + path + " cannot be mapped" };
+	}
+	view = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+	view_size = static_cast<size_t>(file_size.QuadPart);
+#else
+	file = ::open(path.c_str(), O_RDONLY);
+	if (file < 0)
+	{
+		throw std::domain_error{ "File " + path + " cannot be opened" };
+	}
+
+	struct stat file_stat{};
+	if (fstat(file, &file_stat) || !file_stat.st_size)
+	{
+		close();
+		throw std::domain_error{ "File " + path + " is empty" };
+	}
+
+	void* v = mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	view = MAP_FAILED == v ? nullptr : static_cast<const uint8_t*>(v);
+	view_size = static_cast<size_t>(file_stat.st_size);
+#endif
+	if (!view)
+	{
+		close();
+		throw std::domain_error{ "File " + path + " cannot be mapped" };
+	}
+}
+
+Z_MappedFile::~Z_MappedFile()
+{
+	close();
+}
+
+Z_MappedFile::Z_MappedFile(Z_MappedFile&& other)
+{
+	*this = std::move(other);
+}
+
+Z_MappedFile& Z_MappedFile::operator=(Z_MappedFile&& other)
+{
+	if (this != &other)
+	{
+		close();
+		std::swap(view, other.view);
+		std::swap(view_size, other.view_size);
+		std::swap(file, other.file);
+#ifdef _WIN32
+		std::swap(mapping, other.mapping);
+#endif
+	}
+	return *this;
+}
+
+void Z_MappedFile::close()
+{
+#ifdef _WIN32
+	if (view)
+	{
+		UnmapViewOfFile(view);
+	}
+	if (mapping)
+	{
+		CloseHandle(mapping);
+	}
+	if (file)
+	{
+		CloseHandle(file);
+	}
+	mapping = nullptr;
+	file = nullptr;
+#else
+	if (view)
+	{
+		munmap(const_cast<uint8_t*>(view), view_size);
+	}
+	if (file >= 0)
+	{
+		::close(file);
+	}
+	file = -1;
+#endif
+	view = nullptr;
+	view_size = 0;
+}
@@ -0,0 +1,68 @@
+/* Z_MappedFile.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_MappedFile_h
+#define Z_MappedFile_h
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+/* Read-only view of a whole file mapped into memory. Pages are read by */
+/* the OS on first access, so untouched parts of a file cost nothing.   */
+class Z_MappedFile
+{
+public:
+	Z_MappedFile() {}
+	/* Throws std::domain_error when the file cannot be mapped. */
+	explicit Z_MappedFile(const std::string& path);
+	~Z_MappedFile();
+
+	Z_MappedFile(Z_MappedFile&& other);
+	Z_MappedFile& operator=(Z_MappedFile&& other);
+	Z_MappedFile(const Z_MappedFile&) = delete;
+	Z_MappedFile& operator=(const Z_MappedFile&) = delete;
+
+	const uint8_t* data() const { return view; }
+	size_t size() const { return view_size; }
+	bool is_open() const { return nullptr != view; }
+
+	void close();
+private:
+	const uint8_t* view{};
+	size_t view_size{};
+#ifdef _WIN32
+	void* file{};
+	void* mapping{};
+#else
+	int file{ -1 };
+#endif
+};
+
+#endif // !Z_MappedFile_h
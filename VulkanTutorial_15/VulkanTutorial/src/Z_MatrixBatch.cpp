@@ -0,0 +1,247 @@
+/* Z_MatrixBatch.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_MatrixBatch.h"
+#include <algorithm>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <cmath>
+#include <cstring>
+
+#define GLM_FORCE_RADIANS
+#include <glm/glm.hpp>
+
+namespace
+{
+	typedef std::chrono::high_resolution_clock clock;
+}
+
+void Z_MatrixBatch::multiply(const float* left, const float* models, const uint32_t* list,
+	size_t begin, size_t end, void* out, size_t out_stride)
+{
+	static const Z_Simd::level best = Z_Simd::get_Best();
+	multiply(left, models, list, begin, end, out, out_stride, best);
+}
+
+void Z_MatrixBatch::multiply(const float* left, const float* models, const uint32_t* list,
+	size_t begin, size_t end, void* out, size_t out_stride, Z_Simd::level level)
+{
+	uint8_t* bytes = static_cast<uint8_t*>(out);
+	switch (level)
+	{
+#ifdef Z_SIMD_AVX
+	case Z_Simd::avx: multiply_Avx(left, models, list, begin, end, bytes, out_stride); return;
+#endif
+#ifdef Z_SIMD_SSE
+	case Z_Simd::sse: multiply_Sse(left, models, list, begin, end, bytes, out_stride); return;
+#endif
+	default: multiply_Scalar(left, models, list, begin, end, bytes, out_stride); return;
+	}
+}
+
+void Z_MatrixBatch::multiply_Scalar(const float* left, const float* models, const uint32_t* list,
+	size_t begin, size_t end, uint8_t* out, size_t out_stride)
+{
+	for (size_t i = begin; i < end; ++i)
+	{
+		const float* m = models + 16 * static_cast<size_t>(list ? list[i] : i);
+		float product[16];
+		for (size_t column = 0; column < 4; ++column)
+		{
+			for (size_t row = 0; row < 4; ++row)
+			{
+				product[4 * column + row] = left[row] * m[4 * column] + left[4 + row] * m[4 * column + 1]
+					+ left[8 + row] * m[4 * column + 2] + left[12 + row] * m[4 * column + 3];
+			}
+		}
+		std::memcpy(out + i * out_stride, product, sizeof(product));
+	}
+}
+
+void Z_MatrixBatch::multiply_Sse(const float* left, const float* models, const uint32_t* list,
+	size_t begin, size_t end, uint8_t* out, size_t out_stride)
+{
+#ifdef Z_SIMD_SSE
+	const __m128 l0 = _mm_loadu_ps(left);
+	const __m128 l1 = _mm_loadu_ps(left + 4);
+	const __m128 l2 = _mm_loadu_ps(left + 8);
+	const __m128 l3 = _mm_loadu_ps(left + 12);
+	for (size_t i = begin; i < end; ++i)
+	{
+		const float* m = models + 16 * static_cast<size_t>(list ? list[i] : i);
+		float* product = reinterpret_cast<float*>(out + i * out_stride);
+		for (size_t column = 0; column < 16; column += 4)
+		{
+			const __m128 c = _mm_loadu_ps(m + column);
+			__m128 p = _mm_mul_ps(l0, _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 0, 0, 0)));
+			p = _mm_add_ps(p, _mm_mul_ps(l1, _mm_shuffle_ps(c, c, _MM_SHUFFLE(1, 1, 1, 1))));
+			p = _mm_add_ps(p, _mm_mul_ps(l2, _mm_shuffle_ps(c, c, _MM_SHUFFLE(2, 2, 2, 2))));
+			p = _mm_add_ps(p, _mm_mul_ps(l3, _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3))));
+			_mm_storeu_ps(product + column, p);
+		}
+	}
+#else
+	multiply_Scalar(left, models, list, begin, end, out, out_stride);
+#endif
+}
+
+#ifdef Z_SIMD_AVX
+Z_AVX_FUNCTION void Z_MatrixBatch::multiply_Avx(const float* left, const float* models, const uint32_t* list,
+	size_t begin, size_t end, uint8_t* out, size_t out_stride)
+{
+	// The shared columns in both halves, each half weighs them by its own
+	// model column.
+	__m256 l[4];
+	for (size_t k = 0; k < 4; ++k)
+	{
+		const __m128 column = _mm_loadu_ps(left + 4 * k);
+		l[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(column), column, 1);
+	}
+	for (size_t i = begin; i < end; ++i)
+	{
+		const float* m = models + 16 * static_cast<size_t>(list ? list[i] : i);
+		float* product = reinterpret_cast<float*>(out + i * out_stride);
+		for (size_t columns = 0; columns < 16; columns += 8)
+		{
+			const __m256 c = _mm256_loadu_ps(m + columns);
+			__m256 p = _mm256_mul_ps(l[0], _mm256_permute_ps(c, 0x00));
+			p = _mm256_add_ps(p, _mm256_mul_ps(l[1], _mm256_permute_ps(c, 0x55)));
+			p = _mm256_add_ps(p, _mm256_mul_ps(l[2], _mm256_permute_ps(c, 0xAA)));
+			p = _mm256_add_ps(p, _mm256_mul_ps(l[3], _mm256_permute_ps(c, 0xFF)));
+			_mm256_storeu_ps(product + columns, p);
+		}
+	}
+	_mm256_zeroupper();
+}
+#else
+void Z_MatrixBatch::multiply_Avx(const float* left, const float* models, const uint32_t* list,
+	size_t begin, size_t end, uint8_t* out, size_t out_stride)
+{
+	multiply_Sse(left, models, list, begin, end, out, out_stride);
+}
+#endif
+
+void Z_MatrixBatch::benchmark(std::ostream& out, Z_JobSystem& jobs, size_t matrices_qty)
+{
+	// Models in random order through an index list, into records of the
+	// instance size as the renderer streams them.
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> value(-2.0f, 2.0f);
+	std::vector<glm::mat4> models(matrices_qty);
+	for (auto& m : models)
+	{
+		for (size_t k = 0; k < 16; ++k)
+		{
+			(&m[0][0])[k] = value(random);
+		}
+	}
+	std::vector<uint32_t> list(matrices_qty);
+	for (size_t i = 0; i < matrices_qty; ++i)
+	{
+		list[i] = static_cast<uint32_t>(i);
+	}
+	std::shuffle(list.begin(), list.end(), random);
+	glm::mat4 view_projection;
+	for (size_t k = 0; k < 16; ++k)
+	{
+		(&view_projection[0][0])[k] = value(random);
+	}
+
+	const size_t stride = 17 * sizeof(float);
+	std::vector<uint8_t> reference(matrices_qty * stride);
+	std::vector<uint8_t> products(matrices_qty * stride);
+	const size_t frames_qty = 10;
+	const size_t range = 4096;
+
+	const auto flags = out.flags();
+	const auto precision = out.precision();
+	out << "View projection times " << matrices_qty << " model matrices:\n";
+	out << std::fixed << std::setprecision(2);
+
+	auto start = clock::now();
+	for (size_t frame = 0; frame < frames_qty; ++frame)
+	{
+		for (size_t i = 0; i < matrices_qty; ++i)
+		{
+			const glm::mat4 mvp = view_projection * models[list[i]];
+			std::memcpy(&reference[i * stride], &mvp[0][0], sizeof(mvp));
+		}
+	}
+	double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count() / frames_qty;
+	out << "    glm     1 thread:  " << std::setw(8) << ms << " ms per frame, " << std::setw(8) << matrices_qty / ms / 1000.0 << " M matrices/s\n";
+
+	const char* names[] = { "scalar", "SSE", "AVX" };
+	for (int level = Z_Simd::none; level <= Z_Simd::get_Best(); ++level)
+	{
+		for (int threaded = 0; threaded < 2; ++threaded)
+		{
+			start = clock::now();
+			for (size_t frame = 0; frame < frames_qty; ++frame)
+			{
+				if (threaded)
+				{
+					jobs.parallel_for(matrices_qty, range, [&](size_t begin, size_t end)
+					{
+						multiply(&view_projection[0][0], &models[0][0][0], list.data(), begin, end, products.data(), stride,
+							static_cast<Z_Simd::level>(level));
+					});
+				}
+				else
+				{
+					multiply(&view_projection[0][0], &models[0][0][0], list.data(), 0, matrices_qty, products.data(), stride,
+						static_cast<Z_Simd::level>(level));
+				}
+			}
+			ms = std::chrono::duration<double, std::milli>(clock::now() - start).count() / frames_qty;
+
+			float deviation = 0.0f;
+			for (size_t i = 0; i < matrices_qty; ++i)
+			{
+				for (size_t k = 0; k < 16; ++k)
+				{
+					float a, b;
+					std::memcpy(&a, &reference[i * stride + k * sizeof(float)], sizeof(a));
+					std::memcpy(&b, &products[i * stride + k * sizeof(float)], sizeof(b));
+					deviation = std::max(deviation, std::fabs(a - b));
+				}
+			}
+
+			out << "    " << std::left << std::setw(7) << names[level] << std::right
+				<< (threaded ? std::to_string(jobs.size() + 1) + " threads: " : "1 thread:  ")
+				<< std::setw(8) << ms << " ms per frame, " << std::setw(8) << matrices_qty / ms / 1000.0 << " M matrices/s, "
+				<< "largest difference from glm " << std::scientific << std::setprecision(1) << deviation
+				<< std::fixed << std::setprecision(2) << "\n";
+		}
+	}
+
+	out.flags(flags);
+	out.precision(precision);
+}
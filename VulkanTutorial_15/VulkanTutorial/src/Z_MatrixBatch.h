@@ -0,0 +1,66 @@
+/* Z_MatrixBatch.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_MatrixBatch_h
+#define Z_MatrixBatch_h
+
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+
+#include "Z_Simd.h"
+#include "Z_JobSystem.h"
+
+/* Products of one shared matrix with arrays of matrices, column-major    */
+/* as glm stores them, e.g. view_projection * model for every instance.   */
+/* Each product column is the shared columns weighted by one model column */
+/* as glm's sse_mul_ps does it; AVX computes two columns at once. Results */
+/* are stored unaligned at any stride, straight into mapped memory.       */
+class Z_MatrixBatch
+{
+public:
+	/* For begin <= i < end, the 16 floats at out + i * out_stride become */
+	/* left * models[list ? list[i] : i]. Ranges of one batch may run on  */
+	/* different threads.                                                 */
+	static void multiply(const float* left, const float* models, const uint32_t* list,
+		size_t begin, size_t end, void* out, size_t out_stride);
+	static void multiply(const float* left, const float* models, const uint32_t* list,
+		size_t begin, size_t end, void* out, size_t out_stride, Z_Simd::level level);
+
+	static void benchmark(std::ostream& out, Z_JobSystem& jobs, size_t matrices_qty);
+private:
+	static void multiply_Scalar(const float* left, const float* models, const uint32_t* list,
+		size_t begin, size_t end, uint8_t* out, size_t out_stride);
+	static void multiply_Sse(const float* left, const float* models, const uint32_t* list,
+		size_t begin, size_t end, uint8_t* out, size_t out_stride);
+	static void multiply_Avx(const float* left, const float* models, const uint32_t* list,
+		size_t begin, size_t end, uint8_t* out, size_t out_stride);
+};
+
+#endif // !Z_MatrixBatch_h
@@ -0,0 +1,314 @@
+/* Z_MeshFile.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_MeshFile.h"
+#include <stdexcept>
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+
+static_assert(sizeof(Z_MeshFile::file_header) == 24, "Z_MeshFile header layout changed");
+static_assert(sizeof(Z_MeshFile::mesh_entry) == 296, "Z_MeshFile entry layout changed");
+
+namespace
+{
+	const char magic[4] = { 'Z', 'M', 'S', 'H' };
+
+	uint64_t align_up(uint64_t offset, uint64_t alignment)
+	{
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	std::vector<uint8_t> pack_indices(const std::vector<uint32_t>& indices, uint32_t index_size)
+	{
+		std::vector<uint8_t> packed(indices.size() * index_size);
+		for (size_t i = 0; i < indices.size(); ++i)
+		{
+			if (2 == index_size)
+			{
+				const uint16_t v = static_cast<uint16_t>(indices[i]);
+				std::memcpy(&packed[2 * i], &v, sizeof(v));
+			}
+			else
+			{
+				std::memcpy(&packed[4 * i], &indices[i], sizeof(indices[i]));
+			}
+		}
+		return packed;
+	}
+
+	std::vector<uint32_t> unpack_indices(const uint8_t* packed, size_t indices_qty, uint32_t index_size)
+	{
+		std::vector<uint32_t> indices(indices_qty);
+		for (size_t i = 0; i < indices.size(); ++i)
+		{
+			if (2 == index_size)
+			{
+				uint16_t v;
+				std::memcpy(&v, packed + 2 * i, sizeof(v));
+				indices[i] = v;
+			}
+			else
+			{
+				std::memcpy(&indices[i], packed + 4 * i, sizeof(indices[i]));
+			}
+		}
+		return indices;
+	}
+
+	Z_MeshFile::vertex_layout empty_layout(uint32_t stride)
+	{
+		Z_MeshFile::vertex_layout layout{};
+		layout.stride = stride;
+		for (size_t k = 0; k < 3; ++k)
+		{
+			layout.extent[k] = 1.0f;
+		}
+		return layout;
+	}
+
+	void set_attribute(Z_MeshFile::vertex_layout& layout, Z_MeshFile::attribute_slot slot,
+		uint32_t offset, Z_MeshFile::attribute_format format)
+	{
+		if (Z_VertexQuantizer::absent != offset)
+		{
+			layout.attributes[slot].format = format;
+			layout.attributes[slot].offset = offset;
+		}
+	}
+}
+
+Z_MeshFile::vertex_layout Z_MeshFile::make_Layout(const Z_VertexQuantizer::source_layout& floats)
+{
+	vertex_layout layout = empty_layout(floats.stride);
+	set_attribute(layout, slot_position, floats.position, format_float32x4);
+	set_attribute(layout, slot_color, floats.color, format_float32x4);
+	set_attribute(layout, slot_uv, floats.uv, format_float32x2);
+	set_attribute(layout, slot_normal, floats.normal, format_float32x3);
+	return layout;
+}
+
+Z_MeshFile::vertex_layout Z_MeshFile::make_Layout(const Z_VertexQuantizer& quantizer)
+{
+	const Z_VertexQuantizer::packed_layout& packed = quantizer.get_Layout();
+	vertex_layout layout = empty_layout(packed.stride);
+	const attribute_format position_formats[] = { format_float32x4, format_half4, format_snorm16x4 };
+	set_attribute(layout, slot_position, packed.position, position_formats[packed.format]);
+	set_attribute(layout, slot_color, packed.color, format_unorm8x4);
+	set_attribute(layout, slot_uv, packed.uv, format_half2);
+	set_attribute(layout, slot_normal, packed.normal, format_octahedral16);
+	for (size_t k = 0; k < 3; ++k)
+	{
+		layout.center[k] = quantizer.get_Center()[k];
+		layout.extent[k] = quantizer.get_Extent()[k];
+	}
+	return layout;
+}
+
+void Z_MeshFile::write(const std::string& path, const std::vector<source>& meshes)
+{
+	file_header header{};
+	std::memcpy(header.magic, magic, sizeof(magic));
+	header.major = version_major;
+	header.minor = version_minor;
+	header.meshes_qty = static_cast<uint32_t>(meshes.size());
+	header.entry_size = sizeof(mesh_entry);
+	header.table_offset = align_up(sizeof(file_header), 8);
+
+	std::vector<mesh_entry> table(meshes.size());
+	std::vector<std::vector<uint8_t>> index_blobs(meshes.size());
+	std::vector<std::vector<uint8_t>> lod_blobs(meshes.size());
+	uint64_t offset = align_up(header.table_offset + table.size() * sizeof(mesh_entry), blob_alignment);
+	for (size_t i = 0; i < meshes.size(); ++i)
+	{
+		const Z_IndexedMesh& mesh = *meshes[i].mesh;
+		if (mesh.get_VertexStride() != meshes[i].layout.stride)
+		{
+			throw std::domain_error{ "Mesh " + meshes[i].name + " does not match its vertex layout" };
+		}
+		if (meshes[i].lods.size() > max_lods)
+		{
+			throw std::domain_error{ "Mesh " + meshes[i].name + " has more than " + std::to_string(max_lods) + " levels of detail" };
+		}
+
+		mesh_entry& e = table[i];
+		std::strncpy(e.name, meshes[i].name.c_str(), sizeof(e.name) - 1);
+		e.layout = meshes[i].layout;
+		e.vertices_qty = static_cast<uint32_t>(mesh.get_VerticesQty());
+		e.indices_qty = static_cast<uint32_t>(mesh.get_IndicesQty());
+		e.index_size = mesh.get_IndexSize();
+		index_blobs[i] = mesh.get_PackedIndices();
+
+		e.vertices_offset = offset;
+		e.vertices_size = mesh.get_Vertices().size();
+		e.indices_offset = align_up(e.vertices_offset + e.vertices_size, blob_alignment);
+		e.indices_size = index_blobs[i].size();
+		offset = align_up(e.indices_offset + e.indices_size, blob_alignment);
+
+		std::vector<uint32_t> lod_indices;
+		e.lods_qty = static_cast<uint32_t>(meshes[i].lods.size());
+		for (size_t l = 0; l < e.lods_qty; ++l)
+		{
+			const lod_source& lod = meshes[i].lods[l];
+			e.lods[l].first_index = static_cast<uint32_t>(lod_indices.size());
+			e.lods[l].indices_qty = static_cast<uint32_t>(lod.indices.size());
+			e.lods[l].error = lod.error;
+			lod_indices.insert(lod_indices.end(), lod.indices.begin(), lod.indices.end());
+		}
+		if (e.lods_qty)
+		{
+			lod_blobs[i] = pack_indices(lod_indices, e.index_size);
+			e.lods_offset = offset;
+			e.lods_size = lod_blobs[i].size();
+			offset = align_up(e.lods_offset + e.lods_size, blob_alignment);
+		}
+	}
+
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	if (!out)
+	{
+		throw std::domain_error{ "File " + path + " cannot be created" };
+	}
+
+	uint64_t written = 0;
+	auto put = [&](uint64_t at, const void* data, uint64_t size)
+	{
+		static const char zeros[blob_alignment] = {};
+		while (written < at)
+		{
+			const uint64_t padding = std::min<uint64_t>(at - written, sizeof(zeros));
+			out.write(zeros, static_cast<std::streamsize>(padding));
+			written += padding;
+		}
+		out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+		written += size;
+	};
+
+	put(0, &header, sizeof(header));
+	put(header.table_offset, table.data(), table.size() * sizeof(mesh_entry));
+	for (size_t i = 0; i < meshes.size(); ++i)
+	{
+		put(table[i].vertices_offset, meshes[i].mesh->get_Vertices().data(), table[i].vertices_size);
+		put(table[i].indices_offset, index_blobs[i].data(), table[i].indices_size);
+		if (table[i].lods_qty)
+		{
+			put(table[i].lods_offset, lod_blobs[i].data(), table[i].lods_size);
+		}
+	}
+	put(offset, nullptr, 0);
+
+	if (!out)
+	{
+		throw std::domain_error{ "File " + path + " cannot be written" };
+	}
+}
+
+Z_MeshFile::Z_MeshFile(const std::string& path)
+	: file(path)
+{
+	file_header header{};
+	if (file.size() < sizeof(header))
+	{
+		throw std::domain_error{ "File " + path + " is not a mesh file" };
+	}
+	std::memcpy(&header, file.data(), sizeof(header));
+	if (std::memcmp(header.magic, magic, sizeof(magic)))
+	{
+		throw std::domain_error{ "File " + path + " is not a mesh file" };
+	}
+	if (version_major != header.major)
+	{
+		throw std::domain_error{ "Mesh file " + path + " has unsupported version " + std::to_string(header.major)
+			+ "." + std::to_string(header.minor) };
+	}
+	if (header.entry_size < entry_size_1_0
+		|| header.table_offset + static_cast<uint64_t>(header.meshes_qty) * header.entry_size > file.size())
+	{
+		throw std::domain_error{ "Mesh file " + path + " has a damaged mesh table" };
+	}
+
+	entries.resize(header.meshes_qty);
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		// Fields of minors newer than the file are left zero.
+		mesh_entry& e = entries[i];
+		e = mesh_entry{};
+		std::memcpy(&e, file.data() + header.table_offset + i * header.entry_size,
+			std::min<size_t>(header.entry_size, sizeof(e)));
+		e.name[sizeof(e.name) - 1] = '\0';
+
+		bool valid = (2 == e.index_size || 4 == e.index_size)
+			&& e.vertices_size == static_cast<uint64_t>(e.vertices_qty) * e.layout.stride
+			&& e.indices_size == static_cast<uint64_t>(e.indices_qty) * e.index_size
+			&& e.vertices_offset + e.vertices_size <= file.size()
+			&& e.indices_offset + e.indices_size <= file.size()
+			&& !(e.vertices_offset % blob_alignment) && !(e.indices_offset % blob_alignment)
+			&& e.lods_qty <= max_lods;
+		if (valid && e.lods_qty)
+		{
+			valid = e.lods_offset + e.lods_size <= file.size() && !(e.lods_offset % blob_alignment);
+			for (size_t l = 0; valid && l < e.lods_qty; ++l)
+			{
+				valid = (static_cast<uint64_t>(e.lods[l].first_index) + e.lods[l].indices_qty) * e.index_size <= e.lods_size;
+			}
+		}
+		if (!valid)
+		{
+			throw std::domain_error{ "Mesh file " + path + " has a damaged mesh " + e.name };
+		}
+	}
+}
+
+size_t Z_MeshFile::find(const std::string& name) const
+{
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		if (name == entries[i].name)
+		{
+			return i;
+		}
+	}
+	return entries.size();
+}
+
+Z_IndexedMesh Z_MeshFile::load(size_t index) const
+{
+	const mesh_entry& e = entries[index];
+	std::vector<uint8_t> vertices(get_Vertices(index), get_Vertices(index) + e.vertices_size);
+
+	std::vector<uint32_t> indices = unpack_indices(get_Indices(index), e.indices_qty, e.index_size);
+	return Z_IndexedMesh(std::move(vertices), e.layout.stride, std::move(indices));
+}
+
+std::vector<uint32_t> Z_MeshFile::load_Lod(size_t index, size_t level) const
+{
+	const mesh_entry& e = entries[index];
+	const lod_level& lod = e.lods[level];
+	return unpack_indices(get_LodIndices(index) + static_cast<size_t>(lod.first_index) * e.index_size, lod.indices_qty, e.index_size);
+}
@@ -0,0 +1,179 @@
+/* Z_MeshFile.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_MeshFile_h
+#define Z_MeshFile_h
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "Z_MappedFile.h"
+#include "Z_IndexedMesh.h"
+#include "Z_VertexQuantizer.h"
+
+/* Binary container of indexed meshes, little endian:                      */
+/*   file_header                                                           */
+/*   mesh_entry[meshes_qty]        at table_offset                         */
+/*   vertex, index and lod blobs   each at a blob_alignment offset         */
+/* Readers accept any minor version of their major version, entries are   */
+/* entry_size bytes long so newer minors may append fields to them.        */
+/* Minor 1 appends the levels of detail: index lists of the same vertices */
+/* in one blob per mesh, the error of each in object space units.         */
+/* The file is memory mapped: opening reads only the header and the table, */
+/* the blobs of a mesh are paged in when they are first read.              */
+class Z_MeshFile
+{
+public:
+	static const uint16_t version_major = 1;
+	static const uint16_t version_minor = 1;
+	static const uint32_t max_lods = 8;
+	static const uint32_t blob_alignment = 64;
+
+	enum attribute_format : uint32_t
+	{
+		format_none,
+		format_float32x2,
+		format_float32x3,
+		format_float32x4,
+		format_half2,
+		format_half4,
+		format_snorm16x4,
+		format_unorm8x4,
+		/* Octahedral normal in snorm16x2. */
+		format_octahedral16,
+	};
+
+	enum attribute_slot { slot_position, slot_color, slot_uv, slot_normal, slots_qty };
+
+	struct vertex_attribute
+	{
+		uint32_t format;
+		uint32_t offset;
+	};
+
+	/* A decoded position maps back to the source one as center + extent * p. */
+	struct vertex_layout
+	{
+		uint32_t stride;
+		vertex_attribute attributes[slots_qty];
+		float center[3];
+		float extent[3];
+	};
+
+	struct file_header
+	{
+		char magic[4];
+		uint16_t major;
+		uint16_t minor;
+		uint32_t meshes_qty;
+		uint32_t entry_size;
+		uint64_t table_offset;
+	};
+
+	/* Indices of a level are in the lod blob from first_index on. */
+	struct lod_level
+	{
+		uint32_t first_index;
+		uint32_t indices_qty;
+		float error;
+		uint32_t reserved;
+	};
+
+	struct mesh_entry
+	{
+		char name[32];
+		vertex_layout layout;
+		uint32_t vertices_qty;
+		uint32_t indices_qty;
+		uint32_t index_size;
+		uint32_t reserved[2];
+		uint64_t vertices_offset;
+		uint64_t vertices_size;
+		uint64_t indices_offset;
+		uint64_t indices_size;
+		/* Minor 1 on, zero in entries of older files. */
+		uint32_t lods_qty;
+		uint32_t reserved_lods;
+		uint64_t lods_offset;
+		uint64_t lods_size;
+		lod_level lods[max_lods];
+	};
+
+	/* Size of the entries of minor 0 files. */
+	static const uint32_t entry_size_1_0 = 144;
+
+	/* Coarser levels of a mesh, from the finest on. */
+	struct lod_source
+	{
+		std::vector<uint32_t> indices;
+		float error;
+	};
+
+	/* A mesh to write, its vertices are already in the given layout. */
+	struct source
+	{
+		std::string name;
+		const Z_IndexedMesh* mesh;
+		vertex_layout layout;
+		std::vector<lod_source> lods;
+	};
+
+	/* Layout of float vertices, or of vertices packed by a quantizer. */
+	static vertex_layout make_Layout(const Z_VertexQuantizer::source_layout& floats);
+	static vertex_layout make_Layout(const Z_VertexQuantizer& quantizer);
+
+	/* Indices are stored as 16-bit ones whenever they fit, those of the */
+	/* levels of detail with the size of the mesh ones.                  */
+	static void write(const std::string& path, const std::vector<source>& meshes);
+
+	Z_MeshFile() {}
+	/* Throws std::domain_error on a file of another format or major version. */
+	explicit Z_MeshFile(const std::string& path);
+
+	size_t get_MeshesQty() const { return entries.size(); }
+	const mesh_entry& get_Entry(size_t index) const { return entries[index]; }
+	/* Index of the mesh of that name, get_MeshesQty() if there is none. */
+	size_t find(const std::string& name) const;
+
+	/* Point into the mapped file, valid as long as this object. */
+	const uint8_t* get_Vertices(size_t index) const { return file.data() + entries[index].vertices_offset; }
+	const uint8_t* get_Indices(size_t index) const { return file.data() + entries[index].indices_offset; }
+	const uint8_t* get_LodIndices(size_t index) const { return file.data() + entries[index].lods_offset; }
+
+	/* Copies a mesh out of the file, with 32-bit indices. */
+	Z_IndexedMesh load(size_t index) const;
+	/* Copies the indices of a level of detail, with 32 bits each. */
+	std::vector<uint32_t> load_Lod(size_t index, size_t level) const;
+private:
+	Z_MappedFile file;
+	std::vector<mesh_entry> entries;
+};
+
+#endif // !Z_MeshFile_h
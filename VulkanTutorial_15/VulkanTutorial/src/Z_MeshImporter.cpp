@@ -0,0 +1,1303 @@
+/* Z_MeshImporter.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_MeshImporter.h"
+#include "Z_MappedFile.h"
+#include <stdexcept>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+	typedef std::chrono::high_resolution_clock clock;
+
+	double seconds_since(clock::time_point start)
+	{
+		return std::chrono::duration<double>(clock::now() - start).count();
+	}
+
+	bool has_extension(const std::string& path, const char* extension)
+	{
+		const size_t length = std::strlen(extension);
+		if (path.size() < length)
+		{
+			return false;
+		}
+		for (size_t i = 0; i < length; ++i)
+		{
+			const char c = path[path.size() - length + i];
+			if (std::tolower(static_cast<unsigned char>(c)) != extension[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/* Writes one vertex into a float layout, absent sources get defaults. */
+	void write_vertex(uint8_t* dst, const Z_VertexQuantizer::source_layout& layout,
+		const float* position, const float* color, const float* uv, const float* normal)
+	{
+		const uint32_t absent = Z_VertexQuantizer::absent;
+		if (absent != layout.position)
+		{
+			const float p[4] = { position[0], position[1], position[2], 1.0f };
+			std::memcpy(dst + layout.position, p, sizeof(p));
+		}
+		if (absent != layout.color)
+		{
+			float c[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			for (size_t k = 0; k < 3; ++k)
+			{
+				c[k] = color ? color[k] : normal ? 0.5f + 0.5f * normal[k] : 1.0f;
+			}
+			std::memcpy(dst + layout.color, c, sizeof(c));
+		}
+		if (absent != layout.uv)
+		{
+			const float t[2] = { uv ? uv[0] : 0.0f, uv ? uv[1] : 0.0f };
+			std::memcpy(dst + layout.uv, t, sizeof(t));
+		}
+		if (absent != layout.normal)
+		{
+			const float n[3] = { normal ? normal[0] : 0.0f, normal ? normal[1] : 0.0f, normal ? normal[2] : 0.0f };
+			std::memcpy(dst + layout.normal, n, sizeof(n));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	// OBJ text scanning.
+
+	bool is_blank(char c)
+	{
+		return ' ' == c || '\t' == c || '\r' == c;
+	}
+
+	const char* skip_blanks(const char* p, const char* end)
+	{
+		while (p < end && is_blank(*p))
+		{
+			++p;
+		}
+		return p;
+	}
+
+	const char* next_line(const char* p, const char* end)
+	{
+		const void* found = std::memchr(p, '\n', end - p);
+		return found ? static_cast<const char*>(found) + 1 : end;
+	}
+
+	/* Faster than strtod and independent of the locale, exact enough */
+	/* for vertex data.                                                */
+	bool parse_float(const char*& p, const char* end, float& value)
+	{
+		const char* s = p;
+		bool negative = false;
+		if (s < end && ('-' == *s || '+' == *s))
+		{
+			negative = '-' == *s++;
+		}
+
+		double mantissa = 0.0;
+		bool digits = false;
+		while (s < end && *s >= '0' && *s <= '9')
+		{
+			mantissa = mantissa * 10.0 + (*s++ - '0');
+			digits = true;
+		}
+		if (s < end && '.' == *s)
+		{
+			++s;
+			double scale = 0.1;
+			while (s < end && *s >= '0' && *s <= '9')
+			{
+				mantissa += (*s++ - '0') * scale;
+				scale *= 0.1;
+				digits = true;
+			}
+		}
+		if (!digits)
+		{
+			return false;
+		}
+		if (s < end && ('e' == *s || 'E' == *s))
+		{
+			++s;
+			bool negative_exponent = false;
+			if (s < end && ('-' == *s || '+' == *s))
+			{
+				negative_exponent = '-' == *s++;
+			}
+			int exponent = 0;
+			while (s < end && *s >= '0' && *s <= '9')
+			{
+				exponent = std::min(exponent * 10 + (*s++ - '0'), 400);
+			}
+			mantissa *= std::pow(10.0, negative_exponent ? -exponent : exponent);
+		}
+
+		value = static_cast<float>(negative ? -mantissa : mantissa);
+		p = s;
+		return true;
+	}
+
+	bool parse_int(const char*& p, const char* end, int64_t& value)
+	{
+		const char* s = p;
+		bool negative = false;
+		if (s < end && ('-' == *s || '+' == *s))
+		{
+			negative = '-' == *s++;
+		}
+		if (s == end || *s < '0' || *s > '9')
+		{
+			return false;
+		}
+		int64_t v = 0;
+		while (s < end && *s >= '0' && *s <= '9')
+		{
+			v = v * 10 + (*s++ - '0');
+		}
+		value = negative ? -v : v;
+		p = s;
+		return true;
+	}
+
+	size_t count_tokens(const char* p, const char* end)
+	{
+		size_t qty = 0;
+		for (;;)
+		{
+			p = skip_blanks(p, end);
+			if (p == end || '\n' == *p || '#' == *p)
+			{
+				return qty;
+			}
+			++qty;
+			while (p < end && !is_blank(*p) && '\n' != *p)
+			{
+				++p;
+			}
+		}
+	}
+
+	enum obj_line { line_other, line_position, line_uv, line_normal, line_face };
+
+	obj_line classify(const char*& p, const char* end)
+	{
+		p = skip_blanks(p, end);
+		if (end - p < 2)
+		{
+			return line_other;
+		}
+		if ('v' == p[0] && is_blank(p[1]))
+		{
+			p += 2;
+			return line_position;
+		}
+		if ('f' == p[0] && is_blank(p[1]))
+		{
+			p += 2;
+			return line_face;
+		}
+		if (end - p >= 3 && 'v' == p[0] && is_blank(p[2]))
+		{
+			if ('t' == p[1])
+			{
+				p += 3;
+				return line_uv;
+			}
+			if ('n' == p[1])
+			{
+				p += 3;
+				return line_normal;
+			}
+		}
+		return line_other;
+	}
+
+	//////////////////////////////////////////////////////////////////////
+	// Just enough JSON for glTF.
+
+	struct json_value
+	{
+		enum kind_type { null_kind, bool_kind, number_kind, string_kind, array_kind, object_kind };
+
+		kind_type kind{ null_kind };
+		bool boolean{};
+		double number{};
+		std::string string;
+		std::vector<json_value> array;
+		std::vector<std::pair<std::string, json_value>> object;
+
+		const json_value* find(const char* key) const
+		{
+			for (auto& member : object)
+			{
+				if (member.first == key)
+				{
+					return &member.second;
+				}
+			}
+			return nullptr;
+		}
+
+		double get_Number(const char* key, double default_value) const
+		{
+			const json_value* v = find(key);
+			return v && number_kind == v->kind ? v->number : default_value;
+		}
+
+		const json_value& at(size_t index) const
+		{
+			if (array_kind != kind || index >= array.size())
+			{
+				throw std::domain_error{ "glTF refers to a missing element" };
+			}
+			return array[index];
+		}
+	};
+
+	class json_parser
+	{
+	public:
+		json_parser(const char* begin, const char* end) : p(begin), end(end) {}
+
+		json_value parse()
+		{
+			json_value v = parse_value();
+			skip_spaces();
+			if (p != end)
+			{
+				fail();
+			}
+			return v;
+		}
+	private:
+		void fail() const
+		{
+			throw std::domain_error{ "glTF JSON is malformed" };
+		}
+
+		void skip_spaces()
+		{
+			while (p < end && (' ' == *p || '\t' == *p || '\r' == *p || '\n' == *p))
+			{
+				++p;
+			}
+		}
+
+		void expect(char c)
+		{
+			skip_spaces();
+			if (p == end || *p != c)
+			{
+				fail();
+			}
+			++p;
+		}
+
+		json_value parse_value()
+		{
+			skip_spaces();
+			if (p == end)
+			{
+				fail();
+			}
+
+			json_value v;
+			switch (*p)
+			{
+			case '{':
+				v.kind = json_value::object_kind;
+				++p;
+				skip_spaces();
+				if (p < end && '}' == *p)
+				{
+					++p;
+					return v;
+				}
+				for (;;)
+				{
+					skip_spaces();
+					std::string key = parse_string();
+					expect(':');
+					v.object.push_back(std::make_pair(std::move(key), parse_value()));
+					skip_spaces();
+					if (p < end && ',' == *p)
+					{
+						++p;
+						continue;
+					}
+					expect('}');
+					return v;
+				}
+			case '[':
+				v.kind = json_value::array_kind;
+				++p;
+				skip_spaces();
+				if (p < end && ']' == *p)
+				{
+					++p;
+					return v;
+				}
+				for (;;)
+				{
+					v.array.push_back(parse_value());
+					skip_spaces();
+					if (p < end && ',' == *p)
+					{
+						++p;
+						continue;
+					}
+					expect(']');
+					return v;
+				}
+			case '"':
+				v.kind = json_value::string_kind;
+				v.string = parse_string();
+				return v;
+			case 't':
+				match("true");
+				v.kind = json_value::bool_kind;
+				v.boolean = true;
+				return v;
+			case 'f':
+				match("false");
+				v.kind = json_value::bool_kind;
+				return v;
+			case 'n':
+				match("null");
+				return v;
+			default:
+				{
+					float f = 0.0f;
+					// Integers parse exactly, accessor offsets exceed float precision.
+					const char* s = p;
+					int64_t i = 0;
+					if (parse_int(s, end, i) && (s == end || ('.' != *s && 'e' != *s && 'E' != *s)))
+					{
+						v.number = static_cast<double>(i);
+						p = s;
+					}
+					else if (parse_float(p, end, f))
+					{
+						v.number = f;
+					}
+					else
+					{
+						fail();
+					}
+					v.kind = json_value::number_kind;
+					return v;
+				}
+			}
+		}
+
+		void match(const char* word)
+		{
+			const size_t length = std::strlen(word);
+			if (static_cast<size_t>(end - p) < length || std::strncmp(p, word, length))
+			{
+				fail();
+			}
+			p += length;
+		}
+
+		std::string parse_string()
+		{
+			if (p == end || '"' != *p)
+			{
+				fail();
+			}
+			++p;
+
+			std::string s;
+			while (p < end && '"' != *p)
+			{
+				if ('\\' != *p)
+				{
+					s += *p++;
+					continue;
+				}
+				if (++p == end)
+				{
+					fail();
+				}
+				const char escaped = *p++;
+				switch (escaped)
+				{
+				case 'b': s += '\b'; break;
+				case 'f': s += '\f'; break;
+				case 'n': s += '\n'; break;
+				case 'r': s += '\r'; break;
+				case 't': s += '\t'; break;
+				case 'u':
+					{
+						if (end - p < 4)
+						{
+							fail();
+						}
+						const unsigned long code = std::strtoul(std::string(p, p + 4).c_str(), nullptr, 16);
+						p += 4;
+						// Encoded as UTF-8, surrogate pairs are not joined.
+						if (code < 0x80)
+						{
+							s += static_cast<char>(code);
+						}
+						else if (code < 0x800)
+						{
+							s += static_cast<char>(0xc0 | (code >> 6));
+							s += static_cast<char>(0x80 | (code & 0x3f));
+						}
+						else
+						{
+							s += static_cast<char>(0xe0 | (code >> 12));
+							s += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+							s += static_cast<char>(0x80 | (code & 0x3f));
+						}
+					}
+					break;
+				default: s += escaped; break;
+				}
+			}
+			if (p == end)
+			{
+				fail();
+			}
+			++p;
+			return s;
+		}
+
+		const char* p;
+		const char* end;
+	};
+
+	/* Typed view of a glTF accessor inside a mapped buffer. */
+	struct accessor_view
+	{
+		const uint8_t* data{};
+		size_t count{};
+		size_t stride{};
+		uint32_t component_type{};
+		uint32_t components{};
+		bool normalized{};
+
+		float read(size_t i, size_t c) const
+		{
+			const uint8_t* e = data + i * stride;
+			switch (component_type)
+			{
+			case 5120: return normalized ? std::max(reinterpret_cast<const int8_t*>(e)[c] / 127.0f, -1.0f) : reinterpret_cast<const int8_t*>(e)[c];
+			case 5121: return normalized ? e[c] / 255.0f : e[c];
+			case 5122:
+				{
+					int16_t v;
+					std::memcpy(&v, e + 2 * c, sizeof(v));
+					return normalized ? std::max(v / 32767.0f, -1.0f) : v;
+				}
+			case 5123:
+				{
+					uint16_t v;
+					std::memcpy(&v, e + 2 * c, sizeof(v));
+					return normalized ? v / 65535.0f : v;
+				}
+			case 5125:
+				{
+					uint32_t v;
+					std::memcpy(&v, e + 4 * c, sizeof(v));
+					return static_cast<float>(v);
+				}
+			default:
+				{
+					float v;
+					std::memcpy(&v, e + 4 * c, sizeof(v));
+					return v;
+				}
+			}
+		}
+
+		uint32_t read_index(size_t i) const
+		{
+			const uint8_t* e = data + i * stride;
+			switch (component_type)
+			{
+			case 5121: return *e;
+			case 5123:
+				{
+					uint16_t v;
+					std::memcpy(&v, e, sizeof(v));
+					return v;
+				}
+			default:
+				{
+					uint32_t v;
+					std::memcpy(&v, e, sizeof(v));
+					return v;
+				}
+			}
+		}
+	};
+
+	uint32_t component_size(uint32_t component_type)
+	{
+		switch (component_type)
+		{
+		case 5120:
+		case 5121: return 1;
+		case 5122:
+		case 5123: return 2;
+		case 5125:
+		case 5126: return 4;
+		default:
+			throw std::domain_error{ "glTF accessor has an unknown component type" };
+		}
+	}
+
+	uint32_t components_qty(const std::string& type)
+	{
+		if ("SCALAR" == type) return 1;
+		if ("VEC2" == type) return 2;
+		if ("VEC3" == type) return 3;
+		if ("VEC4" == type) return 4;
+		throw std::domain_error{ "glTF accessor type " + type + " is not a vertex attribute" };
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Model data.
+
+struct Z_MeshImporter::obj_model
+{
+	/* A face corner: indices of a position, uv and normal, -1 if absent. */
+	struct corner
+	{
+		int64_t position;
+		int64_t uv;
+		int64_t normal;
+	};
+
+	struct chunk
+	{
+		const char* begin;
+		const char* end;
+		size_t positions;
+		size_t uvs;
+		size_t normals;
+		size_t triangles;
+		bool has_colors;
+	};
+
+	Z_MappedFile file;
+	std::vector<float> positions;
+	std::vector<float> colors;
+	std::vector<float> uvs;
+	std::vector<float> normals;
+	std::vector<corner> corners;
+};
+
+struct Z_MeshImporter::gltf_model
+{
+	struct primitive
+	{
+		accessor_view position;
+		accessor_view color;
+		accessor_view uv;
+		accessor_view normal;
+		accessor_view indices;
+	};
+
+	std::vector<Z_MappedFile> buffers;
+	std::vector<primitive> primitives;
+	size_t vertices_qty{};
+	size_t indices_qty{};
+};
+
+Z_MeshImporter::Z_MeshImporter(const Z_VertexQuantizer::source_layout& layout, Z_ThreadPool& pool)
+	: layout(layout)
+	, pool(pool)
+	, bounds_min()
+	, bounds_max()
+{
+}
+
+Z_MeshImporter::~Z_MeshImporter()
+{
+}
+
+void Z_MeshImporter::open(const std::string& path)
+{
+	obj.reset();
+	gltf.reset();
+	stats = statistics{};
+	for (size_t k = 0; k < 3; ++k)
+	{
+		bounds_min[k] = std::numeric_limits<float>::max();
+		bounds_max[k] = -std::numeric_limits<float>::max();
+	}
+
+	if (has_extension(path, ".obj"))
+	{
+		open_Obj(path);
+	}
+	else if (has_extension(path, ".gltf"))
+	{
+		open_Gltf(path);
+	}
+	else
+	{
+		throw std::domain_error{ "File " + path + " is neither .obj nor .gltf" };
+	}
+}
+
+size_t Z_MeshImporter::get_MaxVerticesQty() const
+{
+	// Every OBJ corner may become a vertex of its own.
+	return obj ? obj->corners.size() : gltf ? gltf->vertices_qty : 0;
+}
+
+size_t Z_MeshImporter::get_MaxIndicesQty() const
+{
+	return obj ? obj->corners.size() : gltf ? gltf->indices_qty : 0;
+}
+
+bool Z_MeshImporter::fits_16bit_indices() const
+{
+	if (gltf)
+	{
+		for (auto& prim : gltf->primitives)
+		{
+			if (prim.position.count > max_part_vertices)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void Z_MeshImporter::build(const part_sink& sink)
+{
+	auto start = clock::now();
+	if (obj)
+	{
+		build_Obj(sink);
+	}
+	else if (gltf)
+	{
+		build_Gltf(sink);
+	}
+	stats.build_seconds += seconds_since(start);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// OBJ.
+
+void Z_MeshImporter::open_Obj(const std::string& path)
+{
+	auto start = clock::now();
+	std::unique_ptr<obj_model> model(new obj_model);
+	model->file = Z_MappedFile(path);
+	stats.bytes = model->file.size();
+
+	// Chunks end at line ends, a few per thread balance uneven lines.
+	const char* text = reinterpret_cast<const char*>(model->file.data());
+	const char* text_end = text + model->file.size();
+	const size_t chunk_size = std::max<size_t>(model->file.size() / (4 * (pool.size() + 1)), 1 << 20);
+	std::vector<obj_model::chunk> chunks;
+	for (const char* p = text; p < text_end;)
+	{
+		const char* e = p + std::min<size_t>(chunk_size, text_end - p);
+		e = e < text_end ? next_line(e, text_end) : text_end;
+		chunks.push_back(obj_model::chunk{ p, e, 0, 0, 0, 0, false });
+		p = e;
+	}
+
+	// The first pass counts the elements of every chunk.
+	pool.parallel_for(chunks.size(), 1, [&](size_t begin, size_t end)
+	{
+		for (size_t c = begin; c < end; ++c)
+		{
+			obj_model::chunk& ch = chunks[c];
+			for (const char* p = ch.begin; p < ch.end; p = next_line(p, ch.end))
+			{
+				const char* s = p;
+				switch (classify(s, ch.end))
+				{
+				case line_position:
+					++ch.positions;
+					ch.has_colors = ch.has_colors || count_tokens(s, ch.end) >= 6;
+					break;
+				case line_uv: ++ch.uvs; break;
+				case line_normal: ++ch.normals; break;
+				case line_face:
+					{
+						const size_t qty = count_tokens(s, ch.end);
+						ch.triangles += qty > 2 ? qty - 2 : 0;
+					}
+					break;
+				default: break;
+				}
+			}
+		}
+	});
+
+	// Prefix sums give every chunk its place in the shared arrays.
+	std::vector<obj_model::chunk> bases(chunks.size());
+	obj_model::chunk total{ nullptr, nullptr, 0, 0, 0, 0, false };
+	for (size_t c = 0; c < chunks.size(); ++c)
+	{
+		bases[c] = total;
+		total.positions += chunks[c].positions;
+		total.uvs += chunks[c].uvs;
+		total.normals += chunks[c].normals;
+		total.triangles += chunks[c].triangles;
+		total.has_colors = total.has_colors || chunks[c].has_colors;
+	}
+	model->positions.resize(3 * total.positions);
+	model->colors.resize(total.has_colors ? 3 * total.positions : 0);
+	model->uvs.resize(2 * total.uvs);
+	model->normals.resize(3 * total.normals);
+	model->corners.resize(3 * total.triangles);
+
+	std::vector<std::array<float, 6>> chunk_bounds(chunks.size());
+	pool.parallel_for(chunks.size(), 1, [&](size_t begin, size_t end)
+	{
+		for (size_t c = begin; c < end; ++c)
+		{
+			const obj_model::chunk& ch = chunks[c];
+			size_t position = bases[c].positions;
+			size_t uv = bases[c].uvs;
+			size_t normal = bases[c].normals;
+			size_t corner = 3 * bases[c].triangles;
+			std::array<float, 6>& bounds = chunk_bounds[c];
+			for (size_t k = 0; k < 3; ++k)
+			{
+				bounds[k] = std::numeric_limits<float>::max();
+				bounds[k + 3] = -std::numeric_limits<float>::max();
+			}
+
+			// Negative indices count back from the elements read so far.
+			auto resolve = [](int64_t index, size_t qty) -> int64_t
+			{
+				return index > 0 ? index - 1 : index < 0 ? static_cast<int64_t>(qty) + index : -1;
+			};
+
+			for (const char* p = ch.begin; p < ch.end; p = next_line(p, ch.end))
+			{
+				const char* line_end = next_line(p, ch.end);
+				const char* s = p;
+				switch (classify(s, line_end))
+				{
+				case line_position:
+					{
+						float v[7] = {};
+						size_t qty = 0;
+						while (qty < 7 && parse_float(s = skip_blanks(s, line_end), line_end, v[qty]))
+						{
+							++qty;
+						}
+						if (qty < 3)
+						{
+							throw std::domain_error{ "OBJ vertex has less than 3 coordinates" };
+						}
+						for (size_t k = 0; k < 3; ++k)
+						{
+							model->positions[3 * position + k] = v[k];
+							bounds[k] = std::min(bounds[k], v[k]);
+							bounds[k + 3] = std::max(bounds[k + 3], v[k]);
+						}
+						// x y z r g b, a w between them is ignored.
+						if (model->colors.size())
+						{
+							const size_t first = 7 == qty ? 4 : 3;
+							for (size_t k = 0; k < 3; ++k)
+							{
+								model->colors[3 * position + k] = qty >= 6 ? v[first + k] : 1.0f;
+							}
+						}
+						++position;
+					}
+					break;
+				case line_uv:
+					{
+						float t[2] = {};
+						parse_float(s = skip_blanks(s, line_end), line_end, t[0]);
+						parse_float(s = skip_blanks(s, line_end), line_end, t[1]);
+						// OBJ rows go up, Vulkan ones go down.
+						model->uvs[2 * uv] = t[0];
+						model->uvs[2 * uv + 1] = 1.0f - t[1];
+						++uv;
+					}
+					break;
+				case line_normal:
+					for (size_t k = 0; k < 3; ++k)
+					{
+						parse_float(s = skip_blanks(s, line_end), line_end, model->normals[3 * normal + k]);
+					}
+					++normal;
+					break;
+				case line_face:
+					{
+						obj_model::corner first{};
+						obj_model::corner previous{};
+						size_t qty = 0;
+						for (;;)
+						{
+							s = skip_blanks(s, line_end);
+							int64_t index = 0;
+							if (!parse_int(s, line_end, index))
+							{
+								break;
+							}
+							obj_model::corner k{ resolve(index, position), -1, -1 };
+							if (s < line_end && '/' == *s)
+							{
+								++s;
+								if (parse_int(s, line_end, index))
+								{
+									k.uv = resolve(index, uv);
+								}
+								if (s < line_end && '/' == *s)
+								{
+									++s;
+									if (parse_int(s, line_end, index))
+									{
+										k.normal = resolve(index, normal);
+									}
+								}
+							}
+
+							// Polygons are triangulated as fans.
+							if (qty >= 2)
+							{
+								model->corners[corner++] = first;
+								model->corners[corner++] = previous;
+								model->corners[corner++] = k;
+							}
+							else if (!qty)
+							{
+								first = k;
+							}
+							previous = k;
+							++qty;
+						}
+					}
+					break;
+				default: break;
+				}
+			}
+		}
+	});
+
+	for (auto& b : chunk_bounds)
+	{
+		for (size_t k = 0; k < 3; ++k)
+		{
+			bounds_min[k] = std::min(bounds_min[k], b[k]);
+			bounds_max[k] = std::max(bounds_max[k], b[k + 3]);
+		}
+	}
+
+	obj = std::move(model);
+	stats.parse_seconds += seconds_since(start);
+}
+
+void Z_MeshImporter::build_Obj(const part_sink& sink)
+{
+	const obj_model& model = *obj;
+	const size_t triangles_qty = model.corners.size() / 3;
+	// No part can exceed 16-bit indices, even with no vertex shared.
+	const size_t part_triangles = max_part_vertices / 3;
+	const size_t parts_qty = (triangles_qty + part_triangles - 1) / part_triangles;
+	const size_t group_size = pool.size() + 1;
+	const size_t positions_qty = model.positions.size() / 3;
+	const size_t uvs_qty = model.uvs.size() / 2;
+	const size_t normals_qty = model.normals.size() / 3;
+
+	std::vector<Z_IndexedMesh> group(group_size);
+	for (size_t first_part = 0; first_part < parts_qty; first_part += group_size)
+	{
+		const size_t group_parts = std::min(group_size, parts_qty - first_part);
+		pool.parallel_for(group_parts, 1, [&](size_t begin, size_t end)
+		{
+			for (size_t g = begin; g < end; ++g)
+			{
+				const size_t first_corner = 3 * (first_part + g) * part_triangles;
+				const size_t corners_qty = std::min(3 * part_triangles, model.corners.size() - first_corner);
+
+				// Open addressing from corners to the part vertices.
+				size_t table_size = 1;
+				while (table_size < 2 * corners_qty)
+				{
+					table_size <<= 1;
+				}
+				std::vector<uint32_t> table(table_size, ~0u);
+				std::vector<uint32_t> corner_of_vertex;
+				std::vector<uint32_t> indices(corners_qty);
+				for (size_t i = 0; i < corners_qty; ++i)
+				{
+					const obj_model::corner& k = model.corners[first_corner + i];
+					if (k.position < 0 || static_cast<size_t>(k.position) >= positions_qty
+						|| static_cast<size_t>(k.uv + 1) > uvs_qty || static_cast<size_t>(k.normal + 1) > normals_qty)
+					{
+						throw std::domain_error{ "OBJ face refers to a missing element" };
+					}
+
+					size_t slot = static_cast<size_t>((k.position * 73856093) ^ (k.uv * 19349663) ^ (k.normal * 83492791)) & (table_size - 1);
+					for (;;)
+					{
+						if (~0u == table[slot])
+						{
+							table[slot] = static_cast<uint32_t>(corner_of_vertex.size());
+							corner_of_vertex.push_back(static_cast<uint32_t>(first_corner + i));
+							break;
+						}
+						const obj_model::corner& o = model.corners[corner_of_vertex[table[slot]]];
+						if (o.position == k.position && o.uv == k.uv && o.normal == k.normal)
+						{
+							break;
+						}
+						slot = (slot + 1) & (table_size - 1);
+					}
+					indices[i] = table[slot];
+				}
+
+				std::vector<uint8_t> vertices(corner_of_vertex.size() * layout.stride, 0);
+				for (size_t v = 0; v < corner_of_vertex.size(); ++v)
+				{
+					const obj_model::corner& k = model.corners[corner_of_vertex[v]];
+					const size_t p = static_cast<size_t>(k.position);
+					write_vertex(vertices.data() + v * layout.stride, layout,
+						&model.positions[3 * p],
+						model.colors.size() ? &model.colors[3 * p] : nullptr,
+						k.uv >= 0 ? &model.uvs[2 * static_cast<size_t>(k.uv)] : nullptr,
+						k.normal >= 0 ? &model.normals[3 * static_cast<size_t>(k.normal)] : nullptr);
+				}
+
+				group[g] = Z_IndexedMesh(std::move(vertices), layout.stride, std::move(indices));
+			}
+		});
+
+		for (size_t g = 0; g < group_parts; ++g)
+		{
+			stats.triangles += group[g].get_IndicesQty() / 3;
+			stats.vertices += group[g].get_VerticesQty();
+			++stats.parts;
+			sink(group[g]);
+			group[g] = Z_IndexedMesh();
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// glTF.
+
+void Z_MeshImporter::open_Gltf(const std::string& path)
+{
+	auto start = clock::now();
+	std::unique_ptr<gltf_model> model(new gltf_model);
+
+	Z_MappedFile file(path);
+	stats.bytes = file.size();
+	const char* text = reinterpret_cast<const char*>(file.data());
+	const json_value root = json_parser(text, text + file.size()).parse();
+
+	// Buffers are .bin files next to the .gltf one.
+	const std::string directory = path.substr(0, path.find_last_of("/\\") + 1);
+	const json_value* buffers = root.find("buffers");
+	if (buffers)
+	{
+		for (auto& b : buffers->array)
+		{
+			const json_value* uri = b.find("uri");
+			if (!uri || json_value::string_kind != uri->kind || !uri->string.compare(0, 5, "data:"))
+			{
+				throw std::domain_error{ "glTF buffers must be external files" };
+			}
+			model->buffers.push_back(Z_MappedFile(directory + uri->string));
+			stats.bytes += model->buffers.back().size();
+		}
+	}
+
+	const json_value empty;
+	const json_value* views = root.find("bufferViews");
+	const json_value* accessors = root.find("accessors");
+	auto get_accessor = [&](size_t index, bool vertex_attribute) -> accessor_view
+	{
+		const json_value& a = (accessors ? *accessors : empty).at(index);
+		const json_value& v = (views ? *views : empty).at(static_cast<size_t>(a.get_Number("bufferView", -1)));
+		const size_t buffer = static_cast<size_t>(v.get_Number("buffer", -1));
+		if (buffer >= model->buffers.size())
+		{
+			throw std::domain_error{ "glTF refers to a missing buffer" };
+		}
+
+		accessor_view view;
+		view.component_type = static_cast<uint32_t>(a.get_Number("componentType", 0));
+		const json_value* type = a.find("type");
+		view.components = type ? components_qty(type->string) : 1;
+		view.count = static_cast<size_t>(a.get_Number("count", 0));
+		const json_value* normalized = a.find("normalized");
+		// Integer colors and uvs of glTF are normalized by definition.
+		view.normalized = (normalized && normalized->boolean) || (vertex_attribute && 5126 != view.component_type);
+		const size_t element_size = component_size(view.component_type) * view.components;
+		view.stride = static_cast<size_t>(v.get_Number("byteStride", static_cast<double>(element_size)));
+
+		const size_t view_offset = static_cast<size_t>(v.get_Number("byteOffset", 0));
+		const size_t view_length = static_cast<size_t>(v.get_Number("byteLength", 0));
+		const size_t offset = static_cast<size_t>(a.get_Number("byteOffset", 0));
+		if (view_offset + view_length > model->buffers[buffer].size()
+			|| (view.count && offset + (view.count - 1) * view.stride + element_size > view_length))
+		{
+			throw std::domain_error{ "glTF accessor is out of its buffer" };
+		}
+		view.data = model->buffers[buffer].data() + view_offset + offset;
+		return view;
+	};
+
+	const json_value* meshes = root.find("meshes");
+	if (meshes)
+	{
+		for (auto& mesh : meshes->array)
+		{
+			const json_value* primitives = mesh.find("primitives");
+			if (!primitives)
+			{
+				continue;
+			}
+			for (auto& p : primitives->array)
+			{
+				// Only triangle lists, and node transforms are not applied.
+				const json_value* attributes = p.find("attributes");
+				if (4 != p.get_Number("mode", 4) || !attributes || !attributes->find("POSITION"))
+				{
+					continue;
+				}
+
+				gltf_model::primitive prim;
+				prim.position = get_accessor(static_cast<size_t>(attributes->get_Number("POSITION", -1)), false);
+				if (attributes->find("COLOR_0"))
+				{
+					prim.color = get_accessor(static_cast<size_t>(attributes->get_Number("COLOR_0", -1)), true);
+				}
+				if (attributes->find("TEXCOORD_0"))
+				{
+					prim.uv = get_accessor(static_cast<size_t>(attributes->get_Number("TEXCOORD_0", -1)), true);
+				}
+				if (attributes->find("NORMAL"))
+				{
+					prim.normal = get_accessor(static_cast<size_t>(attributes->get_Number("NORMAL", -1)), false);
+				}
+				if (p.find("indices"))
+				{
+					prim.indices = get_accessor(static_cast<size_t>(p.get_Number("indices", -1)), false);
+				}
+
+				const json_value& position = accessors->at(static_cast<size_t>(attributes->get_Number("POSITION", -1)));
+				const json_value* lo = position.find("min");
+				const json_value* hi = position.find("max");
+				for (size_t k = 0; k < 3; ++k)
+				{
+					if (lo && hi && lo->array.size() >= 3 && hi->array.size() >= 3)
+					{
+						bounds_min[k] = std::min(bounds_min[k], static_cast<float>(lo->array[k].number));
+						bounds_max[k] = std::max(bounds_max[k], static_cast<float>(hi->array[k].number));
+					}
+					else
+					{
+						for (size_t i = 0; i < prim.position.count; ++i)
+						{
+							bounds_min[k] = std::min(bounds_min[k], prim.position.read(i, k));
+							bounds_max[k] = std::max(bounds_max[k], prim.position.read(i, k));
+						}
+					}
+				}
+
+				model->vertices_qty += prim.position.count;
+				model->indices_qty += prim.indices.data ? prim.indices.count : prim.position.count;
+				model->primitives.push_back(prim);
+			}
+		}
+	}
+
+	gltf = std::move(model);
+	stats.parse_seconds += seconds_since(start);
+}
+
+void Z_MeshImporter::build_Gltf(const part_sink& sink)
+{
+	for (auto& prim : gltf->primitives)
+	{
+		auto start = clock::now();
+		const size_t vertices_qty = prim.position.count;
+		std::vector<uint8_t> vertices(vertices_qty * layout.stride, 0);
+		pool.parallel_for(vertices_qty, 0x4000, [&](size_t begin, size_t end)
+		{
+			for (size_t v = begin; v < end; ++v)
+			{
+				float position[3] = {};
+				float color[4] = {};
+				float uv[2] = {};
+				float normal[3] = {};
+				for (size_t k = 0; k < 3; ++k)
+				{
+					position[k] = prim.position.read(v, k);
+				}
+				if (prim.color.data && v < prim.color.count)
+				{
+					for (size_t k = 0; k < std::min<size_t>(prim.color.components, 3); ++k)
+					{
+						color[k] = prim.color.read(v, k);
+					}
+				}
+				if (prim.uv.data && v < prim.uv.count)
+				{
+					uv[0] = prim.uv.read(v, 0);
+					uv[1] = prim.uv.read(v, 1);
+				}
+				if (prim.normal.data && v < prim.normal.count)
+				{
+					for (size_t k = 0; k < 3; ++k)
+					{
+						normal[k] = prim.normal.read(v, k);
+					}
+				}
+				write_vertex(vertices.data() + v * layout.stride, layout, position,
+					prim.color.data ? color : nullptr, prim.uv.data ? uv : nullptr, prim.normal.data ? normal : nullptr);
+			}
+		});
+
+		std::vector<uint32_t> indices(prim.indices.data ? prim.indices.count : vertices_qty);
+		pool.parallel_for(indices.size(), 0x10000, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				indices[i] = prim.indices.data ? prim.indices.read_index(i) : static_cast<uint32_t>(i);
+				if (indices[i] >= vertices_qty)
+				{
+					throw std::domain_error{ "glTF index refers to a missing vertex" };
+				}
+			}
+		});
+		// Decoding the binary buffers is the parse of glTF.
+		stats.parse_seconds += seconds_since(start);
+
+		Z_IndexedMesh part(std::move(vertices), layout.stride, std::move(indices));
+		stats.triangles += part.get_IndicesQty() / 3;
+		stats.vertices += part.get_VerticesQty();
+		++stats.parts;
+		sink(part);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Z_MeshImporter::benchmark(std::ostream& out, Z_ThreadPool& pool, size_t triangles_qty)
+{
+	// A height field with uvs and normals, written the way exporters do.
+	const size_t side = static_cast<size_t>(std::ceil(std::sqrt(triangles_qty / 2.0))) + 1;
+	const std::string path = "import_benchmark.obj";
+	{
+		std::ofstream obj(path, std::ios::binary | std::ios::trunc);
+		if (!obj)
+		{
+			throw std::domain_error{ "File " + path + " cannot be created" };
+		}
+		std::string text;
+		for (size_t y = 0; y < side; ++y)
+		{
+			for (size_t x = 0; x < side; ++x)
+			{
+				const float u = static_cast<float>(x) / (side - 1);
+				const float v = static_cast<float>(y) / (side - 1);
+				text = "v " + std::to_string(2.0f * u - 1.0f) + ' '
+					+ std::to_string(0.1f * std::sin(20.0f * u) * std::cos(20.0f * v)) + ' '
+					+ std::to_string(2.0f * v - 1.0f) + "\nvt " + std::to_string(u) + ' ' + std::to_string(v)
+					+ "\nvn 0.000000 1.000000 0.000000\n";
+				obj << text;
+			}
+		}
+		for (size_t y = 0; y + 1 < side; ++y)
+		{
+			for (size_t x = 0; x + 1 < side; ++x)
+			{
+				const size_t a = y * side + x + 1;
+				const size_t b = a + side;
+				text = "f";
+				const size_t corners[4] = { a, b, b + 1, a + 1 };
+				for (size_t k : corners)
+				{
+					const std::string index = std::to_string(k);
+					text += ' ' + index + '/' + index + '/' + index;
+				}
+				obj << text << '\n';
+			}
+		}
+	}
+
+	const Z_VertexQuantizer::source_layout layout{ 8 * sizeof(float), 0, 4 * sizeof(float),
+		Z_VertexQuantizer::absent, Z_VertexQuantizer::absent };
+	auto run = [&](Z_ThreadPool& p, const char* label)
+	{
+		Z_MeshImporter importer(layout, p);
+		importer.open(path);
+		size_t largest_part = 0;
+		importer.build([&](const Z_IndexedMesh& part)
+		{
+			largest_part = std::max(largest_part, part.get_Vertices().size() + 4 * part.get_IndicesQty());
+		});
+
+		const statistics s = importer.get_Statistics();
+		out << "    " << label << s.bytes / (1024 * 1024) << " MB at " << s.parse_megabytes_per_second() << " MB/s parse, "
+			<< s.build_seconds * 1000.0 << " ms build, " << s.parts << " parts of "
+			<< largest_part / 1024 << " KB at most\n";
+	};
+
+	const auto flags = out.flags();
+	const auto precision = out.precision();
+	out << std::fixed << std::setprecision(0);
+	Z_ThreadPool serial(1);
+	out << "Import of a " << 2 * (side - 1) * (side - 1) << " triangles OBJ:\n";
+	run(serial, (std::to_string(serial.size() + 1) + " threads:         ").c_str());
+	run(pool, (std::to_string(pool.size() + 1) + " threads:         ").c_str());
+	out.flags(flags);
+	out.precision(precision);
+
+	std::remove(path.c_str());
+}
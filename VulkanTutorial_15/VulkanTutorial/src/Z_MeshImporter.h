@@ -0,0 +1,118 @@
+/* Z_MeshImporter.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_MeshImporter_h
+#define Z_MeshImporter_h
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <ostream>
+#include <cstdint>
+
+#include "Z_IndexedMesh.h"
+#include "Z_VertexQuantizer.h"
+#include "Z_ThreadPool.h"
+
+/* Imports Wavefront OBJ and glTF 2.0 (JSON with external .bin buffers)   */
+/* models into indexed meshes of a float vertex layout.                   */
+/* The files are memory mapped. OBJ text is split at line boundaries into */
+/* chunks parsed in parallel: one pass counts the elements of each chunk,*/
+/* the second one parses them straight to their final place. glTF         */
+/* accessors are read from the mapped buffers.                            */
+/* Meshes are built as parts in groups of one per thread and handed to a  */
+/* sink in order, so only one group of parts is in memory at a time.    */
+class Z_MeshImporter
+{
+public:
+	struct statistics
+	{
+		uint64_t bytes;
+		double parse_seconds;
+		double build_seconds;
+		size_t triangles;
+		size_t vertices;
+		size_t parts;
+
+		double parse_megabytes_per_second() const { return parse_seconds > 0.0 ? bytes / (1024.0 * 1024.0) / parse_seconds : 0.0; }
+	};
+
+	typedef std::function<void(const Z_IndexedMesh& part)> part_sink;
+
+	/* OBJ parts have at most 65536 vertices, so they take 16-bit indices. */
+	static const size_t max_part_vertices = 0x10000;
+
+	/* Attributes a model lacks get defaults: colors come from the normals */
+	/* or are white, uvs and normals are zero. Position w is always 1.     */
+	Z_MeshImporter(const Z_VertexQuantizer::source_layout& layout, Z_ThreadPool& pool);
+	~Z_MeshImporter();
+
+	Z_MeshImporter(const Z_MeshImporter&) = delete;
+	Z_MeshImporter& operator=(const Z_MeshImporter&) = delete;
+
+	/* Parses a .obj or a .gltf file, throws std::domain_error on errors. */
+	void open(const std::string& path);
+
+	/* Upper bounds of what build produces, to size upload buffers. */
+	size_t get_MaxVerticesQty() const;
+	size_t get_MaxIndicesQty() const;
+	/* OBJ parts always do, glTF ones when no primitive is larger. */
+	bool fits_16bit_indices() const;
+	const float* get_BoundsMin() const { return bounds_min; }
+	const float* get_BoundsMax() const { return bounds_max; }
+
+	/* glTF primitives become one part each, whatever their size. */
+	void build(const part_sink& sink);
+
+	statistics get_Statistics() const { return stats; }
+
+	/* Writes an OBJ of about triangles_qty triangles and imports it on a   */
+	/* one worker pool, then on pool. The caller takes chunks too, so the   */
+	/* first run is on two threads.                                         */
+	static void benchmark(std::ostream& out, Z_ThreadPool& pool, size_t triangles_qty);
+private:
+	struct obj_model;
+	struct gltf_model;
+
+	void open_Obj(const std::string& path);
+	void open_Gltf(const std::string& path);
+	void build_Obj(const part_sink& sink);
+	void build_Gltf(const part_sink& sink);
+
+	Z_VertexQuantizer::source_layout layout;
+	Z_ThreadPool& pool;
+	std::unique_ptr<obj_model> obj;
+	std::unique_ptr<gltf_model> gltf;
+	float bounds_min[3];
+	float bounds_max[3];
+	statistics stats{};
+};
+
+#endif // !Z_MeshImporter_h
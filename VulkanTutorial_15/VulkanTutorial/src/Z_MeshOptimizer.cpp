@@ -0,0 +1,503 @@
+/* Z_MeshOptimizer.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_MeshOptimizer.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <chrono>
+#include <iomanip>
+#include <cstring>
+#include <cmath>
+
+namespace
+{
+	struct float3
+	{
+		float x, y, z;
+	};
+
+	float3 operator-(const float3& a, const float3& b) { return float3{ a.x - b.x, a.y - b.y, a.z - b.z }; }
+	float3 operator+(const float3& a, const float3& b) { return float3{ a.x + b.x, a.y + b.y, a.z + b.z }; }
+	float3 operator*(const float3& a, float s) { return float3{ a.x * s, a.y * s, a.z * s }; }
+	float dot(const float3& a, const float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+	float3 cross(const float3& a, const float3& b)
+	{
+		return float3{ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+	}
+
+	/* Post-transform cache as a FIFO of timestamps: a vertex is cached */
+	/* while fewer than cache_size vertices were inserted after it.     */
+	struct fifo_cache
+	{
+		fifo_cache(size_t vertices_qty, uint32_t cache_size)
+			: timestamps(vertices_qty, 0)
+			, time(cache_size + 1)
+			, cache_size(cache_size)
+		{
+		}
+
+		/* Returns true on a miss. */
+		bool access(uint32_t v)
+		{
+			if (time - timestamps[v] > cache_size)
+			{
+				timestamps[v] = time++;
+				return true;
+			}
+			return false;
+		}
+
+		std::vector<uint32_t> timestamps;
+		uint32_t time;
+		uint32_t cache_size;
+	};
+}
+
+const Z_MeshOptimizer::options Z_MeshOptimizer::default_options = { 16, true, 0, 1.05f };
+
+size_t Z_MeshOptimizer::count_Misses(const std::vector<uint32_t>& indices, size_t vertices_qty, uint32_t cache_size)
+{
+	fifo_cache cache(vertices_qty, cache_size);
+	size_t misses = 0;
+	for (auto i : indices)
+	{
+		misses += cache.access(i) ? 1 : 0;
+	}
+	return misses;
+}
+
+Z_MeshOptimizer::statistics Z_MeshOptimizer::analyze(const Z_IndexedMesh& mesh, uint32_t cache_size)
+{
+	statistics s{};
+	const auto& indices = mesh.get_Indices();
+	if (!indices.size())
+	{
+		return s;
+	}
+
+	std::vector<bool> used(mesh.get_VerticesQty(), false);
+	size_t unique_qty = 0;
+	for (auto i : indices)
+	{
+		if (!used[i])
+		{
+			used[i] = true;
+			++unique_qty;
+		}
+	}
+
+	const double misses = static_cast<double>(count_Misses(indices, mesh.get_VerticesQty(), cache_size));
+	s.acmr = misses / (indices.size() / 3);
+	s.atvr = misses / unique_qty;
+	return s;
+}
+
+void Z_MeshOptimizer::optimize(Z_IndexedMesh& mesh, const options& opts)
+{
+	optimize_VertexCache(mesh.indices, mesh.get_VerticesQty(), opts.cache_size);
+	if (opts.optimize_overdraw)
+	{
+		optimize_Overdraw(mesh.indices, mesh, opts);
+	}
+	optimize_VertexFetch(mesh);
+}
+
+void Z_MeshOptimizer::optimize(std::vector<Z_IndexedMesh>& meshes, Z_ThreadPool& pool, const options& opts)
+{
+	pool.parallel_for(meshes.size(), 1, [&](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			optimize(meshes[i], opts);
+		}
+	});
+}
+
+/* Tipsify, Sander, Nehab and Barczak, "Fast Triangle Reordering for Vertex  */
+/* Locality and Reduced Overdraw": emits all triangles around a fanning      */
+/* vertex, then moves to the neighbour that stays longest in the cache.      */
+void Z_MeshOptimizer::optimize_VertexCache(std::vector<uint32_t>& indices, size_t vertices_qty, uint32_t cache_size)
+{
+	const size_t triangles_qty = indices.size() / 3;
+	if (triangles_qty < 2)
+	{
+		return;
+	}
+
+	// Triangles adjacent to every vertex, rows of offsets..offsets + 1.
+	std::vector<uint32_t> offsets(vertices_qty + 1, 0);
+	for (auto i : indices)
+	{
+		++offsets[i + 1];
+	}
+	for (size_t v = 0; v < vertices_qty; ++v)
+	{
+		offsets[v + 1] += offsets[v];
+	}
+	std::vector<uint32_t> adjacency(indices.size());
+	std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+	for (size_t t = 0; t < triangles_qty; ++t)
+	{
+		for (size_t k = 0; k < 3; ++k)
+		{
+			adjacency[fill[indices[3 * t + k]]++] = static_cast<uint32_t>(t);
+		}
+	}
+
+	// Triangles not emitted yet around every vertex.
+	std::vector<uint32_t> live(vertices_qty);
+	for (size_t v = 0; v < vertices_qty; ++v)
+	{
+		live[v] = offsets[v + 1] - offsets[v];
+	}
+
+	std::vector<uint32_t> cache_time(vertices_qty, 0);
+	std::vector<bool> emitted(triangles_qty, false);
+	std::vector<uint32_t> dead_end;
+	std::vector<uint32_t> candidates;
+	std::vector<uint32_t> result;
+	dead_end.reserve(indices.size());
+	result.reserve(indices.size());
+
+	uint32_t time = cache_size + 1;
+	size_t cursor = 0;
+
+	auto skip_dead_end = [&]() -> int64_t
+	{
+		while (dead_end.size())
+		{
+			uint32_t v = dead_end.back();
+			dead_end.pop_back();
+			if (live[v])
+			{
+				return v;
+			}
+		}
+		for (; cursor < vertices_qty; ++cursor)
+		{
+			if (live[cursor])
+			{
+				return static_cast<int64_t>(cursor);
+			}
+		}
+		return -1;
+	};
+
+	int64_t fanning = skip_dead_end();
+	while (fanning >= 0)
+	{
+		candidates.clear();
+		const uint32_t f = static_cast<uint32_t>(fanning);
+		for (uint32_t a = offsets[f]; a < offsets[f + 1]; ++a)
+		{
+			const uint32_t t = adjacency[a];
+			if (emitted[t])
+			{
+				continue;
+			}
+			emitted[t] = true;
+			for (size_t k = 0; k < 3; ++k)
+			{
+				const uint32_t v = indices[3 * t + k];
+				result.push_back(v);
+				dead_end.push_back(v);
+				candidates.push_back(v);
+				--live[v];
+				if (time - cache_time[v] > cache_size)
+				{
+					cache_time[v] = time++;
+				}
+			}
+		}
+
+		// The next fanning vertex is the candidate that stays in the cache
+		// longest after its remaining triangles are emitted.
+		fanning = -1;
+		int64_t best_priority = -1;
+		for (auto v : candidates)
+		{
+			if (!live[v])
+			{
+				continue;
+			}
+			int64_t priority = 0;
+			if (time - cache_time[v] + 2 * live[v] <= cache_size)
+			{
+				priority = time - cache_time[v];
+			}
+			if (priority > best_priority)
+			{
+				best_priority = priority;
+				fanning = v;
+			}
+		}
+		if (fanning < 0)
+		{
+			fanning = skip_dead_end();
+		}
+	}
+
+	indices.swap(result);
+}
+
+/* Splits the cache-ordered triangles into clusters where the simulated cache */
+/* misses a whole triangle, and draws first the clusters facing away from the */
+/* mesh centre, as they most likely occlude the rest.                         */
+void Z_MeshOptimizer::optimize_Overdraw(std::vector<uint32_t>& indices, const Z_IndexedMesh& mesh, const options& opts)
+{
+	const size_t triangles_qty = indices.size() / 3;
+	if (triangles_qty < 2 || mesh.get_VertexStride() < opts.position_offset + sizeof(float3))
+	{
+		return;
+	}
+
+	auto position = [&](uint32_t v)
+	{
+		float3 p;
+		std::memcpy(&p, mesh.vertices.data() + v * mesh.get_VertexStride() + opts.position_offset, sizeof(p));
+		return p;
+	};
+
+	struct cluster
+	{
+		size_t first_triangle;
+		size_t triangles_qty;
+		float3 centroid;
+		float3 normal;
+		float area;
+		float sort_key;
+	};
+	std::vector<cluster> clusters;
+
+	fifo_cache cache(mesh.get_VerticesQty(), opts.cache_size);
+	for (size_t t = 0; t < triangles_qty; ++t)
+	{
+		size_t misses = 0;
+		for (size_t k = 0; k < 3; ++k)
+		{
+			misses += cache.access(indices[3 * t + k]) ? 1 : 0;
+		}
+		if (!t || 3 == misses)
+		{
+			clusters.push_back(cluster{ t, 0, float3{ 0, 0, 0 }, float3{ 0, 0, 0 }, 0.0f, 0.0f });
+		}
+		++clusters.back().triangles_qty;
+	}
+	if (clusters.size() < 2)
+	{
+		return;
+	}
+
+	// Area weighted centroids, the normal is the sum of doubled-area normals.
+	float3 mesh_centroid{ 0, 0, 0 };
+	float mesh_area = 0.0f;
+	for (auto& c : clusters)
+	{
+		for (size_t t = c.first_triangle; t < c.first_triangle + c.triangles_qty; ++t)
+		{
+			const float3 a = position(indices[3 * t]);
+			const float3 b = position(indices[3 * t + 1]);
+			const float3 d = position(indices[3 * t + 2]);
+			const float3 n = cross(b - a, d - a);
+			const float area = std::sqrt(dot(n, n));
+			c.normal = c.normal + n;
+			c.centroid = c.centroid + (a + b + d) * (area / 3.0f);
+			c.area += area;
+		}
+		mesh_centroid = mesh_centroid + c.centroid;
+		mesh_area += c.area;
+		if (c.area > 0.0f)
+		{
+			c.centroid = c.centroid * (1.0f / c.area);
+		}
+	}
+	if (mesh_area > 0.0f)
+	{
+		mesh_centroid = mesh_centroid * (1.0f / mesh_area);
+	}
+
+	for (auto& c : clusters)
+	{
+		const float length = std::sqrt(dot(c.normal, c.normal));
+		c.sort_key = length > 0.0f ? dot(c.centroid - mesh_centroid, c.normal) / length : 0.0f;
+	}
+	std::stable_sort(clusters.begin(), clusters.end(), [](const cluster& a, const cluster& b)
+	{
+		return a.sort_key > b.sort_key;
+	});
+
+	std::vector<uint32_t> sorted;
+	sorted.reserve(indices.size());
+	for (auto& c : clusters)
+	{
+		sorted.insert(sorted.end(), indices.begin() + 3 * c.first_triangle,
+			indices.begin() + 3 * (c.first_triangle + c.triangles_qty));
+	}
+
+	// Keeps the cache order when the clusters cost too many extra misses.
+	const size_t before = count_Misses(indices, mesh.get_VerticesQty(), opts.cache_size);
+	const size_t after = count_Misses(sorted, mesh.get_VerticesQty(), opts.cache_size);
+	if (after <= before * opts.overdraw_threshold)
+	{
+		indices.swap(sorted);
+	}
+}
+
+void Z_MeshOptimizer::optimize_VertexFetch(Z_IndexedMesh& mesh)
+{
+	const uint32_t stride = mesh.get_VertexStride();
+	const uint32_t unused = ~0u;
+	std::vector<uint32_t> remap(mesh.get_VerticesQty(), unused);
+	std::vector<uint8_t> vertices;
+	vertices.reserve(mesh.vertices.size());
+
+	uint32_t next = 0;
+	for (auto& i : mesh.indices)
+	{
+		if (unused == remap[i])
+		{
+			remap[i] = next++;
+			vertices.insert(vertices.end(), mesh.vertices.begin() + i * stride, mesh.vertices.begin() + (i + 1) * stride);
+		}
+		i = remap[i];
+	}
+
+	mesh.vertices.swap(vertices);
+}
+
+namespace
+{
+	/* UV sphere of float4 positions with its triangles in random order. */
+	Z_IndexedMesh make_ShuffledSphere(uint32_t segments, std::mt19937& random)
+	{
+		const uint32_t rings = segments / 2;
+		const float pi = 3.14159265358979f;
+		std::vector<float> positions;
+		for (uint32_t r = 0; r <= rings; ++r)
+		{
+			const float theta = pi * r / rings;
+			for (uint32_t s = 0; s <= segments; ++s)
+			{
+				const float phi = 2.0f * pi * s / segments;
+				positions.push_back(std::sin(theta) * std::cos(phi));
+				positions.push_back(std::cos(theta));
+				positions.push_back(std::sin(theta) * std::sin(phi));
+				positions.push_back(1.0f);
+			}
+		}
+
+		std::vector<uint32_t> triangles;
+		for (uint32_t r = 0; r < rings; ++r)
+		{
+			for (uint32_t s = 0; s < segments; ++s)
+			{
+				const uint32_t a = r * (segments + 1) + s;
+				const uint32_t b = a + segments + 1;
+				triangles.push_back(a);
+				triangles.push_back(b);
+				triangles.push_back(a + 1);
+				triangles.push_back(a + 1);
+				triangles.push_back(b);
+				triangles.push_back(b + 1);
+			}
+		}
+
+		std::vector<uint32_t> order(triangles.size() / 3);
+		std::iota(order.begin(), order.end(), 0);
+		std::shuffle(order.begin(), order.end(), random);
+		std::vector<uint32_t> indices;
+		indices.reserve(triangles.size());
+		for (auto t : order)
+		{
+			indices.insert(indices.end(), triangles.begin() + 3 * t, triangles.begin() + 3 * t + 3);
+		}
+
+		std::vector<uint8_t> vertices(positions.size() * sizeof(float));
+		std::memcpy(vertices.data(), positions.data(), vertices.size());
+		return Z_IndexedMesh(std::move(vertices), 4 * sizeof(float), std::move(indices));
+	}
+}
+
+void Z_MeshOptimizer::benchmark(std::ostream& out, Z_ThreadPool& pool, size_t meshes_qty)
+{
+	typedef std::chrono::high_resolution_clock clock;
+	auto milliseconds = [](clock::duration d)
+	{
+		return std::chrono::duration<double, std::milli>(d).count();
+	};
+
+	std::mt19937 random(2016);
+	std::vector<Z_IndexedMesh> meshes;
+	size_t triangles_qty = 0;
+	for (size_t i = 0; i < meshes_qty; ++i)
+	{
+		meshes.push_back(make_ShuffledSphere(32 + static_cast<uint32_t>(i % 8) * 32, random));
+		triangles_qty += meshes.back().get_IndicesQty() / 3;
+	}
+
+	// Triangle weighted averages over all meshes.
+	auto measure = [&](const std::vector<Z_IndexedMesh>& ms)
+	{
+		statistics total{};
+		for (auto& m : ms)
+		{
+			statistics s = analyze(m, default_options.cache_size);
+			const double weight = static_cast<double>(m.get_IndicesQty() / 3) / triangles_qty;
+			total.acmr += s.acmr * weight;
+			total.atvr += s.atvr * weight;
+		}
+		return total;
+	};
+
+	const statistics before = measure(meshes);
+
+	std::vector<Z_IndexedMesh> serial_meshes = meshes;
+	auto start = clock::now();
+	for (auto& m : serial_meshes)
+	{
+		optimize(m);
+	}
+	const double serial_ms = milliseconds(clock::now() - start);
+
+	start = clock::now();
+	optimize(meshes, pool);
+	const double parallel_ms = milliseconds(clock::now() - start);
+
+	const statistics after = measure(meshes);
+
+	out << "Mesh optimization of " << meshes_qty << " meshes, " << triangles_qty << " triangles, "
+		<< default_options.cache_size << "-entry FIFO cache:\n";
+	out << std::fixed << std::setprecision(3);
+	out << "    ACMR:              " << before.acmr << " -> " << after.acmr << "\n";
+	out << "    ATVR:              " << before.atvr << " -> " << after.atvr << "\n";
+	out << std::setprecision(1);
+	out << "    1 thread:          " << serial_ms << " ms\n";
+	out << "    " << pool.size() + 1 << " threads:         " << parallel_ms << " ms\n";
+}
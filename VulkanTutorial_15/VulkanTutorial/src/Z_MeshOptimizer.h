@@ -0,0 +1,81 @@
+/* Z_MeshOptimizer.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_MeshOptimizer_h
+#define Z_MeshOptimizer_h
+
+#include <vector>
+#include <cstdint>
+#include <ostream>
+
+#include "Z_IndexedMesh.h"
+#include "Z_ThreadPool.h"
+
+/* Load-time reordering of indexed triangle meshes:                       */
+/*  - triangles for the post-transform vertex cache (Tipsify),            */
+/*  - optionally clusters of them so outward facing ones are drawn first, */
+/*  - vertices in the order of their first use, for vertex fetch.         */
+/* Statistics are measured on a simulated FIFO cache:                     */
+/* ACMR = cache misses per triangle, ATVR = misses per unique vertex.     */
+class Z_MeshOptimizer
+{
+public:
+	struct options
+	{
+		uint32_t cache_size;
+		bool optimize_overdraw;
+		/* Offset of the float x, y, z position inside a vertex. */
+		uint32_t position_offset;
+		/* The overdraw sort may raise ACMR by this factor at most. */
+		float overdraw_threshold;
+	};
+	static const options default_options;
+
+	struct statistics
+	{
+		double acmr;
+		double atvr;
+	};
+
+	static statistics analyze(const Z_IndexedMesh& mesh, uint32_t cache_size);
+
+	static void optimize(Z_IndexedMesh& mesh, const options& opts = default_options);
+	/* Meshes are independent, so they are optimized in parallel. */
+	static void optimize(std::vector<Z_IndexedMesh>& meshes, Z_ThreadPool& pool, const options& opts = default_options);
+
+	static void optimize_VertexCache(std::vector<uint32_t>& indices, size_t vertices_qty, uint32_t cache_size);
+	static void optimize_Overdraw(std::vector<uint32_t>& indices, const Z_IndexedMesh& mesh, const options& opts);
+	static void optimize_VertexFetch(Z_IndexedMesh& mesh);
+
+	static void benchmark(std::ostream& out, Z_ThreadPool& pool, size_t meshes_qty);
+private:
+	static size_t count_Misses(const std::vector<uint32_t>& indices, size_t vertices_qty, uint32_t cache_size);
+};
+
+#endif // !Z_MeshOptimizer_h
@@ -0,0 +1,540 @@
+/* Z_MeshSimplifier.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_MeshSimplifier.h"
+#include <stdexcept>
+#include <algorithm>
+#include <unordered_map>
+#include <chrono>
+#include <iomanip>
+#include <cstring>
+#include <cmath>
+
+#include "Z_MeshOptimizer.h"
+
+namespace
+{
+	uint64_t edge_key(uint32_t a, uint32_t b)
+	{
+		return static_cast<uint64_t>(a) << 32 | b;
+	}
+
+	bool has_vertex(const uint32_t* triangle, uint32_t v)
+	{
+		return triangle[0] == v || triangle[1] == v || triangle[2] == v;
+	}
+
+	void cross(const float* p0, const float* p1, const float* p2, double* n)
+	{
+		const double u[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+		const double v[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+		n[0] = u[1] * v[2] - u[2] * v[1];
+		n[1] = u[2] * v[0] - u[0] * v[2];
+		n[2] = u[0] * v[1] - u[1] * v[0];
+	}
+
+	double dot(const double* a, const double* b)
+	{
+		return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+	}
+
+	/* A closed surface without borders, so every vertex may collapse. */
+	Z_IndexedMesh make_Torus(uint32_t segments, uint32_t rings)
+	{
+		const float pi = 3.14159265358979f;
+		std::vector<float> positions;
+		for (uint32_t r = 0; r < rings; ++r)
+		{
+			const float theta = 2.0f * pi * r / rings;
+			for (uint32_t s = 0; s < segments; ++s)
+			{
+				const float phi = 2.0f * pi * s / segments;
+				const float radius = 1.0f + 0.4f * std::cos(theta);
+				positions.push_back(radius * std::cos(phi));
+				positions.push_back(0.4f * std::sin(theta));
+				positions.push_back(radius * std::sin(phi));
+			}
+		}
+
+		std::vector<uint32_t> indices;
+		for (uint32_t r = 0; r < rings; ++r)
+		{
+			for (uint32_t s = 0; s < segments; ++s)
+			{
+				const uint32_t a = r * segments + s;
+				const uint32_t b = (r + 1) % rings * segments + s;
+				const uint32_t c = r * segments + (s + 1) % segments;
+				const uint32_t d = (r + 1) % rings * segments + (s + 1) % segments;
+				const uint32_t quad[6] = { a, b, c, c, b, d };
+				indices.insert(indices.end(), quad, quad + 6);
+			}
+		}
+
+		std::vector<uint8_t> vertices(positions.size() * sizeof(float));
+		std::memcpy(vertices.data(), positions.data(), vertices.size());
+		return Z_IndexedMesh(std::move(vertices), 3 * sizeof(float), std::move(indices));
+	}
+}
+
+void Z_MeshSimplifier::quadric::add_Plane(const double* n, double d, double w)
+{
+	a00 += w * n[0] * n[0];
+	a01 += w * n[0] * n[1];
+	a02 += w * n[0] * n[2];
+	a11 += w * n[1] * n[1];
+	a12 += w * n[1] * n[2];
+	a22 += w * n[2] * n[2];
+	b0 += w * n[0] * d;
+	b1 += w * n[1] * d;
+	b2 += w * n[2] * d;
+	c += w * d * d;
+	weight += w;
+}
+
+void Z_MeshSimplifier::quadric::add(const quadric& q)
+{
+	a00 += q.a00;
+	a01 += q.a01;
+	a02 += q.a02;
+	a11 += q.a11;
+	a12 += q.a12;
+	a22 += q.a22;
+	b0 += q.b0;
+	b1 += q.b1;
+	b2 += q.b2;
+	c += q.c;
+	weight += q.weight;
+}
+
+double Z_MeshSimplifier::quadric::error(const float* p) const
+{
+	if (weight <= 0.0)
+	{
+		return 0.0;
+	}
+	const double x = p[0];
+	const double y = p[1];
+	const double z = p[2];
+	const double e = a00 * x * x + a11 * y * y + a22 * z * z
+		+ 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z)
+		+ 2.0 * (b0 * x + b1 * y + b2 * z) + c;
+	return std::max(e, 0.0) / weight;
+}
+
+Z_MeshSimplifier::Z_MeshSimplifier(const Z_IndexedMesh& mesh, uint32_t position_offset)
+	: indices(mesh.get_Indices())
+{
+	const uint32_t stride = mesh.get_VertexStride();
+	if (position_offset + 3 * sizeof(float) > stride)
+	{
+		throw std::domain_error{ "Mesh vertices have no position to simplify by" };
+	}
+
+	const size_t vertices_qty = mesh.get_VerticesQty();
+	positions.resize(3 * vertices_qty);
+	const uint8_t* vertices = mesh.get_Vertices().data();
+	for (size_t v = 0; v < vertices_qty; ++v)
+	{
+		std::memcpy(&positions[3 * v], vertices + v * stride + position_offset, 3 * sizeof(float));
+	}
+
+	const size_t triangles_qty = indices.size() / 3;
+	indices.resize(3 * triangles_qty);
+	triangle_alive.assign(triangles_qty, 1);
+	alive_triangles = triangles_qty;
+	quadrics.assign(vertices_qty, quadric{});
+	locked.assign(vertices_qty, 0);
+	removed.assign(vertices_qty, 0);
+	stamps.assign(vertices_qty, 0);
+	vertex_triangles.resize(vertices_qty);
+
+	// Area weighted planes of the triangles around every vertex.
+	std::unordered_map<uint64_t, uint32_t> edges;
+	edges.reserve(indices.size());
+	for (uint32_t t = 0; t < triangles_qty; ++t)
+	{
+		const uint32_t* tri = &indices[3 * t];
+		if (tri[0] == tri[1] || tri[1] == tri[2] || tri[0] == tri[2])
+		{
+			triangle_alive[t] = 0;
+			--alive_triangles;
+			continue;
+		}
+
+		double n[3];
+		cross(position(tri[0]), position(tri[1]), position(tri[2]), n);
+		const double length = std::sqrt(dot(n, n));
+		if (length > 0.0)
+		{
+			for (auto& x : n)
+			{
+				x /= length;
+			}
+		}
+		const float* p0 = position(tri[0]);
+		const double d = -(n[0] * p0[0] + n[1] * p0[1] + n[2] * p0[2]);
+		for (size_t k = 0; k < 3; ++k)
+		{
+			quadrics[tri[k]].add_Plane(n, d, 0.5 * length);
+			vertex_triangles[tri[k]].push_back(t);
+			++edges[edge_key(tri[k], tri[(k + 1) % 3])];
+		}
+	}
+
+	// A directed edge without exactly one reverse is on a border or
+	// non-manifold, its vertices stay where they are.
+	for (uint32_t t = 0; t < triangles_qty; ++t)
+	{
+		if (!triangle_alive[t])
+		{
+			continue;
+		}
+		const uint32_t* tri = &indices[3 * t];
+		for (size_t k = 0; k < 3; ++k)
+		{
+			const uint32_t a = tri[k];
+			const uint32_t b = tri[(k + 1) % 3];
+			const auto reverse = edges.find(edge_key(b, a));
+			if (1 != edges[edge_key(a, b)] || edges.end() == reverse || 1 != reverse->second)
+			{
+				locked[a] = 1;
+				locked[b] = 1;
+			}
+		}
+	}
+
+	// Interior edges are in two triangles, once in each direction.
+	for (uint32_t t = 0; t < triangles_qty; ++t)
+	{
+		if (!triangle_alive[t])
+		{
+			continue;
+		}
+		const uint32_t* tri = &indices[3 * t];
+		for (size_t k = 0; k < 3; ++k)
+		{
+			if (tri[k] < tri[(k + 1) % 3])
+			{
+				push_Edge(tri[k], tri[(k + 1) % 3]);
+			}
+		}
+	}
+}
+
+double Z_MeshSimplifier::collapse_Cost(uint32_t from, uint32_t to) const
+{
+	quadric q = quadrics[from];
+	q.add(quadrics[to]);
+	return q.error(position(to));
+}
+
+void Z_MeshSimplifier::push_Edge(uint32_t a, uint32_t b)
+{
+	if (locked[a] && locked[b])
+	{
+		return;
+	}
+
+	candidate c{ 0.0, a, b, stamps[a], stamps[b] };
+	if (locked[a])
+	{
+		std::swap(c.from, c.to);
+		std::swap(c.from_stamp, c.to_stamp);
+		c.cost = collapse_Cost(b, a);
+	}
+	else
+	{
+		c.cost = collapse_Cost(a, b);
+		if (!locked[b])
+		{
+			const double reverse = collapse_Cost(b, a);
+			if (reverse < c.cost)
+			{
+				c = candidate{ reverse, b, a, stamps[b], stamps[a] };
+			}
+		}
+	}
+	heap.push_back(c);
+	std::push_heap(heap.begin(), heap.end());
+}
+
+bool Z_MeshSimplifier::can_Collapse(uint32_t from, uint32_t to)
+{
+	from_neighbours.clear();
+	to_neighbours.clear();
+
+	size_t shared = 0;
+	for (auto t : vertex_triangles[from])
+	{
+		const uint32_t* tri = &indices[3 * t];
+		if (!triangle_alive[t] || !has_vertex(tri, from))
+		{
+			continue;
+		}
+		for (size_t k = 0; k < 3; ++k)
+		{
+			if (tri[k] != from && tri[k] != to)
+			{
+				from_neighbours.push_back(tri[k]);
+			}
+		}
+		if (has_vertex(tri, to))
+		{
+			++shared;
+			continue;
+		}
+
+		// The triangle must keep facing the same way, and not become a sliver.
+		const float* p[3];
+		for (size_t k = 0; k < 3; ++k)
+		{
+			p[k] = position(tri[k]);
+		}
+		double before[3];
+		cross(p[0], p[1], p[2], before);
+		for (size_t k = 0; k < 3; ++k)
+		{
+			if (tri[k] == from)
+			{
+				p[k] = position(to);
+			}
+		}
+		double after[3];
+		cross(p[0], p[1], p[2], after);
+		const double d = dot(before, after);
+		if (dot(before, before) > 0.0 && (d <= 0.0 || d * d < 0.0625 * dot(before, before) * dot(after, after)))
+		{
+			return false;
+		}
+	}
+	if (!shared)
+	{
+		return false;
+	}
+
+	// Link condition: the two vertices have in common only the
+	// opposite vertices of their shared triangles, else the surface
+	// would pinch into a non-manifold edge.
+	for (auto t : vertex_triangles[to])
+	{
+		const uint32_t* tri = &indices[3 * t];
+		if (!triangle_alive[t] || !has_vertex(tri, to))
+		{
+			continue;
+		}
+		for (size_t k = 0; k < 3; ++k)
+		{
+			if (tri[k] != from && tri[k] != to)
+			{
+				to_neighbours.push_back(tri[k]);
+			}
+		}
+	}
+	for (auto* list : { &from_neighbours, &to_neighbours })
+	{
+		std::sort(list->begin(), list->end());
+		list->erase(std::unique(list->begin(), list->end()), list->end());
+	}
+	size_t common = 0;
+	for (auto v : from_neighbours)
+	{
+		common += std::binary_search(to_neighbours.begin(), to_neighbours.end(), v) ? 1 : 0;
+	}
+	return common == shared;
+}
+
+void Z_MeshSimplifier::collapse(uint32_t from, uint32_t to)
+{
+	std::vector<uint32_t>& around = vertex_triangles[to];
+	for (auto t : vertex_triangles[from])
+	{
+		uint32_t* tri = &indices[3 * t];
+		if (!triangle_alive[t] || !has_vertex(tri, from))
+		{
+			continue;
+		}
+		if (has_vertex(tri, to))
+		{
+			triangle_alive[t] = 0;
+			--alive_triangles;
+			continue;
+		}
+		for (size_t k = 0; k < 3; ++k)
+		{
+			if (tri[k] == from)
+			{
+				tri[k] = to;
+			}
+		}
+		around.push_back(t);
+	}
+	std::vector<uint32_t>().swap(vertex_triangles[from]);
+
+	// Drops the dead and stale triangles of the target while at it.
+	around.erase(std::remove_if(around.begin(), around.end(), [&](uint32_t t)
+	{
+		return !triangle_alive[t] || !has_vertex(&indices[3 * t], to);
+	}), around.end());
+	std::sort(around.begin(), around.end());
+	around.erase(std::unique(around.begin(), around.end()), around.end());
+
+	quadrics[to].add(quadrics[from]);
+	removed[from] = 1;
+	++stamps[to];
+
+	// The edges around the target are weighed with its new quadric.
+	to_neighbours.clear();
+	for (auto t : around)
+	{
+		const uint32_t* tri = &indices[3 * t];
+		for (size_t k = 0; k < 3; ++k)
+		{
+			if (tri[k] != to)
+			{
+				to_neighbours.push_back(tri[k]);
+			}
+		}
+	}
+	std::sort(to_neighbours.begin(), to_neighbours.end());
+	to_neighbours.erase(std::unique(to_neighbours.begin(), to_neighbours.end()), to_neighbours.end());
+	for (auto v : to_neighbours)
+	{
+		push_Edge(to, v);
+	}
+}
+
+Z_MeshSimplifier::level Z_MeshSimplifier::simplify(size_t target_triangles)
+{
+	while (alive_triangles > target_triangles && !heap.empty())
+	{
+		std::pop_heap(heap.begin(), heap.end());
+		const candidate c = heap.back();
+		heap.pop_back();
+
+		if (removed[c.from] || removed[c.to])
+		{
+			continue;
+		}
+		if (c.from_stamp != stamps[c.from] || c.to_stamp != stamps[c.to])
+		{
+			// A quadric changed since it was weighed.
+			push_Edge(c.from, c.to);
+			continue;
+		}
+		if (!can_Collapse(c.from, c.to))
+		{
+			continue;
+		}
+
+		collapse(c.from, c.to);
+		max_cost = std::max(max_cost, c.cost);
+	}
+
+	level result;
+	result.indices.reserve(3 * alive_triangles);
+	for (size_t t = 0; t < triangle_alive.size(); ++t)
+	{
+		if (triangle_alive[t])
+		{
+			result.indices.insert(result.indices.end(), &indices[3 * t], &indices[3 * t] + 3);
+		}
+	}
+	result.error = static_cast<float>(std::sqrt(max_cost));
+	return result;
+}
+
+std::vector<Z_MeshSimplifier::level> Z_MeshSimplifier::generate_Lods(const Z_IndexedMesh& mesh, uint32_t position_offset,
+	size_t levels_qty, float ratio)
+{
+	std::vector<level> levels;
+	if (!levels_qty)
+	{
+		return levels;
+	}
+	Z_MeshSimplifier simplifier(mesh, position_offset);
+	size_t triangles = simplifier.get_TrianglesQty();
+	for (size_t i = 0; i < levels_qty; ++i)
+	{
+		const size_t target = static_cast<size_t>(triangles * ratio);
+		if (!target)
+		{
+			break;
+		}
+
+		level lod = simplifier.simplify(target);
+		const size_t reached = lod.indices.size() / 3;
+		// A level stuck closer to the previous one than to its target
+		// is not worth its indices.
+		if (reached > target && reached - target > (triangles - target) / 2)
+		{
+			break;
+		}
+
+		triangles = reached;
+		Z_MeshOptimizer::optimize_VertexCache(lod.indices, mesh.get_VerticesQty(), Z_MeshOptimizer::default_options.cache_size);
+		levels.push_back(std::move(lod));
+	}
+	return levels;
+}
+
+void Z_MeshSimplifier::benchmark(std::ostream& out, size_t triangles_qty)
+{
+	typedef std::chrono::high_resolution_clock clock;
+
+	const uint32_t rings = std::max(static_cast<uint32_t>(std::sqrt(triangles_qty / 4.0)), 3u);
+	const Z_IndexedMesh torus = make_Torus(2 * rings, rings);
+
+	const auto flags = out.flags();
+	const auto precision = out.precision();
+	out << "Simplification of a torus of " << torus.get_IndicesQty() / 3 << " triangles, major radius 1:\n";
+
+	auto start = clock::now();
+	Z_MeshSimplifier simplifier(torus, 0);
+	double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+	out << std::fixed << std::setprecision(1);
+	out << "    quadrics and edges: " << std::setw(8) << ms << " ms\n";
+
+	size_t triangles = simplifier.get_TrianglesQty();
+	for (size_t i = 1; triangles > 64; ++i)
+	{
+		start = clock::now();
+		const level lod = simplifier.simplify(triangles / 2);
+		ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+		if (lod.indices.size() / 3 == triangles)
+		{
+			break;
+		}
+		triangles = lod.indices.size() / 3;
+		out << "    level " << std::setw(2) << i << ": " << std::setw(10) << triangles << " triangles, error "
+			<< std::setprecision(5) << lod.error << std::setprecision(1) << ", " << std::setw(8) << ms << " ms\n";
+	}
+
+	out.flags(flags);
+	out.precision(precision);
+}
@@ -0,0 +1,125 @@
+/* Z_MeshSimplifier.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_MeshSimplifier_h
+#define Z_MeshSimplifier_h
+
+#include <vector>
+#include <cstdint>
+#include <ostream>
+
+#include "Z_IndexedMesh.h"
+
+/* Quadric error edge collapse (Garland & Heckbert). A vertex collapses   */
+/* onto a neighbour, so every level of detail indexes the vertices of the */
+/* original mesh and adds only indices. Vertices of open borders, which   */
+/* include attribute seams and the cuts between mesh parts, never move;   */
+/* collapses which would flip a triangle or pinch the surface are skipped.*/
+/* The error of a level is the largest root mean square distance, in     */
+/* position units, of a collapsed vertex from its original planes.        */
+class Z_MeshSimplifier
+{
+public:
+	struct level
+	{
+		std::vector<uint32_t> indices;
+		float error;
+	};
+
+	/* Offset of the float x, y, z position inside a vertex. */
+	Z_MeshSimplifier(const Z_IndexedMesh& mesh, uint32_t position_offset);
+
+	Z_MeshSimplifier(const Z_MeshSimplifier&) = delete;
+	Z_MeshSimplifier& operator=(const Z_MeshSimplifier&) = delete;
+
+	/* Collapses edges until at most target_triangles are left or no     */
+	/* collapse is possible. Calls continue from the previous level.     */
+	level simplify(size_t target_triangles);
+	size_t get_TrianglesQty() const { return alive_triangles; }
+
+	/* Up to levels_qty levels, each of about ratio times the triangles of */
+	/* the previous one, in vertex cache order. Stops at the first level   */
+	/* which cannot get that far.                                          */
+	static std::vector<level> generate_Lods(const Z_IndexedMesh& mesh, uint32_t position_offset,
+		size_t levels_qty, float ratio = 0.5f);
+
+	/* Simplifies a torus of about triangles_qty triangles level by level. */
+	static void benchmark(std::ostream& out, size_t triangles_qty);
+private:
+	/* Sum of weight * (n.p + d)^2 over planes, with its total weight. */
+	struct quadric
+	{
+		double a00, a01, a02, a11, a12, a22;
+		double b0, b1, b2;
+		double c;
+		double weight;
+
+		void add_Plane(const double* n, double d, double w);
+		void add(const quadric& q);
+		/* Mean squared distance of p from the planes. */
+		double error(const float* p) const;
+	};
+
+	struct candidate
+	{
+		double cost;
+		uint32_t from;
+		uint32_t to;
+		uint32_t from_stamp;
+		uint32_t to_stamp;
+
+		/* The heap keeps the cheapest collapse on top. */
+		bool operator<(const candidate& other) const { return cost > other.cost; }
+	};
+
+	const float* position(uint32_t v) const { return &positions[3 * v]; }
+	double collapse_Cost(uint32_t from, uint32_t to) const;
+	void push_Edge(uint32_t a, uint32_t b);
+	bool can_Collapse(uint32_t from, uint32_t to);
+	void collapse(uint32_t from, uint32_t to);
+
+	std::vector<float> positions;
+	std::vector<uint32_t> indices;
+	std::vector<uint8_t> triangle_alive;
+	size_t alive_triangles{};
+	std::vector<quadric> quadrics;
+	std::vector<uint8_t> locked;
+	std::vector<uint8_t> removed;
+	std::vector<uint32_t> stamps;
+	/* Triangles around a vertex, with stale entries of dead triangles. */
+	std::vector<std::vector<uint32_t>> vertex_triangles;
+	std::vector<candidate> heap;
+	double max_cost{};
+
+	/* Scratch of can_Collapse. */
+	std::vector<uint32_t> from_neighbours;
+	std::vector<uint32_t> to_neighbours;
+};
+
+#endif // !Z_MeshSimplifier_h
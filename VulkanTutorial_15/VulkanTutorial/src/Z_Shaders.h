@@ -2,7 +2,7 @@
 * VulkanTutorial project
 *
 * Created by Andriy Zhabura on 13-Dec-2016.
-* Last modified on 13-Dec-2016.
+* Last modified on 19-Oct-2026.
 */
 
 /*
@@ -160,4 +160,938 @@ static const uint32_t frag_spir_v[] {
 	0x00000009, 0x0000000c, 0x000100fd, 0x00010038
 };
 
+static const char *vertBindlessShaderText = R"""(
+#version 450
+layout (constant_id = 0) const uint OBJECTS_QTY = 256;
+layout (std430, set = 0, binding = 0) readonly buffer ObjectData {
+    mat4 mvp;
+} objects[OBJECTS_QTY];
+layout (push_constant) uniform DrawIndex {
+    uint object;
+} draw;
+layout (location = 0) in vec4 pos;
+layout (location = 1) in vec4 inColor;
+layout (location = 0) out vec4 outColor;
+out gl_PerVertex {
+    vec4 gl_Position;
+};
+void main() {
+   outColor = inColor;
+   gl_Position = objects[draw.object].mvp * pos;
+}
+)""";
+
+static const uint32_t vert_bindless_spir_v[] {
+	0x07230203, 0x00010000, 0x00080001, 0x00000026,
+	0x00000000, 0x00020011, 0x00000001, 0x00020011,
+	0x0000001e, 0x0006000b, 0x00000001, 0x4c534c47,
+	0x6474732e, 0x3035342e, 0x00000000, 0x0003000e,
+	0x00000000, 0x00000001, 0x0009000f, 0x00000000,
+	0x00000002, 0x6e69616d, 0x00000000, 0x00000003,
+	0x00000004, 0x00000005, 0x00000006, 0x00030003,
+	0x00000002, 0x000001c2, 0x00040005, 0x00000002,
+	0x6e69616d, 0x00000000, 0x00050005, 0x00000003,
+	0x4374756f, 0x726f6c6f, 0x00000000, 0x00040005,
+	0x00000004, 0x6f436e69, 0x00726f6c, 0x00060005,
+	0x00000007, 0x505f6c67, 0x65567265, 0x78657472,
+	0x00000000, 0x00060006, 0x00000007, 0x00000000,
+	0x505f6c67, 0x7469736f, 0x006e6f69, 0x00030005,
+	0x00000005, 0x00000000, 0x00050005, 0x00000008,
+	0x454a424f, 0x5f535443, 0x00595451, 0x00050005,
+	0x00000009, 0x656a624f, 0x61447463, 0x00006174,
+	0x00040006, 0x00000009, 0x00000000, 0x0070766d,
+	0x00040005, 0x0000000a, 0x656a626f, 0x00737463,
+	0x00050005, 0x0000000b, 0x77617244, 0x65646e49,
+	0x00000078, 0x00050006, 0x0000000b, 0x00000000,
+	0x656a626f, 0x00007463, 0x00040005, 0x0000000c,
+	0x77617264, 0x00000000, 0x00030005, 0x00000006,
+	0x00736f70, 0x00040047, 0x00000003, 0x0000001e,
+	0x00000000, 0x00040047, 0x00000004, 0x0000001e,
+	0x00000001, 0x00050048, 0x00000007, 0x00000000,
+	0x0000000b, 0x00000000, 0x00030047, 0x00000007,
+	0x00000002, 0x00040047, 0x00000008, 0x00000001,
+	0x00000000, 0x00040048, 0x00000009, 0x00000000,
+	0x00000005, 0x00040048, 0x00000009, 0x00000000,
+	0x00000018, 0x00050048, 0x00000009, 0x00000000,
+	0x00000023, 0x00000000, 0x00050048, 0x00000009,
+	0x00000000, 0x00000007, 0x00000010, 0x00030047,
+	0x00000009, 0x00000003, 0x00040047, 0x0000000a,
+	0x00000022, 0x00000000, 0x00040047, 0x0000000a,
+	0x00000021, 0x00000000, 0x00050048, 0x0000000b,
+	0x00000000, 0x00000023, 0x00000000, 0x00030047,
+	0x0000000b, 0x00000002, 0x00040047, 0x00000006,
+	0x0000001e, 0x00000000, 0x00020013, 0x0000000d,
+	0x00030021, 0x0000000e, 0x0000000d, 0x00030016,
+	0x0000000f, 0x00000020, 0x00040017, 0x00000010,
+	0x0000000f, 0x00000004, 0x00040020, 0x00000011,
+	0x00000003, 0x00000010, 0x0004003b, 0x00000011,
+	0x00000003, 0x00000003, 0x00040020, 0x00000012,
+	0x00000001, 0x00000010, 0x0004003b, 0x00000012,
+	0x00000004, 0x00000001, 0x0003001e, 0x00000007,
+	0x00000010, 0x00040020, 0x00000013, 0x00000003,
+	0x00000007, 0x0004003b, 0x00000013, 0x00000005,
+	0x00000003, 0x00040015, 0x00000014, 0x00000020,
+	0x00000001, 0x0004002b, 0x00000014, 0x00000015,
+	0x00000000, 0x00040015, 0x00000016, 0x00000020,
+	0x00000000, 0x00040018, 0x00000017, 0x00000010,
+	0x00000004, 0x0003001e, 0x00000009, 0x00000017,
+	0x00040032, 0x00000016, 0x00000008, 0x00000100,
+	0x0004001c, 0x00000018, 0x00000009, 0x00000008,
+	0x00040020, 0x00000019, 0x00000002, 0x00000018,
+	0x0004003b, 0x00000019, 0x0000000a, 0x00000002,
+	0x0003001e, 0x0000000b, 0x00000016, 0x00040020,
+	0x0000001a, 0x00000009, 0x0000000b, 0x0004003b,
+	0x0000001a, 0x0000000c, 0x00000009, 0x00040020,
+	0x0000001b, 0x00000009, 0x00000016, 0x00040020,
+	0x0000001c, 0x00000002, 0x00000017, 0x0004003b,
+	0x00000012, 0x00000006, 0x00000001, 0x00050036,
+	0x0000000d, 0x00000002, 0x00000000, 0x0000000e,
+	0x000200f8, 0x0000001d, 0x0004003d, 0x00000010,
+	0x0000001e, 0x00000004, 0x0003003e, 0x00000003,
+	0x0000001e, 0x00050041, 0x0000001b, 0x0000001f,
+	0x0000000c, 0x00000015, 0x0004003d, 0x00000016,
+	0x00000020, 0x0000001f, 0x00060041, 0x0000001c,
+	0x00000021, 0x0000000a, 0x00000020, 0x00000015,
+	0x0004003d, 0x00000017, 0x00000022, 0x00000021,
+	0x0004003d, 0x00000010, 0x00000023, 0x00000006,
+	0x00050091, 0x00000010, 0x00000024, 0x00000022,
+	0x00000023, 0x00050041, 0x00000011, 0x00000025,
+	0x00000005, 0x00000015, 0x0003003e, 0x00000025,
+	0x00000024, 0x000100fd, 0x00010038
+};
+
+static const char *vertTextureShaderText = R"""(
+#version 400
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+layout (std140, binding = 0) uniform bufferVals {
+    mat4 mvp;
+} myBufferVals;
+layout (location = 0) in vec4 pos;
+layout (location = 1) in vec2 inTexCoords;
+layout (location = 0) out vec2 texcoord;
+out gl_PerVertex { 
+    vec4 gl_Position;
+};
+void main() {
+   texcoord = inTexCoords;
+   gl_Position = myBufferVals.mvp * pos;
+}
+)""";
+
+static const uint32_t vert_texture_spir_v[] {
+	0x07230203, 0x00010000, 0x00080001, 0x00000020,
+	0x00000000, 0x00020011, 0x00000001, 0x0006000b,
+	0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e,
+	0x00000000, 0x0003000e, 0x00000000, 0x00000001,
+	0x0009000f, 0x00000000, 0x00000002, 0x6e69616d,
+	0x00000000, 0x00000003, 0x00000004, 0x00000005,
+	0x00000006, 0x00030003, 0x00000002, 0x00000190,
+	0x00090004, 0x415f4c47, 0x735f4252, 0x72617065,
+	0x5f657461, 0x64616873, 0x6f5f7265, 0x63656a62,
+	0x00007374, 0x00090004, 0x415f4c47, 0x735f4252,
+	0x69646168, 0x6c5f676e, 0x75676e61, 0x5f656761,
+	0x70303234, 0x006b6361, 0x00040005, 0x00000002,
+	0x6e69616d, 0x00000000, 0x00050005, 0x00000003,
+	0x63786574, 0x64726f6f, 0x00000000, 0x00050005,
+	0x00000004, 0x65546e69, 0x6f6f4378, 0x00736472,
+	0x00060005, 0x00000007, 0x505f6c67, 0x65567265,
+	0x78657472, 0x00000000, 0x00060006, 0x00000007,
+	0x00000000, 0x505f6c67, 0x7469736f, 0x006e6f69,
+	0x00030005, 0x00000005, 0x00000000, 0x00050005,
+	0x00000008, 0x66667562, 0x61567265, 0x0000736c,
+	0x00040006, 0x00000008, 0x00000000, 0x0070766d,
+	0x00060005, 0x00000009, 0x7542796d, 0x72656666,
+	0x736c6156, 0x00000000, 0x00030005, 0x00000006,
+	0x00736f70, 0x00040047, 0x00000003, 0x0000001e,
+	0x00000000, 0x00040047, 0x00000004, 0x0000001e,
+	0x00000001, 0x00050048, 0x00000007, 0x00000000,
+	0x0000000b, 0x00000000, 0x00030047, 0x00000007,
+	0x00000002, 0x00040048, 0x00000008, 0x00000000,
+	0x00000005, 0x00050048, 0x00000008, 0x00000000,
+	0x00000023, 0x00000000, 0x00050048, 0x00000008,
+	0x00000000, 0x00000007, 0x00000010, 0x00030047,
+	0x00000008, 0x00000002, 0x00040047, 0x00000009,
+	0x00000022, 0x00000000, 0x00040047, 0x00000009,
+	0x00000021, 0x00000000, 0x00040047, 0x00000006,
+	0x0000001e, 0x00000000, 0x00020013, 0x0000000a,
+	0x00030021, 0x0000000b, 0x0000000a, 0x00030016,
+	0x0000000c, 0x00000020, 0x00040017, 0x0000000d,
+	0x0000000c, 0x00000002, 0x00040017, 0x0000000e,
+	0x0000000c, 0x00000004, 0x00040020, 0x0000000f,
+	0x00000003, 0x0000000d, 0x0004003b, 0x0000000f,
+	0x00000003, 0x00000003, 0x00040020, 0x00000010,
+	0x00000001, 0x0000000d, 0x0004003b, 0x00000010,
+	0x00000004, 0x00000001, 0x0003001e, 0x00000007,
+	0x0000000e, 0x00040020, 0x00000011, 0x00000003,
+	0x00000007, 0x0004003b, 0x00000011, 0x00000005,
+	0x00000003, 0x00040015, 0x00000012, 0x00000020,
+	0x00000001, 0x0004002b, 0x00000012, 0x00000013,
+	0x00000000, 0x00040018, 0x00000014, 0x0000000e,
+	0x00000004, 0x0003001e, 0x00000008, 0x00000014,
+	0x00040020, 0x00000015, 0x00000002, 0x00000008,
+	0x0004003b, 0x00000015, 0x00000009, 0x00000002,
+	0x00040020, 0x00000016, 0x00000002, 0x00000014,
+	0x00040020, 0x00000017, 0x00000001, 0x0000000e,
+	0x0004003b, 0x00000017, 0x00000006, 0x00000001,
+	0x00040020, 0x00000018, 0x00000003, 0x0000000e,
+	0x00050036, 0x0000000a, 0x00000002, 0x00000000,
+	0x0000000b, 0x000200f8, 0x00000019, 0x0004003d,
+	0x0000000d, 0x0000001a, 0x00000004, 0x0003003e,
+	0x00000003, 0x0000001a, 0x00050041, 0x00000016,
+	0x0000001b, 0x00000009, 0x00000013, 0x0004003d,
+	0x00000014, 0x0000001c, 0x0000001b, 0x0004003d,
+	0x0000000e, 0x0000001d, 0x00000006, 0x00050091,
+	0x0000000e, 0x0000001e, 0x0000001c, 0x0000001d,
+	0x00050041, 0x00000018, 0x0000001f, 0x00000005,
+	0x00000013, 0x0003003e, 0x0000001f, 0x0000001e,
+	0x000100fd, 0x00010038
+};
+
+static const char *fragTextureShaderText = R"""(
+#version 400
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+layout (binding = 1) uniform sampler2D tex;
+layout (location = 0) in vec2 texcoord;
+layout (location = 0) out vec4 outColor;
+void main() {
+   outColor = texture(tex, texcoord);
+}
+)""";
+
+static const uint32_t frag_texture_spir_v[] {
+	0x07230203, 0x00010000, 0x00080001, 0x00000014,
+	0x00000000, 0x00020011, 0x00000001, 0x0006000b,
+	0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e,
+	0x00000000, 0x0003000e, 0x00000000, 0x00000001,
+	0x0007000f, 0x00000004, 0x00000002, 0x6e69616d,
+	0x00000000, 0x00000003, 0x00000004, 0x00030010,
+	0x00000002, 0x00000007, 0x00030003, 0x00000002,
+	0x00000190, 0x00090004, 0x415f4c47, 0x735f4252,
+	0x72617065, 0x5f657461, 0x64616873, 0x6f5f7265,
+	0x63656a62, 0x00007374, 0x00090004, 0x415f4c47,
+	0x735f4252, 0x69646168, 0x6c5f676e, 0x75676e61,
+	0x5f656761, 0x70303234, 0x006b6361, 0x00040005,
+	0x00000002, 0x6e69616d, 0x00000000, 0x00050005,
+	0x00000003, 0x4374756f, 0x726f6c6f, 0x00000000,
+	0x00030005, 0x00000005, 0x00786574, 0x00050005,
+	0x00000004, 0x63786574, 0x64726f6f, 0x00000000,
+	0x00040047, 0x00000003, 0x0000001e, 0x00000000,
+	0x00040047, 0x00000005, 0x00000022, 0x00000000,
+	0x00040047, 0x00000005, 0x00000021, 0x00000001,
+	0x00040047, 0x00000004, 0x0000001e, 0x00000000,
+	0x00020013, 0x00000006, 0x00030021, 0x00000007,
+	0x00000006, 0x00030016, 0x00000008, 0x00000020,
+	0x00040017, 0x00000009, 0x00000008, 0x00000004,
+	0x00040020, 0x0000000a, 0x00000003, 0x00000009,
+	0x0004003b, 0x0000000a, 0x00000003, 0x00000003,
+	0x00090019, 0x0000000b, 0x00000008, 0x00000001,
+	0x00000000, 0x00000000, 0x00000000, 0x00000001,
+	0x00000000, 0x0003001b, 0x0000000c, 0x0000000b,
+	0x00040020, 0x0000000d, 0x00000000, 0x0000000c,
+	0x0004003b, 0x0000000d, 0x00000005, 0x00000000,
+	0x00040017, 0x0000000e, 0x00000008, 0x00000002,
+	0x00040020, 0x0000000f, 0x00000001, 0x0000000e,
+	0x0004003b, 0x0000000f, 0x00000004, 0x00000001,
+	0x00050036, 0x00000006, 0x00000002, 0x00000000,
+	0x00000007, 0x000200f8, 0x00000010, 0x0004003d,
+	0x0000000c, 0x00000011, 0x00000005, 0x0004003d,
+	0x0000000e, 0x00000012, 0x00000004, 0x00050057,
+	0x00000009, 0x00000013, 0x00000011, 0x00000012,
+	0x0003003e, 0x00000003, 0x00000013, 0x000100fd,
+	0x00010038
+};
+
+static const char *compDownsampleShaderText = R"""(
+#version 450
+layout (local_size_x = 8, local_size_y = 8) in;
+layout (binding = 0) uniform sampler2D src;
+layout (binding = 1) uniform writeonly image2D dst;
+layout (push_constant) uniform Sizes {
+    ivec2 dst_size;
+    ivec2 src_max;
+} sizes;
+void main() {
+   ivec2 p = ivec2(gl_GlobalInvocationID.xy);
+   if (all(lessThan(p, sizes.dst_size))) {
+      ivec2 s = p * 2;
+      vec4 sum = texelFetch(src, min(s, sizes.src_max), 0)
+         + texelFetch(src, min(s + ivec2(1, 0), sizes.src_max), 0)
+         + texelFetch(src, min(s + ivec2(0, 1), sizes.src_max), 0)
+         + texelFetch(src, min(s + ivec2(1, 1), sizes.src_max), 0);
+      imageStore(dst, p, sum * 0.25);
+   }
+}
+)""";
+
+static const uint32_t comp_downsample_spir_v[] {
+	0x07230203, 0x00010000, 0x00080001, 0x00000042,
+	0x00000000, 0x00020011, 0x00000001, 0x00020011,
+	0x00000038, 0x0006000b, 0x00000001, 0x4c534c47,
+	0x6474732e, 0x3035342e, 0x00000000, 0x0003000e,
+	0x00000000, 0x00000001, 0x0006000f, 0x00000005,
+	0x00000002, 0x6e69616d, 0x00000000, 0x00000003,
+	0x00060010, 0x00000002, 0x00000011, 0x00000008,
+	0x00000008, 0x00000001, 0x00030003, 0x00000002,
+	0x000001c2, 0x00040005, 0x00000002, 0x6e69616d,
+	0x00000000, 0x00080005, 0x00000003, 0x475f6c67,
+	0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69,
+	0x00000044, 0x00040005, 0x00000004, 0x657a6953,
+	0x00000073, 0x00060006, 0x00000004, 0x00000000,
+	0x5f747364, 0x657a6973, 0x00000000, 0x00050006,
+	0x00000004, 0x00000001, 0x5f637273, 0x0078616d,
+	0x00040005, 0x00000005, 0x657a6973, 0x00000073,
+	0x00030005, 0x00000006, 0x00637273, 0x00030005,
+	0x00000007, 0x00747364, 0x00040047, 0x00000003,
+	0x0000000b, 0x0000001c, 0x00050048, 0x00000004,
+	0x00000000, 0x00000023, 0x00000000, 0x00050048,
+	0x00000004, 0x00000001, 0x00000023, 0x00000008,
+	0x00030047, 0x00000004, 0x00000002, 0x00040047,
+	0x00000006, 0x00000022, 0x00000000, 0x00040047,
+	0x00000006, 0x00000021, 0x00000000, 0x00040047,
+	0x00000007, 0x00000022, 0x00000000, 0x00040047,
+	0x00000007, 0x00000021, 0x00000001, 0x00030047,
+	0x00000007, 0x00000019, 0x00020013, 0x00000008,
+	0x00030021, 0x00000009, 0x00000008, 0x00020014,
+	0x0000000a, 0x00040017, 0x0000000b, 0x0000000a,
+	0x00000002, 0x00040015, 0x0000000c, 0x00000020,
+	0x00000001, 0x00040015, 0x0000000d, 0x00000020,
+	0x00000000, 0x00030016, 0x0000000e, 0x00000020,
+	0x00040017, 0x0000000f, 0x0000000c, 0x00000002,
+	0x00040017, 0x00000010, 0x0000000d, 0x00000002,
+	0x00040017, 0x00000011, 0x0000000d, 0x00000003,
+	0x00040017, 0x00000012, 0x0000000e, 0x00000004,
+	0x00040020, 0x00000013, 0x00000001, 0x00000011,
+	0x0004003b, 0x00000013, 0x00000003, 0x00000001,
+	0x0004001e, 0x00000004, 0x0000000f, 0x0000000f,
+	0x00040020, 0x00000014, 0x00000009, 0x00000004,
+	0x0004003b, 0x00000014, 0x00000005, 0x00000009,
+	0x00040020, 0x00000015, 0x00000009, 0x0000000f,
+	0x00090019, 0x00000016, 0x0000000e, 0x00000001,
+	0x00000000, 0x00000000, 0x00000000, 0x00000001,
+	0x00000000, 0x0003001b, 0x00000017, 0x00000016,
+	0x00040020, 0x00000018, 0x00000000, 0x00000017,
+	0x0004003b, 0x00000018, 0x00000006, 0x00000000,
+	0x00090019, 0x00000019, 0x0000000e, 0x00000001,
+	0x00000000, 0x00000000, 0x00000000, 0x00000002,
+	0x00000000, 0x00040020, 0x0000001a, 0x00000000,
+	0x00000019, 0x0004003b, 0x0000001a, 0x00000007,
+	0x00000000, 0x0004002b, 0x0000000c, 0x0000001b,
+	0x00000000, 0x0004002b, 0x0000000c, 0x0000001c,
+	0x00000001, 0x0004002b, 0x0000000c, 0x0000001d,
+	0x00000002, 0x0004002b, 0x0000000e, 0x0000001e,
+	0x3e800000, 0x0005002c, 0x0000000f, 0x0000001f,
+	0x0000001d, 0x0000001d, 0x0005002c, 0x0000000f,
+	0x00000020, 0x0000001c, 0x0000001b, 0x0005002c,
+	0x0000000f, 0x00000021, 0x0000001b, 0x0000001c,
+	0x0005002c, 0x0000000f, 0x00000022, 0x0000001c,
+	0x0000001c, 0x00050036, 0x00000008, 0x00000002,
+	0x00000000, 0x00000009, 0x000200f8, 0x00000023,
+	0x0004003d, 0x00000011, 0x00000024, 0x00000003,
+	0x0007004f, 0x00000010, 0x00000025, 0x00000024,
+	0x00000024, 0x00000000, 0x00000001, 0x0004007c,
+	0x0000000f, 0x00000026, 0x00000025, 0x00050041,
+	0x00000015, 0x00000027, 0x00000005, 0x0000001b,
+	0x0004003d, 0x0000000f, 0x00000028, 0x00000027,
+	0x000500b1, 0x0000000b, 0x00000029, 0x00000026,
+	0x00000028, 0x0004009b, 0x0000000a, 0x0000002a,
+	0x00000029, 0x000300f7, 0x0000002b, 0x00000000,
+	0x000400fa, 0x0000002a, 0x0000002c, 0x0000002b,
+	0x000200f8, 0x0000002c, 0x00050041, 0x00000015,
+	0x0000002d, 0x00000005, 0x0000001c, 0x0004003d,
+	0x0000000f, 0x0000002e, 0x0000002d, 0x00050084,
+	0x0000000f, 0x0000002f, 0x00000026, 0x0000001f,
+	0x00050080, 0x0000000f, 0x00000030, 0x0000002f,
+	0x00000020, 0x00050080, 0x0000000f, 0x00000031,
+	0x0000002f, 0x00000021, 0x00050080, 0x0000000f,
+	0x00000032, 0x0000002f, 0x00000022, 0x0007000c,
+	0x0000000f, 0x00000033, 0x00000001, 0x00000027,
+	0x0000002f, 0x0000002e, 0x0007000c, 0x0000000f,
+	0x00000034, 0x00000001, 0x00000027, 0x00000030,
+	0x0000002e, 0x0007000c, 0x0000000f, 0x00000035,
+	0x00000001, 0x00000027, 0x00000031, 0x0000002e,
+	0x0007000c, 0x0000000f, 0x00000036, 0x00000001,
+	0x00000027, 0x00000032, 0x0000002e, 0x0004003d,
+	0x00000017, 0x00000037, 0x00000006, 0x00040064,
+	0x00000016, 0x00000038, 0x00000037, 0x0007005f,
+	0x00000012, 0x00000039, 0x00000038, 0x00000033,
+	0x00000002, 0x0000001b, 0x0007005f, 0x00000012,
+	0x0000003a, 0x00000038, 0x00000034, 0x00000002,
+	0x0000001b, 0x0007005f, 0x00000012, 0x0000003b,
+	0x00000038, 0x00000035, 0x00000002, 0x0000001b,
+	0x0007005f, 0x00000012, 0x0000003c, 0x00000038,
+	0x00000036, 0x00000002, 0x0000001b, 0x00050081,
+	0x00000012, 0x0000003d, 0x00000039, 0x0000003a,
+	0x00050081, 0x00000012, 0x0000003e, 0x0000003d,
+	0x0000003b, 0x00050081, 0x00000012, 0x0000003f,
+	0x0000003e, 0x0000003c, 0x0005008e, 0x00000012,
+	0x00000040, 0x0000003f, 0x0000001e, 0x0004003d,
+	0x00000019, 0x00000041, 0x00000007, 0x00040063,
+	0x00000041, 0x00000026, 0x00000040, 0x000200f9,
+	0x0000002b, 0x000200f8, 0x0000002b, 0x000100fd,
+	0x00010038
+};
+
+static const char *vertInstancedShaderText = R"""(
+#version 400
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+layout (location = 0) in vec4 pos;
+layout (location = 1) in vec4 inColor;
+layout (location = 2) in mat4 instanceMvp;
+layout (location = 6) in vec4 instanceColor;
+layout (location = 0) out vec4 outColor;
+out gl_PerVertex {
+    vec4 gl_Position;
+};
+void main() {
+   outColor = inColor * instanceColor;
+   gl_Position = instanceMvp * pos;
+}
+)""";
+
+static const uint32_t vert_instanced_spir_v[] {
+	0x07230203, 0x00010000, 0x00080001, 0x0000001d,
+	0x00000000, 0x00020011, 0x00000001, 0x0006000b,
+	0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e,
+	0x00000000, 0x0003000e, 0x00000000, 0x00000001,
+	0x000b000f, 0x00000000, 0x00000002, 0x6e69616d,
+	0x00000000, 0x00000003, 0x00000004, 0x00000005,
+	0x00000006, 0x00000007, 0x00000008, 0x00030003,
+	0x00000002, 0x00000190, 0x00090004, 0x415f4c47,
+	0x735f4252, 0x72617065, 0x5f657461, 0x64616873,
+	0x6f5f7265, 0x63656a62, 0x00007374, 0x00090004,
+	0x415f4c47, 0x735f4252, 0x69646168, 0x6c5f676e,
+	0x75676e61, 0x5f656761, 0x70303234, 0x006b6361,
+	0x00040005, 0x00000002, 0x6e69616d, 0x00000000,
+	0x00050005, 0x00000003, 0x4374756f, 0x726f6c6f,
+	0x00000000, 0x00040005, 0x00000004, 0x6f436e69,
+	0x00726f6c, 0x00060005, 0x00000005, 0x74736e69,
+	0x65636e61, 0x6f6c6f43, 0x00000072, 0x00060005,
+	0x00000009, 0x505f6c67, 0x65567265, 0x78657472,
+	0x00000000, 0x00060006, 0x00000009, 0x00000000,
+	0x505f6c67, 0x7469736f, 0x006e6f69, 0x00030005,
+	0x00000006, 0x00000000, 0x00050005, 0x00000007,
+	0x74736e69, 0x65636e61, 0x0070764d, 0x00030005,
+	0x00000008, 0x00736f70, 0x00040047, 0x00000003,
+	0x0000001e, 0x00000000, 0x00040047, 0x00000004,
+	0x0000001e, 0x00000001, 0x00040047, 0x00000005,
+	0x0000001e, 0x00000006, 0x00050048, 0x00000009,
+	0x00000000, 0x0000000b, 0x00000000, 0x00030047,
+	0x00000009, 0x00000002, 0x00040047, 0x00000007,
+	0x0000001e, 0x00000002, 0x00040047, 0x00000008,
+	0x0000001e, 0x00000000, 0x00020013, 0x0000000a,
+	0x00030021, 0x0000000b, 0x0000000a, 0x00030016,
+	0x0000000c, 0x00000020, 0x00040017, 0x0000000d,
+	0x0000000c, 0x00000004, 0x00040020, 0x0000000e,
+	0x00000003, 0x0000000d, 0x0004003b, 0x0000000e,
+	0x00000003, 0x00000003, 0x00040020, 0x0000000f,
+	0x00000001, 0x0000000d, 0x0004003b, 0x0000000f,
+	0x00000004, 0x00000001, 0x0004003b, 0x0000000f,
+	0x00000005, 0x00000001, 0x0003001e, 0x00000009,
+	0x0000000d, 0x00040020, 0x00000010, 0x00000003,
+	0x00000009, 0x0004003b, 0x00000010, 0x00000006,
+	0x00000003, 0x00040015, 0x00000011, 0x00000020,
+	0x00000001, 0x0004002b, 0x00000011, 0x00000012,
+	0x00000000, 0x00040018, 0x00000013, 0x0000000d,
+	0x00000004, 0x00040020, 0x00000014, 0x00000001,
+	0x00000013, 0x0004003b, 0x00000014, 0x00000007,
+	0x00000001, 0x0004003b, 0x0000000f, 0x00000008,
+	0x00000001, 0x00050036, 0x0000000a, 0x00000002,
+	0x00000000, 0x0000000b, 0x000200f8, 0x00000015,
+	0x0004003d, 0x0000000d, 0x00000016, 0x00000004,
+	0x0004003d, 0x0000000d, 0x00000017, 0x00000005,
+	0x00050085, 0x0000000d, 0x00000018, 0x00000016,
+	0x00000017, 0x0003003e, 0x00000003, 0x00000018,
+	0x0004003d, 0x00000013, 0x00000019, 0x00000007,
+	0x0004003d, 0x0000000d, 0x0000001a, 0x00000008,
+	0x00050091, 0x0000000d, 0x0000001b, 0x00000019,
+	0x0000001a, 0x00050041, 0x0000000e, 0x0000001c,
+	0x00000006, 0x00000012, 0x0003003e, 0x0000001c,
+	0x0000001b, 0x000100fd, 0x00010038
+};
+
+static const char *vertTextureInstancedShaderText = R"""(
+#version 400
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+layout (location = 0) in vec4 pos;
+layout (location = 1) in vec2 inTexCoords;
+layout (location = 2) in mat4 instanceMvp;
+layout (location = 0) out vec2 texcoord;
+out gl_PerVertex {
+    vec4 gl_Position;
+};
+void main() {
+   texcoord = inTexCoords;
+   gl_Position = instanceMvp * pos;
+}
+)""";
+
+static const uint32_t vert_texture_instanced_spir_v[] {
+	0x07230203, 0x00010000, 0x00080001, 0x0000001d,
+	0x00000000, 0x00020011, 0x00000001, 0x0006000b,
+	0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e,
+	0x00000000, 0x0003000e, 0x00000000, 0x00000001,
+	0x000a000f, 0x00000000, 0x00000002, 0x6e69616d,
+	0x00000000, 0x00000003, 0x00000004, 0x00000005,
+	0x00000006, 0x00000007, 0x00030003, 0x00000002,
+	0x00000190, 0x00090004, 0x415f4c47, 0x735f4252,
+	0x72617065, 0x5f657461, 0x64616873, 0x6f5f7265,
+	0x63656a62, 0x00007374, 0x00090004, 0x415f4c47,
+	0x735f4252, 0x69646168, 0x6c5f676e, 0x75676e61,
+	0x5f656761, 0x70303234, 0x006b6361, 0x00040005,
+	0x00000002, 0x6e69616d, 0x00000000, 0x00050005,
+	0x00000003, 0x63786574, 0x64726f6f, 0x00000000,
+	0x00050005, 0x00000004, 0x65546e69, 0x6f6f4378,
+	0x00736472, 0x00060005, 0x00000008, 0x505f6c67,
+	0x65567265, 0x78657472, 0x00000000, 0x00060006,
+	0x00000008, 0x00000000, 0x505f6c67, 0x7469736f,
+	0x006e6f69, 0x00030005, 0x00000005, 0x00000000,
+	0x00050005, 0x00000006, 0x74736e69, 0x65636e61,
+	0x0070764d, 0x00030005, 0x00000007, 0x00736f70,
+	0x00040047, 0x00000003, 0x0000001e, 0x00000000,
+	0x00040047, 0x00000004, 0x0000001e, 0x00000001,
+	0x00050048, 0x00000008, 0x00000000, 0x0000000b,
+	0x00000000, 0x00030047, 0x00000008, 0x00000002,
+	0x00040047, 0x00000006, 0x0000001e, 0x00000002,
+	0x00040047, 0x00000007, 0x0000001e, 0x00000000,
+	0x00020013, 0x00000009, 0x00030021, 0x0000000a,
+	0x00000009, 0x00030016, 0x0000000b, 0x00000020,
+	0x00040017, 0x0000000c, 0x0000000b, 0x00000002,
+	0x00040017, 0x0000000d, 0x0000000b, 0x00000004,
+	0x00040020, 0x0000000e, 0x00000003, 0x0000000c,
+	0x0004003b, 0x0000000e, 0x00000003, 0x00000003,
+	0x00040020, 0x0000000f, 0x00000001, 0x0000000c,
+	0x0004003b, 0x0000000f, 0x00000004, 0x00000001,
+	0x0003001e, 0x00000008, 0x0000000d, 0x00040020,
+	0x00000010, 0x00000003, 0x00000008, 0x0004003b,
+	0x00000010, 0x00000005, 0x00000003, 0x00040015,
+	0x00000011, 0x00000020, 0x00000001, 0x0004002b,
+	0x00000011, 0x00000012, 0x00000000, 0x00040018,
+	0x00000013, 0x0000000d, 0x00000004, 0x00040020,
+	0x00000014, 0x00000001, 0x00000013, 0x0004003b,
+	0x00000014, 0x00000006, 0x00000001, 0x00040020,
+	0x00000015, 0x00000001, 0x0000000d, 0x0004003b,
+	0x00000015, 0x00000007, 0x00000001, 0x00040020,
+	0x00000016, 0x00000003, 0x0000000d, 0x00050036,
+	0x00000009, 0x00000002, 0x00000000, 0x0000000a,
+	0x000200f8, 0x00000017, 0x0004003d, 0x0000000c,
+	0x00000018, 0x00000004, 0x0003003e, 0x00000003,
+	0x00000018, 0x0004003d, 0x00000013, 0x00000019,
+	0x00000006, 0x0004003d, 0x0000000d, 0x0000001a,
+	0x00000007, 0x00050091, 0x0000000d, 0x0000001b,
+	0x00000019, 0x0000001a, 0x00050041, 0x00000016,
+	0x0000001c, 0x00000005, 0x00000012, 0x0003003e,
+	0x0000001c, 0x0000001b, 0x000100fd, 0x00010038
+};
+
+static const char *compCullShaderText = R"""(
+#version 450
+layout (local_size_x = 64) in;
+struct Instance {
+    mat4 model;
+    vec4 sphere;
+    vec3 half_extent;
+    uint color;
+};
+layout (std140, binding = 0) uniform Frame {
+    mat4 view_projection;
+    vec4 planes[6];
+    uint instances_qty;
+} frame;
+layout (std430, binding = 1) readonly buffer Instances {
+    Instance instances[];
+};
+layout (std430, binding = 2) writeonly buffer Visible {
+    uint visible[];
+};
+layout (std430, binding = 3) buffer Commands {
+    uint commands[];
+};
+void main() {
+    uint i = gl_GlobalInvocationID.x;
+    if (i >= frame.instances_qty) return;
+    vec4 sphere = instances[i].sphere;
+    vec3 half_extent = instances[i].half_extent;
+    bool culled = false;
+    for (int p = 0; p < 6; ++p) {
+        vec4 plane = frame.planes[p];
+        float distance = dot(plane.xyz, sphere.xyz) + plane.w;
+        culled = culled || distance < -min(dot(abs(plane.xyz), half_extent), sphere.w);
+    }
+    if (culled) return;
+    // instanceCount of the first command.
+    uint slot = atomicAdd(commands[1], 1u);
+    mat4 mvp = frame.view_projection * instances[i].model;
+    for (int c = 0; c < 4; ++c)
+        for (int r = 0; r < 4; ++r)
+            visible[slot * 17u + c * 4 + r] = floatBitsToUint(mvp[c][r]);
+    visible[slot * 17u + 16u] = instances[i].color;
+}
+)""";
+
+static const uint32_t comp_cull_spir_v[] {
+	0x07230203, 0x00010000, 0x00080001, 0x000000e1,
+	0x00000000, 0x00020011, 0x00000001, 0x0006000b,
+	0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e,
+	0x00000000, 0x0003000e, 0x00000000, 0x00000001,
+	0x0006000f, 0x00000005, 0x00000002, 0x6e69616d,
+	0x00000000, 0x00000003, 0x00060010, 0x00000002,
+	0x00000011, 0x00000040, 0x00000001, 0x00000001,
+	0x00030003, 0x00000002, 0x000001c2, 0x00040005,
+	0x00000002, 0x6e69616d, 0x00000000, 0x00080005,
+	0x00000003, 0x475f6c67, 0x61626f6c, 0x766e496c,
+	0x7461636f, 0x496e6f69, 0x00000044, 0x00050005,
+	0x00000004, 0x74736e49, 0x65636e61, 0x00000000,
+	0x00050006, 0x00000004, 0x00000000, 0x65646f6d,
+	0x0000006c, 0x00050006, 0x00000004, 0x00000001,
+	0x65687073, 0x00006572, 0x00060006, 0x00000004,
+	0x00000002, 0x666c6168, 0x7478655f, 0x00746e65,
+	0x00050006, 0x00000004, 0x00000003, 0x6f6c6f63,
+	0x00000072, 0x00040005, 0x00000005, 0x6d617246,
+	0x00000065, 0x00070006, 0x00000005, 0x00000000,
+	0x77656976, 0x6f72705f, 0x7463656a, 0x006e6f69,
+	0x00050006, 0x00000005, 0x00000001, 0x6e616c70,
+	0x00007365, 0x00070006, 0x00000005, 0x00000002,
+	0x74736e69, 0x65636e61, 0x74715f73, 0x00000079,
+	0x00040005, 0x00000006, 0x6d617266, 0x00000065,
+	0x00050005, 0x00000007, 0x74736e49, 0x65636e61,
+	0x00000073, 0x00060006, 0x00000007, 0x00000000,
+	0x74736e69, 0x65636e61, 0x00000073, 0x00030005,
+	0x00000008, 0x00000000, 0x00040005, 0x00000009,
+	0x69736956, 0x00656c62, 0x00050006, 0x00000009,
+	0x00000000, 0x69736976, 0x00656c62, 0x00030005,
+	0x0000000a, 0x00000000, 0x00050005, 0x0000000b,
+	0x6d6d6f43, 0x73646e61, 0x00000000, 0x00060006,
+	0x0000000b, 0x00000000, 0x6d6d6f63, 0x73646e61,
+	0x00000000, 0x00030005, 0x0000000c, 0x00000000,
+	0x00040047, 0x00000003, 0x0000000b, 0x0000001c,
+	0x00040047, 0x0000000d, 0x00000006, 0x00000010,
+	0x00040048, 0x00000005, 0x00000000, 0x00000005,
+	0x00050048, 0x00000005, 0x00000000, 0x00000023,
+	0x00000000, 0x00050048, 0x00000005, 0x00000000,
+	0x00000007, 0x00000010, 0x00050048, 0x00000005,
+	0x00000001, 0x00000023, 0x00000040, 0x00050048,
+	0x00000005, 0x00000002, 0x00000023, 0x000000a0,
+	0x00030047, 0x00000005, 0x00000002, 0x00040047,
+	0x00000006, 0x00000022, 0x00000000, 0x00040047,
+	0x00000006, 0x00000021, 0x00000000, 0x00040048,
+	0x00000004, 0x00000000, 0x00000005, 0x00050048,
+	0x00000004, 0x00000000, 0x00000023, 0x00000000,
+	0x00050048, 0x00000004, 0x00000000, 0x00000007,
+	0x00000010, 0x00050048, 0x00000004, 0x00000001,
+	0x00000023, 0x00000040, 0x00050048, 0x00000004,
+	0x00000002, 0x00000023, 0x00000050, 0x00050048,
+	0x00000004, 0x00000003, 0x00000023, 0x0000005c,
+	0x00040047, 0x0000000e, 0x00000006, 0x00000060,
+	0x00040048, 0x00000007, 0x00000000, 0x00000018,
+	0x00050048, 0x00000007, 0x00000000, 0x00000023,
+	0x00000000, 0x00030047, 0x00000007, 0x00000003,
+	0x00040047, 0x00000008, 0x00000022, 0x00000000,
+	0x00040047, 0x00000008, 0x00000021, 0x00000001,
+	0x00040047, 0x0000000f, 0x00000006, 0x00000004,
+	0x00040048, 0x00000009, 0x00000000, 0x00000019,
+	0x00050048, 0x00000009, 0x00000000, 0x00000023,
+	0x00000000, 0x00030047, 0x00000009, 0x00000003,
+	0x00040047, 0x0000000a, 0x00000022, 0x00000000,
+	0x00040047, 0x0000000a, 0x00000021, 0x00000002,
+	0x00040047, 0x00000010, 0x00000006, 0x00000004,
+	0x00050048, 0x0000000b, 0x00000000, 0x00000023,
+	0x00000000, 0x00030047, 0x0000000b, 0x00000003,
+	0x00040047, 0x0000000c, 0x00000022, 0x00000000,
+	0x00040047, 0x0000000c, 0x00000021, 0x00000003,
+	0x00020013, 0x00000011, 0x00030021, 0x00000012,
+	0x00000011, 0x00020014, 0x00000013, 0x00040015,
+	0x00000014, 0x00000020, 0x00000001, 0x00040015,
+	0x00000015, 0x00000020, 0x00000000, 0x00030016,
+	0x00000016, 0x00000020, 0x00040017, 0x00000017,
+	0x00000015, 0x00000003, 0x00040017, 0x00000018,
+	0x00000016, 0x00000003, 0x00040017, 0x00000019,
+	0x00000016, 0x00000004, 0x00040018, 0x0000001a,
+	0x00000019, 0x00000004, 0x00040020, 0x0000001b,
+	0x00000001, 0x00000017, 0x0004003b, 0x0000001b,
+	0x00000003, 0x00000001, 0x0004002b, 0x00000015,
+	0x0000001c, 0x00000006, 0x0004001c, 0x0000000d,
+	0x00000019, 0x0000001c, 0x0005001e, 0x00000005,
+	0x0000001a, 0x0000000d, 0x00000015, 0x00040020,
+	0x0000001d, 0x00000002, 0x00000005, 0x0004003b,
+	0x0000001d, 0x00000006, 0x00000002, 0x0006001e,
+	0x00000004, 0x0000001a, 0x00000019, 0x00000018,
+	0x00000015, 0x0003001d, 0x0000000e, 0x00000004,
+	0x0003001e, 0x00000007, 0x0000000e, 0x00040020,
+	0x0000001e, 0x00000002, 0x00000007, 0x0004003b,
+	0x0000001e, 0x00000008, 0x00000002, 0x0003001d,
+	0x0000000f, 0x00000015, 0x0003001e, 0x00000009,
+	0x0000000f, 0x00040020, 0x0000001f, 0x00000002,
+	0x00000009, 0x0004003b, 0x0000001f, 0x0000000a,
+	0x00000002, 0x0003001d, 0x00000010, 0x00000015,
+	0x0003001e, 0x0000000b, 0x00000010, 0x00040020,
+	0x00000020, 0x00000002, 0x0000000b, 0x0004003b,
+	0x00000020, 0x0000000c, 0x00000002, 0x00040020,
+	0x00000021, 0x00000002, 0x00000015, 0x00040020,
+	0x00000022, 0x00000002, 0x00000018, 0x00040020,
+	0x00000023, 0x00000002, 0x00000019, 0x00040020,
+	0x00000024, 0x00000002, 0x0000001a, 0x0004002b,
+	0x00000014, 0x00000025, 0x00000000, 0x0004002b,
+	0x00000014, 0x00000026, 0x00000001, 0x0004002b,
+	0x00000014, 0x00000027, 0x00000002, 0x0004002b,
+	0x00000014, 0x00000028, 0x00000003, 0x0004002b,
+	0x00000014, 0x00000029, 0x00000004, 0x0004002b,
+	0x00000014, 0x0000002a, 0x00000005, 0x0004002b,
+	0x00000015, 0x0000002b, 0x00000000, 0x0004002b,
+	0x00000015, 0x0000002c, 0x00000001, 0x0004002b,
+	0x00000015, 0x0000002d, 0x00000010, 0x0004002b,
+	0x00000015, 0x0000002e, 0x00000011, 0x0004002b,
+	0x00000015, 0x0000002f, 0x00000002, 0x0004002b,
+	0x00000015, 0x00000030, 0x00000003, 0x0004002b,
+	0x00000015, 0x00000031, 0x00000004, 0x0004002b,
+	0x00000015, 0x00000032, 0x00000005, 0x0004002b,
+	0x00000015, 0x00000033, 0x00000007, 0x0004002b,
+	0x00000015, 0x00000034, 0x00000008, 0x0004002b,
+	0x00000015, 0x00000035, 0x00000009, 0x0004002b,
+	0x00000015, 0x00000036, 0x0000000a, 0x0004002b,
+	0x00000015, 0x00000037, 0x0000000b, 0x0004002b,
+	0x00000015, 0x00000038, 0x0000000c, 0x0004002b,
+	0x00000015, 0x00000039, 0x0000000d, 0x0004002b,
+	0x00000015, 0x0000003a, 0x0000000e, 0x0004002b,
+	0x00000015, 0x0000003b, 0x0000000f, 0x00050036,
+	0x00000011, 0x00000002, 0x00000000, 0x00000012,
+	0x000200f8, 0x0000003c, 0x0004003d, 0x00000017,
+	0x0000003d, 0x00000003, 0x00050051, 0x00000015,
+	0x0000003e, 0x0000003d, 0x00000000, 0x00050041,
+	0x00000021, 0x0000003f, 0x00000006, 0x00000027,
+	0x0004003d, 0x00000015, 0x00000040, 0x0000003f,
+	0x000500b0, 0x00000013, 0x00000041, 0x0000003e,
+	0x00000040, 0x000300f7, 0x00000042, 0x00000000,
+	0x000400fa, 0x00000041, 0x00000043, 0x00000042,
+	0x000200f8, 0x00000043, 0x00070041, 0x00000023,
+	0x00000044, 0x00000008, 0x00000025, 0x0000003e,
+	0x00000026, 0x0004003d, 0x00000019, 0x00000045,
+	0x00000044, 0x0008004f, 0x00000018, 0x00000046,
+	0x00000045, 0x00000045, 0x00000000, 0x00000001,
+	0x00000002, 0x00050051, 0x00000016, 0x00000047,
+	0x00000045, 0x00000003, 0x00070041, 0x00000022,
+	0x00000048, 0x00000008, 0x00000025, 0x0000003e,
+	0x00000027, 0x0004003d, 0x00000018, 0x00000049,
+	0x00000048, 0x00060041, 0x00000023, 0x0000004a,
+	0x00000006, 0x00000026, 0x00000025, 0x0004003d,
+	0x00000019, 0x0000004b, 0x0000004a, 0x0008004f,
+	0x00000018, 0x0000004c, 0x0000004b, 0x0000004b,
+	0x00000000, 0x00000001, 0x00000002, 0x00050051,
+	0x00000016, 0x0000004d, 0x0000004b, 0x00000003,
+	0x00050094, 0x00000016, 0x0000004e, 0x0000004c,
+	0x00000046, 0x00050081, 0x00000016, 0x0000004f,
+	0x0000004e, 0x0000004d, 0x0006000c, 0x00000018,
+	0x00000050, 0x00000001, 0x00000004, 0x0000004c,
+	0x00050094, 0x00000016, 0x00000051, 0x00000050,
+	0x00000049, 0x0007000c, 0x00000016, 0x00000052,
+	0x00000001, 0x00000025, 0x00000051, 0x00000047,
+	0x0004007f, 0x00000016, 0x00000053, 0x00000052,
+	0x000500b8, 0x00000013, 0x00000054, 0x0000004f,
+	0x00000053, 0x00040053, 0x00000013, 0x00000055,
+	0x00000054, 0x00060041, 0x00000023, 0x00000056,
+	0x00000006, 0x00000026, 0x00000026, 0x0004003d,
+	0x00000019, 0x00000057, 0x00000056, 0x0008004f,
+	0x00000018, 0x00000058, 0x00000057, 0x00000057,
+	0x00000000, 0x00000001, 0x00000002, 0x00050051,
+	0x00000016, 0x00000059, 0x00000057, 0x00000003,
+	0x00050094, 0x00000016, 0x0000005a, 0x00000058,
+	0x00000046, 0x00050081, 0x00000016, 0x0000005b,
+	0x0000005a, 0x00000059, 0x0006000c, 0x00000018,
+	0x0000005c, 0x00000001, 0x00000004, 0x00000058,
+	0x00050094, 0x00000016, 0x0000005d, 0x0000005c,
+	0x00000049, 0x0007000c, 0x00000016, 0x0000005e,
+	0x00000001, 0x00000025, 0x0000005d, 0x00000047,
+	0x0004007f, 0x00000016, 0x0000005f, 0x0000005e,
+	0x000500b8, 0x00000013, 0x00000060, 0x0000005b,
+	0x0000005f, 0x000500a6, 0x00000013, 0x00000061,
+	0x00000055, 0x00000060, 0x00060041, 0x00000023,
+	0x00000062, 0x00000006, 0x00000026, 0x00000027,
+	0x0004003d, 0x00000019, 0x00000063, 0x00000062,
+	0x0008004f, 0x00000018, 0x00000064, 0x00000063,
+	0x00000063, 0x00000000, 0x00000001, 0x00000002,
+	0x00050051, 0x00000016, 0x00000065, 0x00000063,
+	0x00000003, 0x00050094, 0x00000016, 0x00000066,
+	0x00000064, 0x00000046, 0x00050081, 0x00000016,
+	0x00000067, 0x00000066, 0x00000065, 0x0006000c,
+	0x00000018, 0x00000068, 0x00000001, 0x00000004,
+	0x00000064, 0x00050094, 0x00000016, 0x00000069,
+	0x00000068, 0x00000049, 0x0007000c, 0x00000016,
+	0x0000006a, 0x00000001, 0x00000025, 0x00000069,
+	0x00000047, 0x0004007f, 0x00000016, 0x0000006b,
+	0x0000006a, 0x000500b8, 0x00000013, 0x0000006c,
+	0x00000067, 0x0000006b, 0x000500a6, 0x00000013,
+	0x0000006d, 0x00000061, 0x0000006c, 0x00060041,
+	0x00000023, 0x0000006e, 0x00000006, 0x00000026,
+	0x00000028, 0x0004003d, 0x00000019, 0x0000006f,
+	0x0000006e, 0x0008004f, 0x00000018, 0x00000070,
+	0x0000006f, 0x0000006f, 0x00000000, 0x00000001,
+	0x00000002, 0x00050051, 0x00000016, 0x00000071,
+	0x0000006f, 0x00000003, 0x00050094, 0x00000016,
+	0x00000072, 0x00000070, 0x00000046, 0x00050081,
+	0x00000016, 0x00000073, 0x00000072, 0x00000071,
+	0x0006000c, 0x00000018, 0x00000074, 0x00000001,
+	0x00000004, 0x00000070, 0x00050094, 0x00000016,
+	0x00000075, 0x00000074, 0x00000049, 0x0007000c,
+	0x00000016, 0x00000076, 0x00000001, 0x00000025,
+	0x00000075, 0x00000047, 0x0004007f, 0x00000016,
+	0x00000077, 0x00000076, 0x000500b8, 0x00000013,
+	0x00000078, 0x00000073, 0x00000077, 0x000500a6,
+	0x00000013, 0x00000079, 0x0000006d, 0x00000078,
+	0x00060041, 0x00000023, 0x0000007a, 0x00000006,
+	0x00000026, 0x00000029, 0x0004003d, 0x00000019,
+	0x0000007b, 0x0000007a, 0x0008004f, 0x00000018,
+	0x0000007c, 0x0000007b, 0x0000007b, 0x00000000,
+	0x00000001, 0x00000002, 0x00050051, 0x00000016,
+	0x0000007d, 0x0000007b, 0x00000003, 0x00050094,
+	0x00000016, 0x0000007e, 0x0000007c, 0x00000046,
+	0x00050081, 0x00000016, 0x0000007f, 0x0000007e,
+	0x0000007d, 0x0006000c, 0x00000018, 0x00000080,
+	0x00000001, 0x00000004, 0x0000007c, 0x00050094,
+	0x00000016, 0x00000081, 0x00000080, 0x00000049,
+	0x0007000c, 0x00000016, 0x00000082, 0x00000001,
+	0x00000025, 0x00000081, 0x00000047, 0x0004007f,
+	0x00000016, 0x00000083, 0x00000082, 0x000500b8,
+	0x00000013, 0x00000084, 0x0000007f, 0x00000083,
+	0x000500a6, 0x00000013, 0x00000085, 0x00000079,
+	0x00000084, 0x00060041, 0x00000023, 0x00000086,
+	0x00000006, 0x00000026, 0x0000002a, 0x0004003d,
+	0x00000019, 0x00000087, 0x00000086, 0x0008004f,
+	0x00000018, 0x00000088, 0x00000087, 0x00000087,
+	0x00000000, 0x00000001, 0x00000002, 0x00050051,
+	0x00000016, 0x00000089, 0x00000087, 0x00000003,
+	0x00050094, 0x00000016, 0x0000008a, 0x00000088,
+	0x00000046, 0x00050081, 0x00000016, 0x0000008b,
+	0x0000008a, 0x00000089, 0x0006000c, 0x00000018,
+	0x0000008c, 0x00000001, 0x00000004, 0x00000088,
+	0x00050094, 0x00000016, 0x0000008d, 0x0000008c,
+	0x00000049, 0x0007000c, 0x00000016, 0x0000008e,
+	0x00000001, 0x00000025, 0x0000008d, 0x00000047,
+	0x0004007f, 0x00000016, 0x0000008f, 0x0000008e,
+	0x000500b8, 0x00000013, 0x00000090, 0x0000008b,
+	0x0000008f, 0x000500a6, 0x00000013, 0x00000091,
+	0x00000085, 0x00000090, 0x000400a8, 0x00000013,
+	0x00000092, 0x00000091, 0x000300f7, 0x00000093,
+	0x00000000, 0x000400fa, 0x00000092, 0x00000094,
+	0x00000093, 0x000200f8, 0x00000094, 0x00060041,
+	0x00000021, 0x00000095, 0x0000000c, 0x00000025,
+	0x00000026, 0x000700ea, 0x00000015, 0x00000096,
+	0x00000095, 0x0000002c, 0x0000002b, 0x0000002c,
+	0x00050041, 0x00000024, 0x00000097, 0x00000006,
+	0x00000025, 0x0004003d, 0x0000001a, 0x00000098,
+	0x00000097, 0x00070041, 0x00000024, 0x00000099,
+	0x00000008, 0x00000025, 0x0000003e, 0x00000025,
+	0x0004003d, 0x0000001a, 0x0000009a, 0x00000099,
+	0x00050092, 0x0000001a, 0x0000009b, 0x00000098,
+	0x0000009a, 0x00050084, 0x00000015, 0x0000009c,
+	0x00000096, 0x0000002e, 0x00060051, 0x00000016,
+	0x0000009d, 0x0000009b, 0x00000000, 0x00000000,
+	0x0004007c, 0x00000015, 0x0000009e, 0x0000009d,
+	0x00050080, 0x00000015, 0x0000009f, 0x0000009c,
+	0x0000002b, 0x00060041, 0x00000021, 0x000000a0,
+	0x0000000a, 0x00000025, 0x0000009f, 0x0003003e,
+	0x000000a0, 0x0000009e, 0x00060051, 0x00000016,
+	0x000000a1, 0x0000009b, 0x00000000, 0x00000001,
+	0x0004007c, 0x00000015, 0x000000a2, 0x000000a1,
+	0x00050080, 0x00000015, 0x000000a3, 0x0000009c,
+	0x0000002c, 0x00060041, 0x00000021, 0x000000a4,
+	0x0000000a, 0x00000025, 0x000000a3, 0x0003003e,
+	0x000000a4, 0x000000a2, 0x00060051, 0x00000016,
+	0x000000a5, 0x0000009b, 0x00000000, 0x00000002,
+	0x0004007c, 0x00000015, 0x000000a6, 0x000000a5,
+	0x00050080, 0x00000015, 0x000000a7, 0x0000009c,
+	0x0000002f, 0x00060041, 0x00000021, 0x000000a8,
+	0x0000000a, 0x00000025, 0x000000a7, 0x0003003e,
+	0x000000a8, 0x000000a6, 0x00060051, 0x00000016,
+	0x000000a9, 0x0000009b, 0x00000000, 0x00000003,
+	0x0004007c, 0x00000015, 0x000000aa, 0x000000a9,
+	0x00050080, 0x00000015, 0x000000ab, 0x0000009c,
+	0x00000030, 0x00060041, 0x00000021, 0x000000ac,
+	0x0000000a, 0x00000025, 0x000000ab, 0x0003003e,
+	0x000000ac, 0x000000aa, 0x00060051, 0x00000016,
+	0x000000ad, 0x0000009b, 0x00000001, 0x00000000,
+	0x0004007c, 0x00000015, 0x000000ae, 0x000000ad,
+	0x00050080, 0x00000015, 0x000000af, 0x0000009c,
+	0x00000031, 0x00060041, 0x00000021, 0x000000b0,
+	0x0000000a, 0x00000025, 0x000000af, 0x0003003e,
+	0x000000b0, 0x000000ae, 0x00060051, 0x00000016,
+	0x000000b1, 0x0000009b, 0x00000001, 0x00000001,
+	0x0004007c, 0x00000015, 0x000000b2, 0x000000b1,
+	0x00050080, 0x00000015, 0x000000b3, 0x0000009c,
+	0x00000032, 0x00060041, 0x00000021, 0x000000b4,
+	0x0000000a, 0x00000025, 0x000000b3, 0x0003003e,
+	0x000000b4, 0x000000b2, 0x00060051, 0x00000016,
+	0x000000b5, 0x0000009b, 0x00000001, 0x00000002,
+	0x0004007c, 0x00000015, 0x000000b6, 0x000000b5,
+	0x00050080, 0x00000015, 0x000000b7, 0x0000009c,
+	0x0000001c, 0x00060041, 0x00000021, 0x000000b8,
+	0x0000000a, 0x00000025, 0x000000b7, 0x0003003e,
+	0x000000b8, 0x000000b6, 0x00060051, 0x00000016,
+	0x000000b9, 0x0000009b, 0x00000001, 0x00000003,
+	0x0004007c, 0x00000015, 0x000000ba, 0x000000b9,
+	0x00050080, 0x00000015, 0x000000bb, 0x0000009c,
+	0x00000033, 0x00060041, 0x00000021, 0x000000bc,
+	0x0000000a, 0x00000025, 0x000000bb, 0x0003003e,
+	0x000000bc, 0x000000ba, 0x00060051, 0x00000016,
+	0x000000bd, 0x0000009b, 0x00000002, 0x00000000,
+	0x0004007c, 0x00000015, 0x000000be, 0x000000bd,
+	0x00050080, 0x00000015, 0x000000bf, 0x0000009c,
+	0x00000034, 0x00060041, 0x00000021, 0x000000c0,
+	0x0000000a, 0x00000025, 0x000000bf, 0x0003003e,
+	0x000000c0, 0x000000be, 0x00060051, 0x00000016,
+	0x000000c1, 0x0000009b, 0x00000002, 0x00000001,
+	0x0004007c, 0x00000015, 0x000000c2, 0x000000c1,
+	0x00050080, 0x00000015, 0x000000c3, 0x0000009c,
+	0x00000035, 0x00060041, 0x00000021, 0x000000c4,
+	0x0000000a, 0x00000025, 0x000000c3, 0x0003003e,
+	0x000000c4, 0x000000c2, 0x00060051, 0x00000016,
+	0x000000c5, 0x0000009b, 0x00000002, 0x00000002,
+	0x0004007c, 0x00000015, 0x000000c6, 0x000000c5,
+	0x00050080, 0x00000015, 0x000000c7, 0x0000009c,
+	0x00000036, 0x00060041, 0x00000021, 0x000000c8,
+	0x0000000a, 0x00000025, 0x000000c7, 0x0003003e,
+	0x000000c8, 0x000000c6, 0x00060051, 0x00000016,
+	0x000000c9, 0x0000009b, 0x00000002, 0x00000003,
+	0x0004007c, 0x00000015, 0x000000ca, 0x000000c9,
+	0x00050080, 0x00000015, 0x000000cb, 0x0000009c,
+	0x00000037, 0x00060041, 0x00000021, 0x000000cc,
+	0x0000000a, 0x00000025, 0x000000cb, 0x0003003e,
+	0x000000cc, 0x000000ca, 0x00060051, 0x00000016,
+	0x000000cd, 0x0000009b, 0x00000003, 0x00000000,
+	0x0004007c, 0x00000015, 0x000000ce, 0x000000cd,
+	0x00050080, 0x00000015, 0x000000cf, 0x0000009c,
+	0x00000038, 0x00060041, 0x00000021, 0x000000d0,
+	0x0000000a, 0x00000025, 0x000000cf, 0x0003003e,
+	0x000000d0, 0x000000ce, 0x00060051, 0x00000016,
+	0x000000d1, 0x0000009b, 0x00000003, 0x00000001,
+	0x0004007c, 0x00000015, 0x000000d2, 0x000000d1,
+	0x00050080, 0x00000015, 0x000000d3, 0x0000009c,
+	0x00000039, 0x00060041, 0x00000021, 0x000000d4,
+	0x0000000a, 0x00000025, 0x000000d3, 0x0003003e,
+	0x000000d4, 0x000000d2, 0x00060051, 0x00000016,
+	0x000000d5, 0x0000009b, 0x00000003, 0x00000002,
+	0x0004007c, 0x00000015, 0x000000d6, 0x000000d5,
+	0x00050080, 0x00000015, 0x000000d7, 0x0000009c,
+	0x0000003a, 0x00060041, 0x00000021, 0x000000d8,
+	0x0000000a, 0x00000025, 0x000000d7, 0x0003003e,
+	0x000000d8, 0x000000d6, 0x00060051, 0x00000016,
+	0x000000d9, 0x0000009b, 0x00000003, 0x00000003,
+	0x0004007c, 0x00000015, 0x000000da, 0x000000d9,
+	0x00050080, 0x00000015, 0x000000db, 0x0000009c,
+	0x0000003b, 0x00060041, 0x00000021, 0x000000dc,
+	0x0000000a, 0x00000025, 0x000000db, 0x0003003e,
+	0x000000dc, 0x000000da, 0x00070041, 0x00000021,
+	0x000000dd, 0x00000008, 0x00000025, 0x0000003e,
+	0x00000028, 0x0004003d, 0x00000015, 0x000000de,
+	0x000000dd, 0x00050080, 0x00000015, 0x000000df,
+	0x0000009c, 0x0000002d, 0x00060041, 0x00000021,
+	0x000000e0, 0x0000000a, 0x00000025, 0x000000df,
+	0x0003003e, 0x000000e0, 0x000000de, 0x000200f9,
+	0x00000093, 0x000200f8, 0x00000093, 0x000200f9,
+	0x00000042, 0x000200f8, 0x00000042, 0x000100fd,
+	0x00010038
+};
+
 #endif // Z_Shaders_h
\ No newline at end of file
@@ -0,0 +1,56 @@
+/* Z_Simd.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_Simd.h"
+
+#if defined(Z_SIMD_AVX) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+Z_Simd::level Z_Simd::get_Best()
+{
+#if defined(Z_SIMD_AVX) && defined(_MSC_VER)
+	// AVX needs the CPU feature and the OS saving the YMM registers.
+	int info[4];
+	__cpuid(info, 1);
+	const bool osxsave = (info[2] & (1 << 27)) != 0;
+	const bool has_avx = (info[2] & (1 << 28)) != 0;
+	if (osxsave && has_avx && (_xgetbv(0) & 6) == 6)
+	{
+		return avx;
+	}
+	return sse;
+#elif defined(Z_SIMD_AVX)
+	return __builtin_cpu_supports("avx") ? avx : sse;
+#elif defined(Z_SIMD_SSE)
+	return sse;
+#else
+	return none;
+#endif
+}
@@ -0,0 +1,60 @@
+/* Z_Simd.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_Simd_h
+#define Z_Simd_h
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1) || defined(__SSE__)
+#define Z_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+// AVX code is compiled for the function only, it runs after a CPU check.
+#if defined(Z_SIMD_SSE) && defined(_MSC_VER)
+#define Z_SIMD_AVX
+#define Z_AVX_FUNCTION
+#include <immintrin.h>
+#elif defined(Z_SIMD_SSE) && defined(__GNUC__)
+#define Z_SIMD_AVX
+#define Z_AVX_FUNCTION __attribute__((target("avx")))
+#include <immintrin.h>
+#endif
+
+/* Instruction sets of the vectorized paths, narrowest first. Z_SIMD_SSE */
+/* and Z_SIMD_AVX tell which ones the compiler can emit.                 */
+class Z_Simd
+{
+public:
+	enum level { none, sse, avx };
+
+	/* The widest level the compiler and the CPU both support. */
+	static level get_Best();
+};
+
+#endif // !Z_Simd_h
@@ -0,0 +1,136 @@
+/* Z_StartupReport.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_StartupReport.h"
+#include <fstream>
+#include <algorithm>
+#include <iomanip>
+
+namespace
+{
+	double to_ms(Z_StartupReport::clock::duration d)
+	{
+		return std::chrono::duration<double, std::milli>(d).count();
+	}
+
+	std::string json_escaped(const std::string& s)
+	{
+		std::string result;
+		for (auto c : s)
+		{
+			switch (c)
+			{
+			case '"':  result += "\\\""; break;
+			case '\\': result += "\\\\"; break;
+			case '\n': result += "\\n"; break;
+			case '\t': result += "\\t"; break;
+			default:   result += c; break;
+			}
+		}
+		return result;
+	}
+}
+
+Z_StartupReport::Z_StartupReport()
+	: origin(clock::now())
+{
+}
+
+void Z_StartupReport::add(const char* stage, clock::time_point start, clock::time_point finish)
+{
+	std::lock_guard<std::mutex> lock(stages_mutex);
+
+	// Threads are numbered in order of their first recorded stage.
+	auto id = std::this_thread::get_id();
+	auto it = std::find(threads.begin(), threads.end(), id);
+	size_t thread = it - threads.begin();
+	if (it == threads.end())
+	{
+		threads.push_back(id);
+	}
+
+	stage_timing timing;
+	timing.name = stage;
+	timing.thread = thread;
+	timing.start = start;
+	timing.finish = finish;
+	stages.push_back(timing);
+}
+
+void Z_StartupReport::write_json(std::ostream& out) const
+{
+	std::lock_guard<std::mutex> lock(stages_mutex);
+
+	// Nested stages finish before the stage enclosing them, so the
+	// report is sorted by start time to keep the outer stage first.
+	std::vector<stage_timing> sorted = stages;
+	std::stable_sort(sorted.begin(), sorted.end(),
+		[](const stage_timing& a, const stage_timing& b) { return a.start < b.start; });
+
+	clock::time_point last = origin;
+	for (auto& s : sorted)
+	{
+		last = std::max(last, s.finish);
+	}
+
+	out << std::fixed << std::setprecision(4);
+	out << "{\n";
+	out << "  \"version\": 1,\n";
+#if defined(_DEBUG)
+	out << "  \"configuration\": \"Debug\",\n";
+#else
+	out << "  \"configuration\": \"Release\",\n";
+#endif
+	out << "  \"build\": \"" << __DATE__ << " " << __TIME__ << "\",\n";
+	out << "  \"total_ms\": " << to_ms(last - origin) << ",\n";
+	out << "  \"stages\": [\n";
+	for (size_t i = 0; i < sorted.size(); ++i)
+	{
+		out << "    { \"name\": \"" << json_escaped(sorted[i].name) << "\""
+			<< ", \"thread\": " << sorted[i].thread
+			<< ", \"start_ms\": " << to_ms(sorted[i].start - origin)
+			<< ", \"duration_ms\": " << to_ms(sorted[i].finish - sorted[i].start)
+			<< " }" << (i + 1 < sorted.size() ? ",\n" : "\n");
+	}
+	out << "  ]\n";
+	out << "}\n";
+}
+
+bool Z_StartupReport::save(const std::string& path) const
+{
+	std::ofstream file(path);
+	if (!file)
+	{
+		return false;
+	}
+
+	write_json(file);
+
+	return file.good();
+}
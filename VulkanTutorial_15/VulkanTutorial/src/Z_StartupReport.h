@@ -0,0 +1,92 @@
+/* Z_StartupReport.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_StartupReport_h
+#define Z_StartupReport_h
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <ostream>
+
+/* Collects high resolution timings of initialization stages and writes */
+/* them as a machine-readable JSON report. Stages may be recorded from   */
+/* several threads at once.                                              */
+class Z_StartupReport
+{
+public:
+	typedef std::chrono::high_resolution_clock clock;
+
+	Z_StartupReport();
+
+	void add(const char* stage, clock::time_point start, clock::time_point finish);
+
+	void write_json(std::ostream& out) const;
+	bool save(const std::string& path) const;
+
+	/* Records the lifetime of the object as one stage. */
+	class scoped_timer
+	{
+	public:
+		scoped_timer(Z_StartupReport& report, const char* stage)
+			: report(report)
+			, stage(stage)
+			, start(clock::now())
+		{
+		}
+		~scoped_timer()
+		{
+			report.add(stage, start, clock::now());
+		}
+
+		scoped_timer(const scoped_timer&) = delete;
+		scoped_timer& operator=(const scoped_timer&) = delete;
+	private:
+		Z_StartupReport& report;
+		const char* stage;
+		clock::time_point start;
+	};
+private:
+	struct stage_timing
+	{
+		std::string name;
+		size_t thread;
+		clock::time_point start;
+		clock::time_point finish;
+	};
+
+	clock::time_point origin;
+	std::vector<stage_timing> stages;
+	std::vector<std::thread::id> threads;
+	mutable std::mutex stages_mutex;
+};
+
+#endif // !Z_StartupReport_h
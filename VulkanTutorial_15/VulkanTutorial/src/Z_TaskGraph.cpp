@@ -0,0 +1,227 @@
+/* Z_TaskGraph.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_TaskGraph.h"
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <iomanip>
+
+Z_TaskGraph::task_id Z_TaskGraph::add_task(const std::string& name, std::function<bool()> work,
+	std::initializer_list<task_id> depends_on)
+{
+	task_id id = tasks.size();
+	for (auto d : depends_on)
+	{
+		if (d >= id)
+		{
+			throw std::domain_error{ "Task \"" + name + "\" depends on unknown task" };
+		}
+		tasks[d].dependents.push_back(id);
+	}
+
+	task t;
+	t.name = name;
+	t.work = std::move(work);
+	t.depends_on = depends_on;
+	tasks.push_back(std::move(t));
+
+	return id;
+}
+
+void Z_TaskGraph::run(Z_ThreadPool& pool)
+{
+	{
+		std::lock_guard<std::mutex> lock(graph_mutex);
+		finished_qty = 0;
+		first_error = nullptr;
+		for (auto& t : tasks)
+		{
+			t.unfinished_deps = t.depends_on.size();
+			t.any_dep_failed = false;
+			t.state = task_state::pending;
+		}
+	}
+
+	run_start = clock::now();
+
+	for (task_id id = 0; id < tasks.size(); ++id)
+	{
+		if (!tasks[id].unfinished_deps)
+		{
+			schedule(pool, id);
+		}
+	}
+
+	std::unique_lock<std::mutex> lock(graph_mutex);
+	done_cv.wait(lock, [this] { return finished_qty == tasks.size(); });
+	run_finish = clock::now();
+
+	if (first_error)
+	{
+		std::rethrow_exception(first_error);
+	}
+}
+
+void Z_TaskGraph::schedule(Z_ThreadPool& pool, task_id id)
+{
+	pool.submit([this, &pool, id] { execute(pool, id); });
+}
+
+void Z_TaskGraph::execute(Z_ThreadPool& pool, task_id id)
+{
+	task& t = tasks[id];
+
+	if (t.any_dep_failed)
+	{
+		t.start = t.finish = clock::now();
+		complete(pool, id, task_state::skipped);
+		return;
+	}
+
+	t.worker = pool.current_worker();
+	t.start = clock::now();
+	task_state state = task_state::failed;
+	try
+	{
+		state = t.work() ? task_state::succeeded : task_state::failed;
+	}
+	catch (...)
+	{
+		std::lock_guard<std::mutex> lock(graph_mutex);
+		if (!first_error)
+		{
+			first_error = std::current_exception();
+		}
+	}
+	t.finish = clock::now();
+
+	complete(pool, id, state);
+}
+
+void Z_TaskGraph::complete(Z_ThreadPool& pool, task_id id, task_state state)
+{
+	std::vector<task_id> ready;
+	{
+		std::lock_guard<std::mutex> lock(graph_mutex);
+		tasks[id].state = state;
+		for (auto d : tasks[id].dependents)
+		{
+			if (state != task_state::succeeded)
+			{
+				tasks[d].any_dep_failed = true;
+			}
+			if (!--tasks[d].unfinished_deps)
+			{
+				ready.push_back(d);
+			}
+		}
+		++finished_qty;
+	}
+
+	for (auto d : ready)
+	{
+		schedule(pool, d);
+	}
+
+	done_cv.notify_all();
+}
+
+std::vector<Z_TaskGraph::task_id> Z_TaskGraph::critical_path() const
+{
+	std::vector<task_id> result;
+	if (!tasks.size())
+	{
+		return result;
+	}
+
+	// Tasks are stored in topological order, so a single forward pass
+	// finds the longest chain ending at every task.
+	std::vector<clock::duration> chain(tasks.size());
+	std::vector<task_id> previous(tasks.size(), SIZE_MAX);
+	for (task_id id = 0; id < tasks.size(); ++id)
+	{
+		clock::duration longest{};
+		for (auto d : tasks[id].depends_on)
+		{
+			if (chain[d] > longest || previous[id] == SIZE_MAX)
+			{
+				longest = chain[d];
+				previous[id] = d;
+			}
+		}
+		chain[id] = longest + (tasks[id].finish - tasks[id].start);
+	}
+
+	task_id last = std::max_element(chain.begin(), chain.end()) - chain.begin();
+	for (task_id id = last; id != SIZE_MAX; id = previous[id])
+	{
+		result.push_back(id);
+	}
+	std::reverse(result.begin(), result.end());
+
+	return result;
+}
+
+void Z_TaskGraph::print_report(std::ostream& out) const
+{
+	static const char* state_names[] = { "pending", "ok", "FAILED", "skipped" };
+
+	out << "Initialization stages (start ms, duration ms, worker):\n";
+	clock::duration busy{};
+	for (auto& t : tasks)
+	{
+		busy += t.finish - t.start;
+		out << "    " << std::left << std::setw(28) << t.name << std::right
+			<< std::fixed << std::setprecision(3)
+			<< std::setw(10) << to_ms(t.start - run_start)
+			<< std::setw(10) << to_ms(t.finish - t.start)
+			<< std::setw(4) << t.worker
+			<< "  " << state_names[static_cast<int>(t.state)] << "\n";
+	}
+
+	std::vector<task_id> path = critical_path();
+	clock::duration path_length{};
+	out << "Critical path:";
+	for (size_t i = 0; i < path.size(); ++i)
+	{
+		path_length += tasks[path[i]].finish - tasks[path[i]].start;
+		out << (i ? " -> " : " ") << tasks[path[i]].name;
+	}
+	out << "\n";
+	out << std::fixed << std::setprecision(3)
+		<< "Critical path " << to_ms(path_length) << " ms, wall time "
+		<< to_ms(run_finish - run_start) << " ms, sum of stages "
+		<< to_ms(busy) << " ms.\n";
+}
+
+double Z_TaskGraph::to_ms(clock::duration d)
+{
+	return std::chrono::duration<double, std::milli>(d).count();
+}
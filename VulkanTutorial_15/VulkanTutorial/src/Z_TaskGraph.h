@@ -0,0 +1,106 @@
+/* Z_TaskGraph.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_TaskGraph_h
+#define Z_TaskGraph_h
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <initializer_list>
+#include <chrono>
+#include <ostream>
+#include <exception>
+
+#include "Z_ThreadPool.h"
+
+/* Directed acyclic graph of named stages. A stage is started as soon as   */
+/* all stages it depends on have succeeded; independent stages run on the  */
+/* thread pool concurrently. A stage which fails (returns false or throws) */
+/* causes all stages depending on it to be skipped.                        */
+class Z_TaskGraph
+{
+public:
+	typedef size_t task_id;
+	typedef std::chrono::steady_clock clock;
+
+	/* Dependencies must be already added tasks, so ids are in topological order. */
+	task_id add_task(const std::string& name, std::function<bool()> work,
+		std::initializer_list<task_id> depends_on = {});
+
+	/* Runs the whole graph and waits for it. The first exception thrown */
+	/* by a stage is rethrown here after all running stages finished.    */
+	void run(Z_ThreadPool& pool);
+
+	bool succeeded(task_id id) const { return tasks[id].state == task_state::succeeded; }
+	bool skipped(task_id id) const { return tasks[id].state == task_state::skipped; }
+
+	/* Stages on the longest duration chain through the graph. */
+	std::vector<task_id> critical_path() const;
+	void print_report(std::ostream& out) const;
+private:
+	enum class task_state
+	{
+		pending,
+		succeeded,
+		failed,
+		skipped
+	};
+
+	struct task
+	{
+		std::string name;
+		std::function<bool()> work;
+		std::vector<task_id> depends_on;
+		std::vector<task_id> dependents;
+		size_t unfinished_deps{};
+		bool any_dep_failed{};
+		task_state state{ task_state::pending };
+		clock::time_point start{};
+		clock::time_point finish{};
+		size_t worker{};
+	};
+
+	void schedule(Z_ThreadPool& pool, task_id id);
+	void execute(Z_ThreadPool& pool, task_id id);
+	void complete(Z_ThreadPool& pool, task_id id, task_state state);
+
+	static double to_ms(clock::duration d);
+
+	std::vector<task> tasks;
+	clock::time_point run_start{};
+	clock::time_point run_finish{};
+
+	std::mutex graph_mutex;
+	std::condition_variable done_cv;
+	size_t finished_qty{};
+	std::exception_ptr first_error;
+};
+
+#endif // !Z_TaskGraph_h
@@ -0,0 +1,185 @@
+/* Z_ThreadPool.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_ThreadPool.h"
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <exception>
+#include <algorithm>
+
+namespace
+{
+	thread_local size_t tls_worker_index = SIZE_MAX;
+}
+
+Z_ThreadPool::Z_ThreadPool(size_t threads_qty)
+{
+	if (!threads_qty)
+	{
+		threads_qty = std::thread::hardware_concurrency();
+	}
+	if (!threads_qty)
+	{
+		threads_qty = 1;
+	}
+
+	workers.reserve(threads_qty);
+	for (size_t i = 0; i < threads_qty; ++i)
+	{
+		workers.emplace_back(&Z_ThreadPool::worker_loop, this, i);
+	}
+}
+
+Z_ThreadPool::~Z_ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(tasks_mutex);
+		stopping = true;
+	}
+	tasks_cv.notify_all();
+
+	for (auto& w : workers)
+	{
+		w.join();
+	}
+}
+
+void Z_ThreadPool::submit(std::function<void()> task)
+{
+	{
+		std::lock_guard<std::mutex> lock(tasks_mutex);
+		tasks.push(std::move(task));
+	}
+	tasks_cv.notify_one();
+}
+
+void Z_ThreadPool::parallel_for(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body)
+{
+	if (!count)
+	{
+		return;
+	}
+
+	// Shared with the helper tasks, which may start after the loop is done.
+	struct loop_state
+	{
+		std::function<void(size_t, size_t)> body;
+		size_t count;
+		size_t grain;
+		size_t chunks;
+		std::atomic<size_t> next_chunk;
+		std::atomic<size_t> done_chunks;
+		std::mutex mutex;
+		std::condition_variable done_cv;
+		std::exception_ptr error;
+	};
+	auto state = std::make_shared<loop_state>();
+	state->body = body;
+	state->count = count;
+	state->grain = std::max<size_t>(grain, 1);
+	state->chunks = (count + state->grain - 1) / state->grain;
+	state->next_chunk = 0;
+	state->done_chunks = 0;
+
+	auto run_chunks = [state]
+	{
+		for (;;)
+		{
+			size_t chunk = state->next_chunk++;
+			if (chunk >= state->chunks)
+			{
+				return;
+			}
+
+			size_t begin = chunk * state->grain;
+			try
+			{
+				state->body(begin, std::min(begin + state->grain, state->count));
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(state->mutex);
+				if (!state->error)
+				{
+					state->error = std::current_exception();
+				}
+			}
+
+			if (++state->done_chunks == state->chunks)
+			{
+				std::lock_guard<std::mutex> lock(state->mutex);
+				state->done_cv.notify_all();
+			}
+		}
+	};
+
+	// The calling thread takes chunks too, so a loop started from a
+	// worker progresses even when all other workers are busy.
+	size_t helpers = std::min(workers.size(), state->chunks - 1);
+	for (size_t i = 0; i < helpers; ++i)
+	{
+		submit(run_chunks);
+	}
+	run_chunks();
+
+	std::unique_lock<std::mutex> lock(state->mutex);
+	state->done_cv.wait(lock, [&state] { return state->done_chunks == state->chunks; });
+	if (state->error)
+	{
+		std::rethrow_exception(state->error);
+	}
+}
+
+size_t Z_ThreadPool::current_worker() const
+{
+	return tls_worker_index == SIZE_MAX ? workers.size() : tls_worker_index;
+}
+
+void Z_ThreadPool::worker_loop(size_t index)
+{
+	tls_worker_index = index;
+
+	for (;;)
+	{
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(tasks_mutex);
+			tasks_cv.wait(lock, [this] { return stopping || !tasks.empty(); });
+			if (tasks.empty())
+			{
+				// stopping and nothing left to run
+				return;
+			}
+			task = std::move(tasks.front());
+			tasks.pop();
+		}
+		task();
+	}
+}
@@ -0,0 +1,72 @@
+/* Z_ThreadPool.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_ThreadPool_h
+#define Z_ThreadPool_h
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+/* Fixed-size pool of worker threads executing submitted tasks in FIFO order. */
+class Z_ThreadPool
+{
+public:
+	/* threads_qty == 0 means one worker per hardware thread. */
+	explicit Z_ThreadPool(size_t threads_qty = 0);
+	~Z_ThreadPool();
+
+	Z_ThreadPool(const Z_ThreadPool&) = delete;
+	Z_ThreadPool& operator=(const Z_ThreadPool&) = delete;
+
+	void submit(std::function<void()> task);
+
+	/* Calls body(begin, end) for chunks of at most grain items of [0, count) */
+	/* on the workers and the calling thread, and returns when all chunks    */
+	/* are done. The first exception thrown by body is rethrown here.        */
+	void parallel_for(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body);
+
+	size_t size() const { return workers.size(); }
+
+	/* Index of the calling worker, or size() for a non-pool thread. */
+	size_t current_worker() const;
+private:
+	void worker_loop(size_t index);
+
+	std::vector<std::thread> workers;
+	std::queue<std::function<void()>> tasks;
+	std::mutex tasks_mutex;
+	std::condition_variable tasks_cv;
+	bool stopping{ false };
+};
+
+#endif // !Z_ThreadPool_h
@@ -0,0 +1,346 @@
+/* Z_TransformHierarchy.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_TransformHierarchy.h"
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <cmath>
+
+namespace
+{
+	typedef std::chrono::high_resolution_clock clock;
+
+	/* Nodes of a depth updated by one task. */
+	const size_t range_size = 4096;
+
+	template <typename T>
+	void permute(std::vector<T>& values, const std::vector<uint32_t>& order)
+	{
+		std::vector<T> sorted(values.size());
+		for (size_t i = 0; i < order.size(); ++i)
+		{
+			sorted[i] = values[order[i]];
+		}
+		values.swap(sorted);
+	}
+}
+
+uint32_t Z_TransformHierarchy::add_Node(uint32_t parent)
+{
+	if (no_parent != parent && parent >= slot_of.size())
+	{
+		throw std::domain_error{ "Transform parent " + std::to_string(parent) + " does not exist" };
+	}
+
+	const uint32_t id = static_cast<uint32_t>(id_of.size());
+	const uint32_t slot = id;
+	const uint32_t depth = no_parent == parent ? 0 : depths[slot_of[parent]] + 1;
+	if (!depths.empty() && depth < depths.back())
+	{
+		sorted = false;
+	}
+
+	for (auto* v : { &tx, &ty, &tz, &rx, &ry, &rz })
+	{
+		v->push_back(0.0f);
+	}
+	for (auto* v : { &rw, &sx, &sy, &sz })
+	{
+		v->push_back(1.0f);
+	}
+	parents.push_back(parent);
+	if (no_parent != parent)
+	{
+		parents.back() = slot_of[parent];
+	}
+	depths.push_back(depth);
+	id_of.push_back(id);
+	slot_of.push_back(slot);
+	worlds.resize(worlds.size() + 16, 0.0f);
+	local_dirty.push_back(0);
+	world_changed.push_back(0);
+	flag(slot);
+	if (sorted)
+	{
+		depth_first.resize(std::max<size_t>(depth_first.size(), depth + 2), depth_first.empty() ? 0 : depth_first.back());
+		depth_first[depth + 1] = slot + 1;
+	}
+	return id;
+}
+
+void Z_TransformHierarchy::flag(uint32_t slot)
+{
+	local_dirty[slot] = 1;
+	dirty_depth = std::min(dirty_depth, depths[slot]);
+}
+
+void Z_TransformHierarchy::set_Translation(uint32_t id, const float* xyz)
+{
+	const uint32_t s = slot_of[id];
+	tx[s] = xyz[0];
+	ty[s] = xyz[1];
+	tz[s] = xyz[2];
+	flag(s);
+}
+
+void Z_TransformHierarchy::set_Rotation(uint32_t id, const float* q)
+{
+	const uint32_t s = slot_of[id];
+	rx[s] = q[0];
+	ry[s] = q[1];
+	rz[s] = q[2];
+	rw[s] = q[3];
+	flag(s);
+}
+
+void Z_TransformHierarchy::set_Scale(uint32_t id, const float* xyz)
+{
+	const uint32_t s = slot_of[id];
+	sx[s] = xyz[0];
+	sy[s] = xyz[1];
+	sz[s] = xyz[2];
+	flag(s);
+}
+
+void Z_TransformHierarchy::set_Local(uint32_t id, const float* translation, const float* quaternion, const float* scale)
+{
+	set_Translation(id, translation);
+	set_Rotation(id, quaternion);
+	set_Scale(id, scale);
+}
+
+void Z_TransformHierarchy::sort_Nodes()
+{
+	// Stable, so a depth keeps the creation order of its nodes.
+	std::vector<uint32_t> order(id_of.size());
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		order[i] = static_cast<uint32_t>(i);
+	}
+	std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) { return depths[a] < depths[b]; });
+
+	std::vector<uint32_t> new_slot(order.size());
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		new_slot[order[i]] = static_cast<uint32_t>(i);
+	}
+
+	for (auto* v : { &tx, &ty, &tz, &rx, &ry, &rz, &rw, &sx, &sy, &sz })
+	{
+		permute(*v, order);
+	}
+	for (auto* v : { &depths, &id_of })
+	{
+		permute(*v, order);
+	}
+	permute(local_dirty, order);
+	permute(world_changed, order);
+	permute(parents, order);
+	for (auto& p : parents)
+	{
+		if (no_parent != p)
+		{
+			p = new_slot[p];
+		}
+	}
+	for (size_t i = 0; i < id_of.size(); ++i)
+	{
+		slot_of[id_of[i]] = static_cast<uint32_t>(i);
+	}
+
+	// Every world is recomputed, the matrices need not follow their nodes.
+	depth_first.assign(depths.empty() ? 1 : depths.back() + 2, 0);
+	for (auto d : depths)
+	{
+		++depth_first[d + 1];
+	}
+	for (size_t d = 1; d < depth_first.size(); ++d)
+	{
+		depth_first[d] += depth_first[d - 1];
+	}
+	std::fill(local_dirty.begin(), local_dirty.end(), 1);
+	dirty_depth = 0;
+	sorted = true;
+}
+
+void Z_TransformHierarchy::update(Z_JobSystem* jobs)
+{
+	last_update_changed = dirty_depth != 0xFFFFFFFFu;
+	if (!last_update_changed)
+	{
+		return;
+	}
+	if (!sorted)
+	{
+		sort_Nodes();
+	}
+
+	// The depths above the shallowest flagged node keep their worlds,
+	// their change flags are cleared for the children to read.
+	std::fill(world_changed.begin(), world_changed.begin() + depth_first[dirty_depth], 0);
+	for (size_t d = dirty_depth; d + 1 < depth_first.size(); ++d)
+	{
+		const size_t first = depth_first[d];
+		const size_t count = depth_first[d + 1] - first;
+		if (jobs && count > range_size)
+		{
+			jobs->parallel_for(count, range_size, [&](size_t begin, size_t end)
+			{
+				update_Range(first + begin, first + end);
+			}, "transforms");
+		}
+		else
+		{
+			update_Range(first, first + count);
+		}
+	}
+	dirty_depth = 0xFFFFFFFFu;
+}
+
+void Z_TransformHierarchy::update_Range(size_t begin, size_t end)
+{
+	for (size_t s = begin; s < end; ++s)
+	{
+		const uint32_t p = parents[s];
+		const bool changed = local_dirty[s] || (no_parent != p && world_changed[p]);
+		world_changed[s] = changed ? 1 : 0;
+		if (!changed)
+		{
+			continue;
+		}
+		local_dirty[s] = 0;
+
+		// T * R * S, the rotation columns scaled.
+		const float x = rx[s], y = ry[s], z = rz[s], w = rw[s];
+		float local[16] = {
+			(1.0f - 2.0f * (y * y + z * z)) * sx[s], 2.0f * (x * y + w * z) * sx[s], 2.0f * (x * z - w * y) * sx[s], 0.0f,
+			2.0f * (x * y - w * z) * sy[s], (1.0f - 2.0f * (x * x + z * z)) * sy[s], 2.0f * (y * z + w * x) * sy[s], 0.0f,
+			2.0f * (x * z + w * y) * sz[s], 2.0f * (y * z - w * x) * sz[s], (1.0f - 2.0f * (x * x + y * y)) * sz[s], 0.0f,
+			tx[s], ty[s], tz[s], 1.0f };
+
+		float* world = &worlds[16 * s];
+		if (no_parent == p)
+		{
+			std::copy(local, local + 16, world);
+			continue;
+		}
+		const float* parent = &worlds[16 * static_cast<size_t>(p)];
+		for (size_t column = 0; column < 4; ++column)
+		{
+			for (size_t row = 0; row < 4; ++row)
+			{
+				world[4 * column + row] = parent[row] * local[4 * column] + parent[4 + row] * local[4 * column + 1]
+					+ parent[8 + row] * local[4 * column + 2] + parent[12 + row] * local[4 * column + 3];
+			}
+		}
+	}
+}
+
+void Z_TransformHierarchy::benchmark(std::ostream& out, Z_JobSystem& jobs, size_t nodes_qty)
+{
+	// A root, 1000 groups and the other nodes as leaves of the groups,
+	// created interleaved so the first update sorts them.
+	Z_TransformHierarchy hierarchy;
+	const uint32_t root = hierarchy.add_Node();
+	const size_t groups_qty = std::min<size_t>(1000, nodes_qty / 2 + 1);
+	std::vector<uint32_t> groups;
+	for (size_t i = 1; i < nodes_qty; ++i)
+	{
+		if (groups.size() < groups_qty && (groups.empty() || 0 == i % (nodes_qty / groups_qty + 1)))
+		{
+			groups.push_back(hierarchy.add_Node(root));
+		}
+		else
+		{
+			const uint32_t leaf = hierarchy.add_Node(groups[i % groups.size()]);
+			const float t[3] = { 0.01f * (i % 100), 0.0f, 0.01f * (i / 100 % 100) };
+			hierarchy.set_Translation(leaf, t);
+		}
+	}
+
+	const auto flags = out.flags();
+	const auto precision = out.precision();
+	out << "Transform hierarchy of " << hierarchy.size() << " nodes in " << groups.size() << " groups:\n";
+	out << std::fixed << std::setprecision(3);
+
+	auto start = clock::now();
+	hierarchy.update(&jobs);
+	double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+	out << "    " << std::left << std::setw(28) << "sort and first update" << std::right << std::setw(9) << ms << " ms\n";
+
+	const size_t frames_qty = 10;
+	for (int threaded = 0; threaded < 2; ++threaded)
+	{
+		Z_JobSystem* p = threaded ? &jobs : nullptr;
+		const std::string threads = threaded ? std::to_string(jobs.size() + 1) + " threads" : "1 thread";
+		float angle = 0.0f;
+		auto print = [&](const char* label, double ms)
+		{
+			out << "    " << std::left << std::setw(18) << label << std::setw(10) << threads << std::right
+				<< std::setw(9) << ms << " ms per frame\n";
+		};
+		auto rotate = [&](uint32_t id)
+		{
+			angle += 0.01f;
+			const float q[4] = { 0.0f, std::sin(0.5f * angle), 0.0f, std::cos(0.5f * angle) };
+			hierarchy.set_Rotation(id, q);
+		};
+
+		start = clock::now();
+		for (size_t frame = 0; frame < frames_qty; ++frame)
+		{
+			rotate(root);
+			hierarchy.update(p);
+		}
+		ms = std::chrono::duration<double, std::milli>(clock::now() - start).count() / frames_qty;
+		print("root moved", ms);
+
+		start = clock::now();
+		for (size_t frame = 0; frame < frames_qty; ++frame)
+		{
+			rotate(groups[frame % groups.size()]);
+			hierarchy.update(p);
+		}
+		ms = std::chrono::duration<double, std::milli>(clock::now() - start).count() / frames_qty;
+		print("one group moved", ms);
+
+		start = clock::now();
+		for (size_t frame = 0; frame < frames_qty; ++frame)
+		{
+			hierarchy.update(p);
+		}
+		ms = std::chrono::duration<double, std::milli>(clock::now() - start).count() / frames_qty;
+		print("nothing moved", ms);
+	}
+
+	out.flags(flags);
+	out.precision(precision);
+}
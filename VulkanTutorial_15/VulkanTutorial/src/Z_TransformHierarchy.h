@@ -0,0 +1,100 @@
+/* Z_TransformHierarchy.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_TransformHierarchy_h
+#define Z_TransformHierarchy_h
+
+#include <vector>
+#include <cstdint>
+#include <ostream>
+
+#include "Z_JobSystem.h"
+
+/* Parent and child transforms, each node a local translation, rotation   */
+/* quaternion (x, y, z, w) and scale, kept as a structure of arrays.      */
+/* Nodes are stored sorted by depth, so parents precede their children   */
+/* and every depth is one contiguous range; nodes of a depth keep their   */
+/* creation order. Setting a local transform flags the node, update then */
+/* recomputes the world matrices of the flagged subtrees only, depth by   */
+/* depth, with the ranges of a depth split over the job workers.          */
+class Z_TransformHierarchy
+{
+public:
+	static const uint32_t no_parent = 0xFFFFFFFFu;
+
+	/* Ids are given in creation order, the parent must exist already.   */
+	/* A new node has the identity transform.                            */
+	uint32_t add_Node(uint32_t parent = no_parent);
+	size_t size() const { return id_of.size(); }
+
+	void set_Translation(uint32_t id, const float* xyz);
+	void set_Rotation(uint32_t id, const float* quaternion);
+	void set_Scale(uint32_t id, const float* xyz);
+	void set_Local(uint32_t id, const float* translation, const float* quaternion, const float* scale);
+
+	/* Null jobs update on the calling thread. */
+	void update(Z_JobSystem* jobs = nullptr);
+
+	/* Column-major world matrices as of the last update, in slot order. */
+	const float* get_World(uint32_t id) const { return &worlds[16 * static_cast<size_t>(slot_of[id])]; }
+	const float* get_Worlds() const { return worlds.data(); }
+	/* Position of a node in the storage, valid until nodes are added. */
+	uint32_t get_Slot(uint32_t id) const { return slot_of[id]; }
+	/* Whether the last update changed the world matrix of the node. */
+	bool is_Changed(uint32_t id) const { return last_update_changed && world_changed[slot_of[id]]; }
+
+	/* Times full and partial updates of a wide hierarchy of nodes_qty nodes. */
+	static void benchmark(std::ostream& out, Z_JobSystem& jobs, size_t nodes_qty);
+private:
+	void flag(uint32_t slot);
+	void sort_Nodes();
+	void update_Range(size_t begin, size_t end);
+
+	/* Local transforms. */
+	std::vector<float> tx, ty, tz;
+	std::vector<float> rx, ry, rz, rw;
+	std::vector<float> sx, sy, sz;
+
+	std::vector<uint32_t> parents;
+	std::vector<uint32_t> depths;
+	std::vector<uint32_t> id_of;
+	std::vector<uint32_t> slot_of;
+	std::vector<float> worlds;
+	std::vector<uint8_t> local_dirty;
+	std::vector<uint8_t> world_changed;
+
+	/* First slot of every depth, and one past the last node. */
+	std::vector<size_t> depth_first;
+	bool sorted{ true };
+	/* Shallowest depth holding a flagged node, depths above it are clean. */
+	uint32_t dirty_depth{ 0xFFFFFFFFu };
+	bool last_update_changed{};
+};
+
+#endif // !Z_TransformHierarchy_h
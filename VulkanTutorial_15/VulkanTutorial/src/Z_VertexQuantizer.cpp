@@ -0,0 +1,601 @@
+/* Z_VertexQuantizer.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#include "Z_VertexQuantizer.h"
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <iomanip>
+#include <cstring>
+#include <cstddef>
+#include <cmath>
+#include <stdexcept>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define Z_VERTEX_QUANTIZER_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	const float snorm16_max = 32767.0f;
+
+	float read_float(const uint8_t* p, size_t i)
+	{
+		float f;
+		std::memcpy(&f, p + i * sizeof(float), sizeof(f));
+		return f;
+	}
+
+	float clamp(float v, float lo, float hi)
+	{
+		return std::min(std::max(v, lo), hi);
+	}
+
+	float sign_not_zero(float v)
+	{
+		return v < 0.0f ? -1.0f : 1.0f;
+	}
+
+	int16_t to_snorm16(float v)
+	{
+		return static_cast<int16_t>(std::lrint(clamp(v, -1.0f, 1.0f) * snorm16_max));
+	}
+
+	float from_snorm16(int16_t v)
+	{
+		return std::max(v / snorm16_max, -1.0f);
+	}
+
+#ifdef Z_VERTEX_QUANTIZER_SSE2
+	/* Four lanes of float_to_half, the same rounding as the scalar one. */
+	__m128i float_to_half4(__m128 f)
+	{
+		const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+		const __m128 round_mask = _mm_castsi128_ps(_mm_set1_epi32(~0xfff));
+		const __m128i f32infty = _mm_set1_epi32(255 << 23);
+		const __m128 f16clamp = _mm_castsi128_ps(_mm_set1_epi32((31 << 23) - 0x1000));
+		const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(15 << 23));
+
+		const __m128 sign = _mm_and_ps(f, sign_mask);
+		const __m128 absf = _mm_xor_ps(f, sign);
+		const __m128i absf_bits = _mm_castps_si128(absf);
+		const __m128i is_nan = _mm_cmpgt_epi32(absf_bits, f32infty);
+		const __m128i is_finite = _mm_cmpgt_epi32(f32infty, absf_bits);
+		const __m128i inf_or_nan = _mm_or_si128(_mm_and_si128(is_nan, _mm_set1_epi32(0x200)), _mm_set1_epi32(0x7c00));
+
+		// Rounds through the float unit: the magic multiply rebiases the exponent.
+		const __m128 scaled = _mm_mul_ps(_mm_and_ps(absf, round_mask), magic);
+		const __m128 clamped = _mm_min_ps(scaled, f16clamp);
+		const __m128i biased = _mm_sub_epi32(_mm_castps_si128(clamped), _mm_castps_si128(round_mask));
+		const __m128i finite = _mm_and_si128(_mm_srli_epi32(biased, 13), is_finite);
+		const __m128i joined = _mm_or_si128(finite, _mm_andnot_si128(is_finite, inf_or_nan));
+
+		return _mm_or_si128(joined, _mm_srli_epi32(_mm_castps_si128(sign), 16));
+	}
+
+	/* Packs the low 16 bits of four lanes without signed saturation. */
+	__m128i pack_low16(__m128i v)
+	{
+		v = _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+		return _mm_packs_epi32(v, v);
+	}
+#endif
+}
+
+Z_VertexQuantizer::Z_VertexQuantizer(const source_layout& source, position_format format)
+	: source(source)
+{
+	layout.format = format;
+	layout.stride = 0;
+	layout.position = layout.color = layout.uv = layout.normal = absent;
+
+	struct attribute
+	{
+		uint32_t source_offset;
+		uint32_t* packed_offset;
+		uint32_t size;
+	};
+	attribute attributes[] = {
+		{ source.position, &layout.position, position_float32 == format ? 16u : 8u },
+		{ source.color, &layout.color, 4u },
+		{ source.uv, &layout.uv, 4u },
+		{ source.normal, &layout.normal, 4u },
+	};
+	std::stable_sort(std::begin(attributes), std::end(attributes), [](const attribute& a, const attribute& b)
+	{
+		return a.source_offset < b.source_offset;
+	});
+	for (auto& a : attributes)
+	{
+		if (absent != a.source_offset)
+		{
+			*a.packed_offset = layout.stride;
+			layout.stride += a.size;
+		}
+	}
+
+	for (size_t i = 0; i < 4; ++i)
+	{
+		center[i] = 0.0f;
+		extent[i] = 1.0f;
+	}
+}
+
+bool Z_VertexQuantizer::has_Simd()
+{
+#ifdef Z_VERTEX_QUANTIZER_SSE2
+	return true;
+#else
+	return false;
+#endif
+}
+
+uint16_t Z_VertexQuantizer::float_to_half(float f)
+{
+	const uint32_t f32infty = 255u << 23;
+	const uint32_t f16infty = 31u << 23;
+	const uint32_t round_mask = ~0xfffu;
+	const float magic = 1.92592994e-34f; // 2^-112, the bits of 15 << 23
+
+	uint32_t bits;
+	std::memcpy(&bits, &f, sizeof(bits));
+	const uint32_t sign = bits & 0x80000000u;
+	bits ^= sign;
+
+	uint32_t half;
+	if (bits >= f32infty)
+	{
+		half = bits > f32infty ? 0x7e00 : 0x7c00;
+	}
+	else
+	{
+		bits &= round_mask;
+		float scaled;
+		std::memcpy(&scaled, &bits, sizeof(scaled));
+		scaled *= magic;
+		std::memcpy(&bits, &scaled, sizeof(bits));
+		bits -= round_mask;
+		bits = std::min(bits, f16infty);
+		half = bits >> 13;
+	}
+
+	return static_cast<uint16_t>(half | (sign >> 16));
+}
+
+float Z_VertexQuantizer::half_to_float(uint16_t h)
+{
+	const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+	const uint32_t exponent = (h >> 10) & 0x1fu;
+	const uint32_t mantissa = h & 0x3ffu;
+
+	uint32_t bits;
+	if (!exponent)
+	{
+		// Zero or subnormal: mantissa * 2^-24.
+		const float f = mantissa * (1.0f / 16777216.0f);
+		std::memcpy(&bits, &f, sizeof(bits));
+		bits |= sign;
+	}
+	else if (31 == exponent)
+	{
+		bits = sign | 0x7f800000u | (mantissa << 13);
+	}
+	else
+	{
+		bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+	}
+
+	float f;
+	std::memcpy(&f, &bits, sizeof(f));
+	return f;
+}
+
+void Z_VertexQuantizer::encode_Octahedral(const float* normal, int16_t* encoded)
+{
+	const float l1 = std::fabs(normal[0]) + std::fabs(normal[1]) + std::fabs(normal[2]);
+	float x = 0.0f;
+	float y = 0.0f;
+	if (l1 > 0.0f)
+	{
+		x = normal[0] / l1;
+		y = normal[1] / l1;
+		if (normal[2] < 0.0f)
+		{
+			const float folded_x = (1.0f - std::fabs(y)) * sign_not_zero(x);
+			const float folded_y = (1.0f - std::fabs(x)) * sign_not_zero(y);
+			x = folded_x;
+			y = folded_y;
+		}
+	}
+	encoded[0] = to_snorm16(x);
+	encoded[1] = to_snorm16(y);
+}
+
+void Z_VertexQuantizer::decode_Octahedral(const int16_t* encoded, float* normal)
+{
+	float x = from_snorm16(encoded[0]);
+	float y = from_snorm16(encoded[1]);
+	const float z = 1.0f - std::fabs(x) - std::fabs(y);
+	if (z < 0.0f)
+	{
+		const float unfolded_x = (1.0f - std::fabs(y)) * sign_not_zero(x);
+		const float unfolded_y = (1.0f - std::fabs(x)) * sign_not_zero(y);
+		x = unfolded_x;
+		y = unfolded_y;
+	}
+	const float length = std::sqrt(x * x + y * y + z * z);
+	normal[0] = x / length;
+	normal[1] = y / length;
+	normal[2] = z / length;
+}
+
+void Z_VertexQuantizer::compute_Bounds(const uint8_t* vertices, size_t vertices_qty)
+{
+	if (position_snorm16 != layout.format || absent == source.position || !vertices_qty)
+	{
+		return;
+	}
+
+	float lo[3];
+	float hi[3];
+	for (size_t k = 0; k < 3; ++k)
+	{
+		lo[k] = hi[k] = read_float(vertices + source.position, k);
+	}
+	for (size_t v = 1; v < vertices_qty; ++v)
+	{
+		const uint8_t* p = vertices + v * source.stride + source.position;
+		for (size_t k = 0; k < 3; ++k)
+		{
+			lo[k] = std::min(lo[k], read_float(p, k));
+			hi[k] = std::max(hi[k], read_float(p, k));
+		}
+	}
+
+	// w stays as it is, a constant 1 packs to 32767.
+	for (size_t k = 0; k < 3; ++k)
+	{
+		center[k] = 0.5f * (lo[k] + hi[k]);
+		extent[k] = hi[k] > lo[k] ? 0.5f * (hi[k] - lo[k]) : 1.0f;
+	}
+}
+
+std::vector<uint8_t> Z_VertexQuantizer::quantize(const uint8_t* vertices, size_t vertices_qty, bool use_simd)
+{
+	compute_Bounds(vertices, vertices_qty);
+
+	std::vector<uint8_t> packed(vertices_qty * layout.stride);
+	if (use_simd && has_Simd())
+	{
+		quantize_Simd(vertices, vertices_qty, packed.data());
+	}
+	else
+	{
+		quantize_Scalar(vertices, vertices_qty, packed.data());
+	}
+	return packed;
+}
+
+Z_IndexedMesh Z_VertexQuantizer::quantize(const Z_IndexedMesh& mesh, bool use_simd)
+{
+	if (mesh.get_VertexStride() != source.stride)
+	{
+		throw std::domain_error{ "Mesh vertices do not match the quantizer source layout" };
+	}
+	return Z_IndexedMesh(quantize(mesh.get_Vertices().data(), mesh.get_VerticesQty(), use_simd),
+		layout.stride, mesh.get_Indices());
+}
+
+void Z_VertexQuantizer::quantize_Scalar(const uint8_t* vertices, size_t vertices_qty, uint8_t* packed) const
+{
+	for (size_t v = 0; v < vertices_qty; ++v)
+	{
+		const uint8_t* src = vertices + v * source.stride;
+		uint8_t* dst = packed + v * layout.stride;
+
+		if (absent != layout.position)
+		{
+			if (position_float32 == layout.format)
+			{
+				std::memcpy(dst + layout.position, src + source.position, 4 * sizeof(float));
+			}
+			else
+			{
+				uint16_t p[4];
+				for (size_t k = 0; k < 4; ++k)
+				{
+					const float f = read_float(src + source.position, k);
+					// The same float operations as the SIMD path, for equal results.
+					p[k] = position_half == layout.format ? float_to_half(f)
+						: static_cast<uint16_t>(std::lrint(clamp((f - center[k]) * (snorm16_max / extent[k]),
+							-snorm16_max, snorm16_max)));
+				}
+				std::memcpy(dst + layout.position, p, sizeof(p));
+			}
+		}
+		if (absent != layout.color)
+		{
+			uint8_t c[4];
+			for (size_t k = 0; k < 4; ++k)
+			{
+				c[k] = static_cast<uint8_t>(std::lrint(clamp(read_float(src + source.color, k), 0.0f, 1.0f) * 255.0f));
+			}
+			std::memcpy(dst + layout.color, c, sizeof(c));
+		}
+		if (absent != layout.uv)
+		{
+			uint16_t uv[2] = { float_to_half(read_float(src + source.uv, 0)), float_to_half(read_float(src + source.uv, 1)) };
+			std::memcpy(dst + layout.uv, uv, sizeof(uv));
+		}
+		if (absent != layout.normal)
+		{
+			float n[3] = { read_float(src + source.normal, 0), read_float(src + source.normal, 1), read_float(src + source.normal, 2) };
+			int16_t e[2];
+			encode_Octahedral(n, e);
+			std::memcpy(dst + layout.normal, e, sizeof(e));
+		}
+	}
+}
+
+void Z_VertexQuantizer::quantize_Simd(const uint8_t* vertices, size_t vertices_qty, uint8_t* packed) const
+{
+#ifdef Z_VERTEX_QUANTIZER_SSE2
+	const __m128 position_center = _mm_loadu_ps(center);
+	const __m128 position_scale = _mm_div_ps(_mm_set1_ps(snorm16_max), _mm_loadu_ps(extent));
+	const __m128 snorm_max = _mm_set1_ps(snorm16_max);
+	const __m128 unorm8_max = _mm_set1_ps(255.0f);
+	const __m128 zero = _mm_setzero_ps();
+
+	for (size_t v = 0; v < vertices_qty; ++v)
+	{
+		const uint8_t* src = vertices + v * source.stride;
+		uint8_t* dst = packed + v * layout.stride;
+
+		// A whole position or color is one register.
+		if (absent != layout.position)
+		{
+			const __m128 p = _mm_loadu_ps(reinterpret_cast<const float*>(src + source.position));
+			if (position_float32 == layout.format)
+			{
+				_mm_storeu_ps(reinterpret_cast<float*>(dst + layout.position), p);
+			}
+			else
+			{
+				__m128i q;
+				if (position_half == layout.format)
+				{
+					q = pack_low16(float_to_half4(p));
+				}
+				else
+				{
+					__m128 s = _mm_mul_ps(_mm_sub_ps(p, position_center), position_scale);
+					s = _mm_min_ps(_mm_max_ps(s, _mm_sub_ps(zero, snorm_max)), snorm_max);
+					const __m128i i = _mm_cvtps_epi32(s);
+					q = _mm_packs_epi32(i, i);
+				}
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(dst + layout.position), q);
+			}
+		}
+		if (absent != layout.color)
+		{
+			__m128 c = _mm_loadu_ps(reinterpret_cast<const float*>(src + source.color));
+			c = _mm_mul_ps(_mm_min_ps(_mm_max_ps(c, zero), _mm_set1_ps(1.0f)), unorm8_max);
+			const __m128i i = _mm_cvtps_epi32(c);
+			const __m128i w = _mm_packs_epi32(i, i);
+			const int32_t bytes = _mm_cvtsi128_si32(_mm_packus_epi16(w, w));
+			std::memcpy(dst + layout.color, &bytes, sizeof(bytes));
+		}
+		if (absent != layout.uv)
+		{
+			const __m128 uv = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(src + source.uv)));
+			const int32_t halves = _mm_cvtsi128_si32(pack_low16(float_to_half4(uv)));
+			std::memcpy(dst + layout.uv, &halves, sizeof(halves));
+		}
+		// Octahedral folding branches per vertex, it stays scalar.
+		if (absent != layout.normal)
+		{
+			float n[3] = { read_float(src + source.normal, 0), read_float(src + source.normal, 1), read_float(src + source.normal, 2) };
+			int16_t e[2];
+			encode_Octahedral(n, e);
+			std::memcpy(dst + layout.normal, e, sizeof(e));
+		}
+	}
+#else
+	quantize_Scalar(vertices, vertices_qty, packed);
+#endif
+}
+
+void Z_VertexQuantizer::decode_Position(const uint8_t* packed, float* position) const
+{
+	if (position_float32 == layout.format)
+	{
+		std::memcpy(position, packed + layout.position, 4 * sizeof(float));
+		return;
+	}
+
+	uint16_t p[4];
+	std::memcpy(p, packed + layout.position, sizeof(p));
+	for (size_t k = 0; k < 4; ++k)
+	{
+		position[k] = position_half == layout.format ? half_to_float(p[k])
+			: center[k] + extent[k] * from_snorm16(static_cast<int16_t>(p[k]));
+	}
+}
+
+Z_VertexQuantizer::error_report Z_VertexQuantizer::measure_Error(const uint8_t* vertices, const uint8_t* packed, size_t vertices_qty) const
+{
+	error_report r{};
+	r.vertices = vertices_qty;
+	r.source_stride = source.stride;
+	r.packed_stride = layout.stride;
+
+	double squared_sum = 0.0;
+	for (size_t v = 0; v < vertices_qty; ++v)
+	{
+		const uint8_t* src = vertices + v * source.stride;
+		const uint8_t* dst = packed + v * layout.stride;
+
+		if (absent != layout.position)
+		{
+			float p[4];
+			decode_Position(dst, p);
+			double squared = 0.0;
+			for (size_t k = 0; k < 3; ++k)
+			{
+				const double d = std::fabs(p[k] - read_float(src + source.position, k));
+				r.position_max = std::max(r.position_max, d);
+				squared += d * d;
+			}
+			squared_sum += squared;
+		}
+		if (absent != layout.color)
+		{
+			for (size_t k = 0; k < 4; ++k)
+			{
+				const float c = clamp(read_float(src + source.color, k), 0.0f, 1.0f);
+				r.color_max = std::max(r.color_max, std::fabs(dst[layout.color + k] / 255.0 - c));
+			}
+		}
+		if (absent != layout.uv)
+		{
+			uint16_t uv[2];
+			std::memcpy(uv, dst + layout.uv, sizeof(uv));
+			for (size_t k = 0; k < 2; ++k)
+			{
+				r.uv_max = std::max(r.uv_max, static_cast<double>(std::fabs(half_to_float(uv[k]) - read_float(src + source.uv, k))));
+			}
+		}
+		if (absent != layout.normal)
+		{
+			int16_t e[2];
+			std::memcpy(e, dst + layout.normal, sizeof(e));
+			float n[3];
+			decode_Octahedral(e, n);
+			const float s[3] = { read_float(src + source.normal, 0), read_float(src + source.normal, 1), read_float(src + source.normal, 2) };
+			const double length = std::sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
+			if (length > 0.0)
+			{
+				const double cosine = (n[0] * s[0] + n[1] * s[1] + n[2] * s[2]) / length;
+				const double degrees = std::acos(std::min(std::max(cosine, -1.0), 1.0)) * 180.0 / 3.14159265358979;
+				r.normal_max_degrees = std::max(r.normal_max_degrees, degrees);
+			}
+		}
+	}
+	if (vertices_qty)
+	{
+		r.position_rms = std::sqrt(squared_sum / vertices_qty);
+	}
+	return r;
+}
+
+void Z_VertexQuantizer::print_Report(std::ostream& out, const error_report& report)
+{
+	const auto flags = out.flags();
+	const auto precision = out.precision();
+	out << report.vertices << " vertices packed from " << report.source_stride << " to " << report.packed_stride
+		<< " bytes, " << std::setprecision(2) << static_cast<double>(report.source_stride) / report.packed_stride
+		<< "x less vertex bandwidth.\n";
+	out << std::scientific << std::setprecision(2);
+	out << "    position error:    max " << report.position_max << ", rms " << report.position_rms << "\n";
+	out << "    color error:       max " << report.color_max << "\n";
+	out << "    uv error:          max " << report.uv_max << "\n";
+	out << "    normal error:      max " << report.normal_max_degrees << " degrees\n";
+	out.flags(flags);
+	out.precision(precision);
+}
+
+void Z_VertexQuantizer::benchmark(std::ostream& out, size_t vertices_qty)
+{
+	typedef std::chrono::high_resolution_clock clock;
+	auto milliseconds = [](clock::duration d)
+	{
+		return std::chrono::duration<double, std::milli>(d).count();
+	};
+
+	// Points of a sphere off the origin with all the attributes.
+	struct vertex
+	{
+		float position[4];
+		float color[4];
+		float uv[2];
+		float normal[3];
+	};
+	std::mt19937 random(2016);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	std::normal_distribution<float> gaussian;
+	std::vector<vertex> vertices(vertices_qty);
+	for (auto& v : vertices)
+	{
+		float n[3] = { gaussian(random), gaussian(random), gaussian(random) };
+		const float length = std::max(std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]), 1e-6f);
+		for (size_t k = 0; k < 3; ++k)
+		{
+			v.normal[k] = n[k] / length;
+			v.position[k] = 10.0f + 5.0f * v.normal[k];
+		}
+		v.position[3] = 1.0f;
+		for (auto& c : v.color)
+		{
+			c = unit(random);
+		}
+		v.uv[0] = 4.0f * unit(random);
+		v.uv[1] = 4.0f * unit(random);
+	}
+
+	const source_layout src = { sizeof(vertex), offsetof(vertex, position), offsetof(vertex, color),
+		offsetof(vertex, uv), offsetof(vertex, normal) };
+	const uint8_t* data = reinterpret_cast<const uint8_t*>(vertices.data());
+	const double megabytes = vertices.size() * sizeof(vertex) / (1024.0 * 1024.0);
+
+	const auto flags = out.flags();
+	const auto precision = out.precision();
+	const char* names[] = { "float32", "half", "snorm16" };
+	for (auto format : { position_float32, position_half, position_snorm16 })
+	{
+		Z_VertexQuantizer quantizer(src, format);
+
+		auto start = clock::now();
+		std::vector<uint8_t> scalar = quantizer.quantize(data, vertices.size(), false);
+		const double scalar_ms = milliseconds(clock::now() - start);
+
+		start = clock::now();
+		std::vector<uint8_t> simd = quantizer.quantize(data, vertices.size(), true);
+		const double simd_ms = milliseconds(clock::now() - start);
+
+		out << "Vertex quantization with " << names[format] << " positions: ";
+		print_Report(out, quantizer.measure_Error(data, simd.data(), vertices.size()));
+		out << std::fixed << std::setprecision(0);
+		out << "    scalar:            " << megabytes / scalar_ms * 1000.0 << " MB/s\n";
+		out << "    " << (has_Simd() ? "SSE2" : "no SIMD") << ":              " << megabytes / simd_ms * 1000.0 << " MB/s"
+			<< (scalar == simd ? "" : ", results differ from scalar") << "\n";
+		out.flags(flags);
+		out.precision(precision);
+	}
+}
@@ -0,0 +1,127 @@
+/* Z_VertexQuantizer.h
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+#ifndef Z_VertexQuantizer_h
+#define Z_VertexQuantizer_h
+
+#include <vector>
+#include <cstdint>
+#include <ostream>
+
+#include "Z_IndexedMesh.h"
+
+/* Packs float vertex attributes into compact formats a vertex fetch decodes: */
+/*  - position: float32x4, half x4, or snorm16x4 relative to the mesh bounds, */
+/*  - color: unorm8x4,                                                        */
+/*  - uv: half x2,                                                            */
+/*  - normal: octahedral snorm16x2. The vertex shader decodes it with         */
+/*      n = vec3(e, 1 - abs(e.x) - abs(e.y));                                 */
+/*      if (n.z < 0) n.xy = (1 - abs(n.yx)) * sign(n.xy);                     */
+/*      n = normalize(n);                                                     */
+/* Position, color and uv are converted with SSE2 where it is available.     */
+class Z_VertexQuantizer
+{
+public:
+	enum position_format { position_float32, position_half, position_snorm16 };
+
+	static const uint32_t absent = ~0u;
+
+	/* Offsets of float attributes inside a source vertex, absent if missing:  */
+	/* position x, y, z, w, color r, g, b, a, uv u, v and normal x, y, z.      */
+	struct source_layout
+	{
+		uint32_t stride;
+		uint32_t position;
+		uint32_t color;
+		uint32_t uv;
+		uint32_t normal;
+	};
+
+	/* Offsets inside a packed vertex, attributes keep the source order. */
+	struct packed_layout
+	{
+		position_format format;
+		uint32_t stride;
+		uint32_t position;
+		uint32_t color;
+		uint32_t uv;
+		uint32_t normal;
+	};
+
+	/* Largest decoding errors, position ones in source units. */
+	struct error_report
+	{
+		size_t vertices;
+		uint32_t source_stride;
+		uint32_t packed_stride;
+		double position_max;
+		double position_rms;
+		double color_max;
+		double uv_max;
+		double normal_max_degrees;
+	};
+
+	Z_VertexQuantizer(const source_layout& source, position_format format);
+
+	const packed_layout& get_Layout() const { return layout; }
+
+	/* A decoded position maps back to the source one as center + extent * p. */
+	/* Both are identity but for snorm16, where the mapping is meant to be     */
+	/* folded into the model matrix.                                           */
+	const float* get_Center() const { return center; }
+	const float* get_Extent() const { return extent; }
+
+	/* Snorm16 bounds are taken from the vertices being packed. */
+	std::vector<uint8_t> quantize(const uint8_t* vertices, size_t vertices_qty, bool use_simd = true);
+	Z_IndexedMesh quantize(const Z_IndexedMesh& mesh, bool use_simd = true);
+
+	error_report measure_Error(const uint8_t* source, const uint8_t* packed, size_t vertices_qty) const;
+	static void print_Report(std::ostream& out, const error_report& report);
+
+	static bool has_Simd();
+
+	static uint16_t float_to_half(float f);
+	static float half_to_float(uint16_t h);
+	static void encode_Octahedral(const float* normal, int16_t* encoded);
+	static void decode_Octahedral(const int16_t* encoded, float* normal);
+
+	static void benchmark(std::ostream& out, size_t vertices_qty);
+private:
+	void compute_Bounds(const uint8_t* vertices, size_t vertices_qty);
+	void quantize_Scalar(const uint8_t* vertices, size_t vertices_qty, uint8_t* packed) const;
+	void quantize_Simd(const uint8_t* vertices, size_t vertices_qty, uint8_t* packed) const;
+	void decode_Position(const uint8_t* packed, float* position) const;
+
+	source_layout source;
+	packed_layout layout;
+	float center[4];
+	float extent[4];
+};
+
+#endif // !Z_VertexQuantizer_h
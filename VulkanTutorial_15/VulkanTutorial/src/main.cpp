@@ -2,7 +2,7 @@
  * VulkanTutorial project
  *
  * Created by Andriy Zhabura on 02-Oct-2016.
- * Last modified on 12-Dec-2016.
+ * Last modified on 19-Oct-2026.
  */
 
 /*
@@ -30,8 +30,43 @@
 #include <iostream>
 #include <thread>
 #include <chrono>
+#include <stdexcept>
+#include <map>
+#include <mutex>
 
 #include "ZVK_Application.h"
+#include "Z_TaskGraph.h"
+#include "Z_MeshOptimizer.h"
+#include "Z_MeshSimplifier.h"
+#include "Z_LodSelector.h"
+#include "Z_MatrixBatch.h"
+#include "Z_TransformHierarchy.h"
+#include "Z_Bvh.h"
+#include "Z_JobSystem.h"
+
+static bool has_option(int argc, char **argv, const std::string& option)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		if (option == argv[i])
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+static std::string get_option_value(int argc, char **argv, const std::string& option, const std::string& default_value)
+{
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		if (option == argv[i])
+		{
+			return argv[i + 1];
+		}
+	}
+	return default_value;
+}
 
 int main(int argc, char **argv)
 try
@@ -63,68 +98,377 @@ try
 	std::cout << "Found " << app.get_PhysicalDevicesQty()
 		<< " physical device" << (app.get_PhysicalDevicesQty() > 1 ? "s.\n" : ".\n");
 	
+	// The remaining initialization stages are independent of each other
+	// as soon as the Logical Device exists, so they are declared as a
+	// graph with their real dependencies and run on a thread pool. The
+	// pool also serves the stages which parallelize their own work.
+	Z_ThreadPool pool;
+	Z_TaskGraph init;
+
+	app.set_BindlessMode(has_option(argc, argv, "--bindless"));
+	app.set_IndirectDraws(has_option(argc, argv, "--indirect"));
+	app.set_Culling(has_option(argc, argv, "--cull") || has_option(argc, argv, "--cull-bvh"));
+	app.set_BvhCulling(has_option(argc, argv, "--cull-bvh"));
+	app.set_GpuCulling(has_option(argc, argv, "--gpu-cull"));
+
+	const std::string scene = get_option_value(argc, argv, "--scene", "solid");
+	if ("textured" == scene)
+	{
+		app.set_Scene(ZVK_Application::textured_cube);
+	}
+	else if ("solid" != scene)
+	{
+		throw std::domain_error{ "Unknown scene " + scene + ", expected solid or textured" };
+	}
+
+	const std::string vertex_format = get_option_value(argc, argv, "--vertex-format", "float");
+	if ("half" == vertex_format)
+	{
+		app.set_VertexFormat(Z_VertexQuantizer::position_half);
+	}
+	else if ("snorm16" == vertex_format)
+	{
+		app.set_VertexFormat(Z_VertexQuantizer::position_snorm16);
+	}
+	else if ("float" != vertex_format)
+	{
+		throw std::domain_error{ "Unknown vertex format " + vertex_format + ", expected float, half or snorm16" };
+	}
+
+	// The benchmark sweeps the quantity, it only needs instancing selected.
+	const std::string instances = get_option_value(argc, argv, "--instances", "");
+	if (instances.size() || has_option(argc, argv, "--bench-instancing"))
+	{
+		app.set_InstancesQty(instances.size() ? std::stoul(instances) : 1);
+	}
+
+	const std::string mesh_file = get_option_value(argc, argv, "--mesh", "");
+	if (mesh_file.size())
+	{
+		app.set_MeshFile(mesh_file, get_option_value(argc, argv, "--mesh-name", ""));
+	}
+	const std::string lods = get_option_value(argc, argv, "--lods", "");
+	if (lods.size())
+	{
+		app.set_LevelsOfDetail(std::stoul(lods), std::stof(get_option_value(argc, argv, "--lod-pixels", "1")));
+	}
+
 	////// Start VulkanTutorial_03. //////
-	std::cout << "Logical Device is "
-		<< (app.create_LogicalDevice() ? "" : "NOT ") << "created.\n";
+	auto device = init.add_task("Logical Device",
+		[&] { return app.create_LogicalDevice(); });
 
 	////// Start VulkanTutorial_04. //////
-	std::cout << "Command Buffers are "
-        << (app.allocate_CommandBuffers() ? "" : "NOT ") << "allocated.\n";
-
-    ////// Start VulkanTutorial_05. //////
-    std::cout << "Swap Chain is "
-        << (app.create_Swapchain() ? "" : "NOT ") << "created.\n";
-    std::cout << "Image Views are "
-        << (app.create_ImageViews() ? "" : "NOT ") << "created.\n";
-
-    ////// Start VulkanTutorial_06. //////
-    std::cout << "Depth Buffer is "
-        << (app.create_DepthBuffer() ? "" : "NOT ") << "created.\n";
-
-    ////// Start VulkanTutorial_07. //////
-    std::cout << "Uniform Buffer is "
-        << (app.create_UniformBuffer() ? "" : "NOT ") << "created.\n";
-
-    ////// Start VulkanTutorial_08. //////
-    std::cout << "Descriptor Set Layout is "
-        << (app.create_DescriptorSetLayout() ? "" : "NOT ") << "created.\n";
-    std::cout << "Pipeline Layout is "
-        << (app.create_PipelineLayout() ? "" : "NOT ") << "created.\n";
-
-    ////// Start VulkanTutorial_09. //////
-    std::cout << "Descriptor Sets are "
-        << (app.allocate_DescriptorSets() ? "" : "NOT ") << "allocated.\n";
-    app.update_DescriptorSets();
-    std::cout << "Descriptor Sets are updated.\n";
-
-    ////// Start VulkanTutorial_10. //////
-    std::cout << "Render Pass Layout is "
-		<< (app.create_RenderPass() ? "" : "NOT ") << "created.\n";
+	auto command_buffers = init.add_task("Command Buffers",
+		[&] { return app.allocate_CommandBuffers(); }, { device });
 
-	////// Start VulkanTutorial_11. //////
-	std::cout << "Shaders are "
-		<< (app.create_Shaders() ? "" : "NOT ") << "created.\n";
+	////// Start VulkanTutorial_05. //////
+	auto swapchain = init.add_task("Swap Chain",
+		[&] { return app.create_Swapchain(); }, { device });
+	auto image_views = init.add_task("Image Views",
+		[&] { return app.create_ImageViews(); }, { swapchain });
 
-	////// Start VulkanTutorial_12. //////
-	std::cout << "FrameBuffers are "
-		<< (app.create_FrameBuffers() ? "" : "NOT ") << "created.\n";
+	////// Start VulkanTutorial_06. //////
+	auto depth_buffer = init.add_task("Depth Buffer",
+		[&] { return app.create_DepthBuffer(); }, { device });
+
+	auto texture = init.add_task("Texture",
+		[&] { return app.create_Texture(); }, { device });
 
 	////// Start VulkanTutorial_13. //////
-	std::cout << "Vertex Buffer is "
-		<< (app.create_VertexBuffer() ? "" : "NOT ") << "created.\n";
+	// Mesh files are uploaded through the queue the Texture uses.
+	auto vertex_buffer = init.add_task("Vertex Buffer",
+		[&] { return app.create_VertexBuffer(pool); }, { device, texture });
+
+	////// Start VulkanTutorial_07. //////
+	// The MVP includes the dequantization of packed vertex positions.
+	auto uniform_buffer = init.add_task("Uniform Buffer",
+		[&] { return app.create_UniformBuffer(); }, { vertex_buffer });
+
+	////// Start VulkanTutorial_08. //////
+	auto descriptor_layout = init.add_task("Descriptor Set Layout",
+		[&] { return app.create_DescriptorSetLayout(); }, { device });
+	auto pipeline_layout = init.add_task("Pipeline Layout",
+		[&] { return app.create_PipelineLayout(); }, { descriptor_layout });
+
+	////// Start VulkanTutorial_09. //////
+	auto descriptor_sets = init.add_task("Descriptor Sets allocation",
+		[&] { return app.allocate_DescriptorSets(); }, { descriptor_layout });
+	auto descriptor_update = init.add_task("Descriptor Sets update",
+		[&] { app.update_DescriptorSets(); return true; }, { descriptor_sets, uniform_buffer, texture });
+
+	////// Start VulkanTutorial_10. //////
+	// The Render Pass needs the surface format chosen by the Swap Chain
+	// and the format of the Depth Buffer.
+	auto render_pass = init.add_task("Render Pass",
+		[&] { return app.create_RenderPass(); }, { swapchain, depth_buffer });
+
+	////// Start VulkanTutorial_11. //////
+	auto shaders = init.add_task("Shaders",
+		[&] { return app.create_Shaders(); }, { device });
+
+	////// Start VulkanTutorial_12. //////
+	auto framebuffers = init.add_task("FrameBuffers",
+		[&] { return app.create_FrameBuffers(); }, { render_pass, image_views, depth_buffer });
 
 	////// Start VulkanTutorial_14. //////
+	auto pipeline = init.add_task("Graphics Pipeline",
+		[&] { return app.create_GraphicsPipeline(); },
+		{ pipeline_layout, render_pass, shaders, vertex_buffer });
+
+	init.run(pool);
+
+	std::cout << "Logical Device is "
+		<< (init.succeeded(device) ? "" : "NOT ") << "created.\n";
+	std::cout << "Command Buffers are "
+		<< (init.succeeded(command_buffers) ? "" : "NOT ") << "allocated.\n";
+	std::cout << "Swap Chain is "
+		<< (init.succeeded(swapchain) ? "" : "NOT ") << "created.\n";
+	std::cout << "Image Views are "
+		<< (init.succeeded(image_views) ? "" : "NOT ") << "created.\n";
+	std::cout << "Depth Buffer is "
+		<< (init.succeeded(depth_buffer) ? "" : "NOT ") << "created.\n";
+	std::cout << "Uniform Buffer is "
+		<< (init.succeeded(uniform_buffer) ? "" : "NOT ") << "created.\n";
+	std::cout << "Texture is "
+		<< (init.succeeded(texture) ? "" : "NOT ") << "created.\n";
+	std::cout << "Descriptor Set Layout is "
+		<< (init.succeeded(descriptor_layout) ? "" : "NOT ") << "created.\n";
+	std::cout << "Pipeline Layout is "
+		<< (init.succeeded(pipeline_layout) ? "" : "NOT ") << "created.\n";
+	std::cout << "Descriptor Sets are "
+		<< (init.succeeded(descriptor_sets) ? "" : "NOT ") << "allocated.\n";
+	std::cout << "Descriptor Sets are "
+		<< (init.succeeded(descriptor_update) ? "" : "NOT ") << "updated.\n";
+	std::cout << "Render Pass Layout is "
+		<< (init.succeeded(render_pass) ? "" : "NOT ") << "created.\n";
+	std::cout << "Shaders are "
+		<< (init.succeeded(shaders) ? "" : "NOT ") << "created.\n";
+	std::cout << "FrameBuffers are "
+		<< (init.succeeded(framebuffers) ? "" : "NOT ") << "created.\n";
+	std::cout << "Vertex Buffer is "
+		<< (init.succeeded(vertex_buffer) ? "" : "NOT ") << "created.\n";
 	std::cout << "Graphics Pipeline is "
-		<< (app.create_GraphicsPipeline() ? "" : "NOT ") << "created.\n";
+		<< (init.succeeded(pipeline) ? "" : "NOT ") << "created.\n";
+
+	std::cout << "Descriptors are bound "
+		<< (app.is_BindlessMode() ? "through the bindless table.\n" : "per descriptor set.\n");
+	if (app.is_IndirectDraws())
+	{
+		std::cout << "Draws are read from an indirect buffer "
+			<< (app.has_MultiDrawIndirect() ? "by one multi-draw command.\n" : "one command at a time.\n");
+	}
+	if (app.is_GpuCulling())
+	{
+		std::cout << "Instanced rendering of " << app.get_InstancesQty() << " instances frustum culled by a compute shader.\n";
+	}
+	else if (app.is_Instancing())
+	{
+		std::cout << "Instanced rendering of " << app.get_InstancesQty() << " instances streamed every frame"
+			<< (app.is_Culling() ? (app.is_BvhCulling() ? ", frustum culled on the CPU through a BVH.\n" : ", frustum culled on the CPU.\n") : ".\n");
+	}
+
+	if (ZVK_Application::textured_cube == app.get_Scene())
+	{
+		auto upload = app.get_TextureUploadStatistics();
+		std::cout << "Texture upload: " << upload.bytes / 1024 << " KB in "
+			<< upload.seconds * 1000.0 << " ms, " << upload.megabytes_per_second() << " MB/s.\n";
+	}
+
+	if (init.succeeded(vertex_buffer) && app.is_ImportedMesh())
+	{
+		auto imported = app.get_ImportStatistics();
+		std::cout << "Imported mesh: " << imported.triangles << " triangles, " << imported.vertices << " vertices in "
+			<< imported.parts << " parts, " << imported.bytes / 1024 << " KB parsed at " << imported.parse_megabytes_per_second()
+			<< " MB/s, built in " << imported.build_seconds * 1000.0 << " ms.\n";
+	}
+	if (init.succeeded(vertex_buffer) && app.get_LevelsOfDetailQty())
+	{
+		std::cout << "Levels of detail: " << app.get_LevelsOfDetailQty() << " coarser levels of the mesh selected per instance.\n";
+	}
+	if (init.succeeded(vertex_buffer) && app.has_MeshFile())
+	{
+		auto upload = app.get_BufferUploadStatistics();
+		std::cout << "Mesh file: " << upload.bytes / 1024 << " KB uploaded through the staging ring in "
+			<< upload.batches << " batches, " << upload.megabytes_per_second() << " MB/s.\n";
+	}
+	else if (init.succeeded(vertex_buffer))
+	{
+		auto& mesh = app.get_Mesh();
+		std::cout << "Indexed mesh: " << mesh.get_IndicesQty() << " vertices welded into " << mesh.get_VerticesQty()
+			<< " with " << 8 * mesh.get_IndexSize() << "-bit indices, " << mesh.get_SavedInvocations()
+			<< " vertex shader invocations saved per draw.\n";
+		auto cache = Z_MeshOptimizer::analyze(mesh, Z_MeshOptimizer::default_options.cache_size);
+		std::cout << "Optimized mesh: ACMR " << cache.acmr << ", ATVR " << cache.atvr << ".\n";
+		if (Z_VertexQuantizer::position_float32 != app.get_VertexFormat())
+		{
+			std::cout << "Quantized vertices: ";
+			Z_VertexQuantizer::print_Report(std::cout, app.get_VertexQuantizationReport());
+		}
+	}
+
+	init.print_report(std::cout);
+
+	if (app.get_StartupReport().save("startup_report.json"))
+	{
+		std::cout << "Startup report is saved to startup_report.json.\n";
+	}
+
+	if (!init.succeeded(pipeline) || !init.succeeded(command_buffers) || !init.succeeded(framebuffers))
+	{
+		throw std::domain_error{ "Vulkan Application initialization failed" };
+	}
+
+	if (has_option(argc, argv, "--bench-descriptors"))
+	{
+		app.benchmark_DescriptorAllocation(std::cout, 100000);
+		return 0;
+	}
+	if (has_option(argc, argv, "--bench-descriptor-updates"))
+	{
+		app.benchmark_DescriptorUpdate(std::cout, 10000);
+		return 0;
+	}
+
+	if (has_option(argc, argv, "--bench-texture-upload"))
+	{
+		app.benchmark_TextureUpload(std::cout, 2048, 32);
+		return 0;
+	}
+
+	if (has_option(argc, argv, "--bench-instancing"))
+	{
+		app.benchmark_Instancing(std::cout, 1000000, 10);
+		return 0;
+	}
+
+	if (has_option(argc, argv, "--bench-culling"))
+	{
+		Z_JobSystem jobs;
+		Z_FrustumCuller::benchmark(std::cout, jobs, 1000000);
+		return 0;
+	}
+
+	if (has_option(argc, argv, "--bench-transforms"))
+	{
+		Z_JobSystem jobs;
+		Z_MatrixBatch::benchmark(std::cout, jobs, 1000000);
+		Z_TransformHierarchy::benchmark(std::cout, jobs, 1000000);
+		return 0;
+	}
+
+	if (has_option(argc, argv, "--bench-bvh"))
+	{
+		Z_JobSystem jobs;
+		Z_Bvh::benchmark(std::cout, jobs, 10000);
+		Z_Bvh::benchmark(std::cout, jobs, 100000);
+		Z_Bvh::benchmark(std::cout, jobs, 1000000);
+		return 0;
+	}
+
+	if (has_option(argc, argv, "--bench-jobs"))
+	{
+		Z_JobSystem::benchmark(std::cout, 1000000);
+		return 0;
+	}
+
+	if (has_option(argc, argv, "--bench-vertex-quantization"))
+	{
+		Z_VertexQuantizer::benchmark(std::cout, 1000000);
+		return 0;
+	}
+
+	if (has_option(argc, argv, "--bench-mesh-optimizer"))
+	{
+		Z_MeshOptimizer::benchmark(std::cout, pool, 256);
+		return 0;
+	}
+
+	if (has_option(argc, argv, "--bench-import"))
+	{
+		Z_MeshImporter::benchmark(std::cout, pool, 1000000);
+		return 0;
+	}
+
+	if (has_option(argc, argv, "--bench-lod"))
+	{
+		Z_JobSystem jobs;
+		Z_MeshSimplifier::benchmark(std::cout, 1000000);
+		Z_LodSelector::benchmark(std::cout, jobs, 1000000);
+		return 0;
+	}
+
+	// Time spent in the frame jobs, by job name.
+	std::mutex job_times_mutex;
+	std::map<std::string, std::pair<size_t, double>> job_times;
+	if (has_option(argc, argv, "--job-timings"))
+	{
+		app.get_FrameJobs().set_TimingHook([&](const Z_JobSystem::job_timing& timing)
+		{
+			const double ms = std::chrono::duration<double, std::milli>(timing.finish - timing.start).count();
+			std::lock_guard<std::mutex> lock(job_times_mutex);
+			auto& entry = job_times[timing.name];
+			++entry.first;
+			entry.second += ms;
+		});
+	}
 
 	////// Start VulkanTutorial_15. //////
+	// The camera circles the scene by 3.6 degrees a frame.
+	const bool orbit = has_option(argc, argv, "--orbit");
+	const glm::vec3 start_eye = app.get_Camera().get_Eye();
 	for (int i = 0; i < 100; ++i)
 	{
+		if (orbit)
+		{
+			Z_Camera& camera = app.get_Camera();
+			const glm::mat4 turn = glm::rotate(glm::mat4(1.0f), glm::radians(3.6f * i), glm::vec3(0.0f, 1.0f, 0.0f));
+			camera.look_At(glm::vec3(turn * glm::vec4(start_eye, 1.0f)), camera.get_Target(), camera.get_Up());
+		}
 		app.draw_GraphicsPipeline();
 
 		std::this_thread::sleep_for(std::chrono::milliseconds(100));
 	}
 
+	if (app.get_LevelsOfDetailQty())
+	{
+		std::cout << "Instances per level of detail in the last frame:";
+		for (auto qty : app.get_LevelInstancesQty())
+		{
+			std::cout << " " << qty;
+		}
+		std::cout << ".\n";
+	}
+
+	if (app.is_Instancing() && has_option(argc, argv, "--pick"))
+	{
+		const uint32_t picked = app.pick_Instance(0.5f, 0.5f);
+		if (Z_Bvh::no_object == picked)
+		{
+			std::cout << "No instance at the window center.\n";
+		}
+		else
+		{
+			std::cout << "Instance " << picked << " at the window center.\n";
+		}
+	}
+
+	if (job_times.size())
+	{
+		auto jobs = app.get_FrameJobs().get_Statistics();
+		std::cout << "Frame jobs on " << app.get_FrameJobs().size() << " workers: " << jobs.jobs << " run, " << jobs.steals << " stolen.\n";
+		for (auto& entry : job_times)
+		{
+			std::cout << "    " << entry.first << ": " << entry.second.first << " jobs, " << entry.second.second << " ms.\n";
+		}
+	}
+
+	auto camera = app.get_Camera().get_Statistics();
+	std::cout << "Camera: " << camera.projection_updates << " projection and " << camera.view_updates << " view updates.\n";
+
+	auto cache = app.get_DescriptorCacheStatistics();
+	std::cout << "Descriptor Set cache: " << cache.hits << " hits, " << cache.misses << " misses, "
+		<< cache.evictions << " evictions, hit rate " << 100.0 * cache.hit_rate() << "%.\n";
+
 	return 0;
 }
 catch (std::bad_alloc&)
@@ -0,0 +1,189 @@
+/* ZMeshConverter.cpp
+ * VulkanTutorial project
+ *
+ * Created by Andriy Zhabura on 19-Oct-2026.
+ * Last modified on 19-Oct-2026.
+ */
+
+/*
+ * Copyright © 2016 Andriy Zhabura
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that copyright
+ * notice and this permission notice appear in supporting documentation, and
+ * that the name of the copyright holders not be used in advertising or
+ * publicity pertaining to distribution of the software without specific,
+ * written prior permission.  The copyright holders make no representations
+ * about the suitability of this software for any purpose.  It is provided "as
+ * is" without express or implied warranty.
+ *
+ * THE COPYRIGHT HOLDERS DISCLAIM ALL WARRANTIES WITH REGARD TO THIS SOFTWARE,
+ * INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS, IN NO
+ * EVENT SHALL THE COPYRIGHT HOLDERS BE LIABLE FOR ANY SPECIAL, INDIRECT OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE,
+ * DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE
+ * OF THIS SOFTWARE.
+ */
+ 
+/* Writes Z_MeshFile containers:                                        */
+/*   ZMeshConverter <output.zmsh> [--vertex-format float|half|snorm16]  */
+/*                  [--import model.obj|model.gltf] [--lods N]          */
+/*   ZMeshConverter --list <file.zmsh>                                  */
+/* The built-in cubes, or the parts of an imported model merged in one */
+/* mesh, are welded, optimized, simplified into N levels of detail and */
+/* optionally quantized.                                                */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <cstddef>
+
+#include "../Z_MeshFile.h"
+#include "../Z_MeshOptimizer.h"
+#include "../Z_MeshSimplifier.h"
+#include "../Z_MeshImporter.h"
+#include "../Z_Vertices.h"
+
+static std::string get_option_value(int argc, char **argv, const std::string& option, const std::string& default_value)
+{
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		if (option == argv[i])
+		{
+			return argv[i + 1];
+		}
+	}
+	return default_value;
+}
+
+static void list(const std::string& path)
+{
+	Z_MeshFile file(path);
+	std::cout << path << ": " << file.get_MeshesQty() << " meshes\n";
+	for (size_t i = 0; i < file.get_MeshesQty(); ++i)
+	{
+		const Z_MeshFile::mesh_entry& e = file.get_Entry(i);
+		std::cout << "    " << e.name << ": " << e.vertices_qty << " vertices of " << e.layout.stride << " bytes, "
+			<< e.indices_qty << " " << 8 * e.index_size << "-bit indices\n";
+		for (size_t l = 0; l < e.lods_qty; ++l)
+		{
+			std::cout << "        lod " << l + 1 << ": " << e.lods[l].indices_qty / 3 << " triangles, error "
+				<< e.lods[l].error << "\n";
+		}
+	}
+}
+
+int main(int argc, char **argv)
+try
+{
+	if (argc < 2)
+	{
+		std::cerr << "Usage: ZMeshConverter <output.zmsh> [--vertex-format float|half|snorm16]\n"
+			"                      [--import model.obj|model.gltf] [--lods N]\n"
+			"       ZMeshConverter --list <file.zmsh>\n";
+		return 1;
+	}
+
+	const std::string listed = get_option_value(argc, argv, "--list", "");
+	if (listed.size())
+	{
+		list(listed);
+		return 0;
+	}
+
+	const std::string vertex_format = get_option_value(argc, argv, "--vertex-format", "float");
+	Z_VertexQuantizer::position_format format = Z_VertexQuantizer::position_float32;
+	if ("half" == vertex_format)
+	{
+		format = Z_VertexQuantizer::position_half;
+	}
+	else if ("snorm16" == vertex_format)
+	{
+		format = Z_VertexQuantizer::position_snorm16;
+	}
+	else if ("float" != vertex_format)
+	{
+		throw std::domain_error{ "Unknown vertex format " + vertex_format + ", expected float, half or snorm16" };
+	}
+
+	const int lods_qty = std::stoi(get_option_value(argc, argv, "--lods", "0"));
+	if (lods_qty < 0 || lods_qty > static_cast<int>(Z_MeshFile::max_lods))
+	{
+		throw std::domain_error{ "The levels of detail are 0 to " + std::to_string(Z_MeshFile::max_lods) };
+	}
+	const std::string imported = get_option_value(argc, argv, "--import", "");
+
+	const uint32_t absent = Z_VertexQuantizer::absent;
+	const Z_VertexQuantizer::source_layout color_layout{ sizeof(Vertex), offsetof(Vertex, posX), offsetof(Vertex, r), absent, absent };
+	const Z_VertexQuantizer::source_layout uv_layout{ sizeof(VertexUV), offsetof(VertexUV, posX), absent, offsetof(VertexUV, u), absent };
+
+	struct cube
+	{
+		std::string name;
+		Z_IndexedMesh mesh;
+		Z_VertexQuantizer::source_layout layout;
+	};
+	std::vector<cube> cubes;
+	if (imported.size())
+	{
+		// The parts are welded back together, so their seams are no borders to the simplifier.
+		Z_ThreadPool pool;
+		Z_MeshImporter importer(color_layout, pool);
+		importer.open(imported);
+		std::vector<uint8_t> soup;
+		importer.build([&](const Z_IndexedMesh& part)
+		{
+			const uint8_t* vertices = part.get_Vertices().data();
+			for (auto i : part.get_Indices())
+			{
+				soup.insert(soup.end(), vertices + i * sizeof(Vertex), vertices + (i + 1) * sizeof(Vertex));
+			}
+		});
+		const size_t slash = imported.find_last_of("/\\");
+		const std::string name = imported.substr(std::string::npos == slash ? 0 : slash + 1);
+		cubes.push_back(cube{ name.substr(0, name.find('.')), Z_IndexedMesh::weld(soup.data(),
+			soup.size() / sizeof(Vertex), sizeof(Vertex)), color_layout });
+	}
+	else
+	{
+		cubes.push_back(cube{ "solid_cube", Z_IndexedMesh::weld(g_vb_solid_face_colors_Data,
+			sizeof(g_vb_solid_face_colors_Data) / sizeof(g_vb_solid_face_colors_Data[0]), sizeof(Vertex)), color_layout });
+		cubes.push_back(cube{ "color_cube", Z_IndexedMesh::weld(g_vbData,
+			sizeof(g_vbData) / sizeof(g_vbData[0]), sizeof(Vertex)), color_layout });
+		cubes.push_back(cube{ "textured_cube", Z_IndexedMesh::weld(g_vb_texture_Data,
+			sizeof(g_vb_texture_Data) / sizeof(g_vb_texture_Data[0]), sizeof(VertexUV)), uv_layout });
+	}
+
+	std::vector<Z_MeshFile::source> sources;
+	for (auto& c : cubes)
+	{
+		Z_MeshOptimizer::optimize(c.mesh);
+		Z_MeshFile::source source{ c.name, &c.mesh, Z_MeshFile::make_Layout(c.layout), {} };
+		// Quantizing keeps the vertex order, the levels index the packed vertices as well.
+		for (auto& lod : Z_MeshSimplifier::generate_Lods(c.mesh, c.layout.position, lods_qty))
+		{
+			source.lods.push_back(Z_MeshFile::lod_source{ std::move(lod.indices), lod.error });
+		}
+		if (Z_VertexQuantizer::position_float32 != format)
+		{
+			Z_VertexQuantizer quantizer(c.layout, format);
+			c.mesh = quantizer.quantize(c.mesh);
+			source.layout = Z_MeshFile::make_Layout(quantizer);
+		}
+		sources.push_back(std::move(source));
+	}
+
+	Z_MeshFile::write(argv[1], sources);
+	list(argv[1]);
+
+	return 0;
+}
+catch (std::domain_error& err)
+{
+	std::cerr << err.what() << "\n";
+
+	return 2;
+}